@@ -0,0 +1,142 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
+#define __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
+
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace Antares
+{
+/*!
+** \brief Binary cache of the matrices loaded from CSV files (opt-in)
+**
+** When enabled, each matrix parsed from a CSV file of the study is stored in a binary
+** file of the folder `.antares-cache` of the study, column after column, in the layout
+** of `Matrix::entry`. The following loadings read this file instead of parsing the CSV
+** file again, as long as its size, its date of last modification and its hash are
+** unchanged. A stale file is simply rebuilt.
+*/
+class MatrixCache final
+{
+public:
+    //! Header of a cache file
+    struct Header
+    {
+        //! Magic and version of the format
+        char magic[8];
+        uint32_t version;
+        //! Types of the matrix (see TypeTag)
+        uint32_t type;
+        //! Parameters given for loading the CSV file
+        uint32_t options;
+        uint32_t minWidth;
+        uint32_t maxHeight;
+        //! Size of the matrix
+        uint32_t width;
+        uint32_t height;
+        uint32_t reserved;
+        //! Properties of the CSV file
+        uint64_t csvSize;
+        int64_t csvLastModification;
+        uint64_t csvHash;
+    };
+
+    //! A cache file and its expected header
+    struct Entry
+    {
+        std::string filename;
+        Header header;
+    };
+
+    //! Name of the folder, relative to the study, holding the cache files
+    static constexpr const char* folderName = ".antares-cache";
+
+    /*!
+    ** \brief Enable the cache for the study located in `studyFolder`
+    **
+    ** Only the CSV files belonging to this study are cached.
+    */
+    static void Enable(const AnyString& studyFolder);
+    //! Disable the cache
+    static void Disable();
+    //! Get if the cache is enabled
+    static bool Enabled();
+    //! Folder holding the cache files, empty if the cache is disabled
+    static std::string Folder();
+
+    /*!
+    ** \brief Prepare the cache entry of a CSV file, from its content
+    **
+    ** \return False if the file can not be cached (cache disabled, outside of the study)
+    */
+    static bool Prepare(Entry& entry,
+                        const AnyString& csvFilename,
+                        const char* data,
+                        size_t size,
+                        uint32_t type,
+                        uint32_t options,
+                        uint32_t minWidth,
+                        uint32_t maxHeight);
+
+    //! True if a header read from a cache file matches the expected one
+    static bool Matches(const Header& expected, const Header& cached);
+
+    //! Create the directory of a cache file and return the temporary filename to write into
+    static bool PrepareForWriting(const Entry& entry, std::string& temporaryFilename);
+    //! Replace the cache file by the one freshly written
+    static bool Commit(const Entry& entry, const std::string& temporaryFilename);
+
+    //! Hash of the content of a CSV file
+    static uint64_t Hash(const char* data, size_t size);
+
+    //! Identifier of the types of a matrix, 0 if the matrix can not be cached
+    template<class T, class ReadWriteT>
+    static constexpr uint32_t TypeTag()
+    {
+        if constexpr (std::is_arithmetic_v<T> and std::is_arithmetic_v<ReadWriteT>)
+            return (ScalarTag<T>() << 16) | ScalarTag<ReadWriteT>();
+        else
+            return 0;
+    }
+
+private:
+    template<class T>
+    static constexpr uint32_t ScalarTag()
+    {
+        return static_cast<uint32_t>(sizeof(T)) | (std::is_floating_point_v<T> ? 0x100u : 0u)
+               | (std::is_signed_v<T> ? 0x200u : 0u);
+    }
+
+}; // class MatrixCache
+
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
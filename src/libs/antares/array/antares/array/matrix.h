@@ -31,6 +31,7 @@
 #include <yuni/io/file.h>
 #include <cassert>
 #include "../jit.h"
+#include "matrix-cache.h"
 #include "../constants.h"
 #include <set>
 #include <antares/memory/memory.h>
@@ -511,12 +512,31 @@ private:
                              PredicateT& predicate,
                              bool saveEvenIfAllZero) const;
 
+    /*!
+    ** \brief Load the matrix from the content of a CSV file
+    **
+    ** \param[out] wellFormed False if the content raised a warning or an error (even if
+    **   not reported, see optQuiet and optNeverFails) : the matrix must not be cached
+    */
     bool loadFromBuffer(const AnyString& filename,
                         BufferType& data,
                         uint minWidth,
                         uint maxHeight,
                         const int fixedSize,
-                        uint options);
+                        uint options,
+                        bool& wellFormed);
+
+    /*!
+    ** \brief Load the matrix from its binary cache
+    **
+    ** \return False if the cache file does not exist or is stale
+    */
+    bool loadFromCache(const MatrixCache::Entry& cache);
+
+    /*!
+    ** \brief Store the matrix into its binary cache
+    */
+    void saveToCache(const MatrixCache::Entry& cache) const;
     /*!
     ** \brief Make sure that all JIT Data are loaded into memory
     */
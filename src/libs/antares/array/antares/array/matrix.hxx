@@ -32,7 +32,9 @@
 #include <yuni/core/math.h>
 #include <antares/logs/logs.h>
 #include <utility>
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <antares/io/statistics.h>
 #include "matrix-to-buffer.h"
 
@@ -656,10 +658,13 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
                                            uint minWidth,
                                            uint maxHeight,
                                            const int fixedSize,
-                                           uint options)
+                                           uint options,
+                                           bool& wellFormed)
 {
     using namespace Yuni;
 
+    wellFormed = false;
+
 #ifndef NDEBUG
     logs.debug() << "  :: loading `" << filename << "`";
 #endif
@@ -676,6 +681,7 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
 
     uint offset = (uint)bom;
     uint x = 0;
+    bool validHeader = true;
 
     // Properly resizing the matrix
     // Directly resizing the matrix when its size is well-known
@@ -733,12 +739,14 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
 #endif
             if (x < 1)
             {
+                validHeader = false;
                 if (!(options & optQuiet))
                     logs.warning() << '`' << filename << "`: Invalid header";
                 x = 1;
             }
             if (y < 1)
             {
+                validHeader = false;
                 if (!(options & optQuiet))
                     logs.warning() << '`' << filename << "`: Invalid header";
                 y = maxHeight;
@@ -973,9 +981,69 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
         }
     }
 
+    wellFormed = result and validHeader;
     return ((0 != (options & optNeverFails)) ? true : result);
 }
 
+template<class T, class ReadWriteT>
+bool Matrix<T, ReadWriteT>::loadFromCache(const MatrixCache::Entry& cache)
+{
+    if constexpr (MatrixCache::TypeTag<T, ReadWriteT>() != 0)
+    {
+        std::ifstream file(cache.filename, std::ios::binary);
+        if (not file)
+            return false;
+
+        MatrixCache::Header header;
+        if (not file.read(reinterpret_cast<char*>(&header), sizeof(header))
+            or not MatrixCache::Matches(cache.header, header))
+            return false;
+
+        resize(header.width, header.height, (cache.header.options & optFixedSize));
+        if (width != header.width or height != header.height)
+            return false;
+
+        // Column-major, as `entry`
+        for (uint x = 0; x != width; ++x)
+        {
+            if (not file.read(reinterpret_cast<char*>(entry[x]), sizeof(T) * height))
+                return false;
+        }
+        return true;
+    }
+    else
+        return false;
+}
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::saveToCache(const MatrixCache::Entry& cache) const
+{
+    if constexpr (MatrixCache::TypeTag<T, ReadWriteT>() != 0)
+    {
+        std::string temporaryFilename;
+        if (not MatrixCache::PrepareForWriting(cache, temporaryFilename))
+            return;
+
+        MatrixCache::Header header = cache.header;
+        header.width = width;
+        header.height = height;
+        {
+            std::ofstream file(temporaryFilename, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            for (uint x = 0; x != width; ++x)
+                file.write(reinterpret_cast<const char*>(entry[x]), sizeof(T) * height);
+            if (not file.flush())
+            {
+                file.close();
+                std::remove(temporaryFilename.c_str());
+                return;
+            }
+        }
+        // A failure only means that the next loading will parse the CSV file again
+        MatrixCache::Commit(cache, temporaryFilename);
+    }
+}
+
 template<class T, class ReadWriteT>
 bool Matrix<T, ReadWriteT>::internalLoadCSVFile(const AnyString& filename,
                                                 uint minWidth,
@@ -1011,11 +1079,40 @@ bool Matrix<T, ReadWriteT>::internalLoadCSVFile(const AnyString& filename,
         // IO statistics
         Statistics::HasReadFromDisk(buffer->size());
 
-        // Adding a final \n to make sure we have a line return at the end of the file
-        *buffer += '\n';
-        // Load the data
-        result = loadFromBuffer(
-          filename, *buffer, minWidth, maxHeight, (options & optFixedSize), options);
+        // Binary cache, to avoid parsing the same CSV file again
+        MatrixCache::Entry cache;
+        const bool cached = MatrixCache::Enabled()
+                            and MatrixCache::Prepare(cache,
+                                                     filename,
+                                                     buffer->c_str(),
+                                                     buffer->size(),
+                                                     MatrixCache::TypeTag<T, ReadWriteT>(),
+                                                     options,
+                                                     minWidth,
+                                                     maxHeight);
+
+        if (cached and loadFromCache(cache))
+        {
+            result = true;
+        }
+        else
+        {
+            // Adding a final \n to make sure we have a line return at the end of the file
+            *buffer += '\n';
+            // Load the data
+            bool wellFormed;
+            result = loadFromBuffer(filename,
+                                    *buffer,
+                                    minWidth,
+                                    maxHeight,
+                                    (options & optFixedSize),
+                                    options,
+                                    wellFormed);
+
+            // The warnings of a faulty file would be lost when loading it from the cache
+            if (cached and wellFormed)
+                saveToCache(cache);
+        }
 
         // Mark as modified
         if (0 != (options & optMarkAsModified))
@@ -0,0 +1,173 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "antares/array/matrix-cache.h"
+#include <antares/logs/logs.h>
+#include <cstring>
+#include <filesystem>
+#include <random>
+
+namespace fs = std::filesystem;
+
+namespace Antares
+{
+namespace // anonymous
+{
+constexpr char cacheMagic[8] = {'A', 'N', 'T', 'M', 'C', 'A', 'C', 'H'};
+constexpr uint32_t cacheVersion = 1;
+
+//! Folder of the study whose matrices are cached, empty if disabled
+std::string studyFolder;
+
+int64_t lastModification(const fs::path& filename)
+{
+    std::error_code ec;
+    auto time = fs::last_write_time(filename, ec);
+    return ec ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+}
+} // anonymous namespace
+
+void MatrixCache::Enable(const AnyString& folder)
+{
+    std::error_code ec;
+    auto path = fs::absolute(fs::path(folder.to<std::string>()), ec).lexically_normal();
+    studyFolder = ec ? std::string() : path.string();
+    // Trailing separators are removed, to compare against the path of the CSV files
+    while (studyFolder.size() > 1
+           and (studyFolder.back() == '/' or studyFolder.back() == '\\'))
+        studyFolder.pop_back();
+
+    if (not studyFolder.empty())
+        logs.info() << "  Using the binary cache of the input matrices in "
+                    << (path / folderName).string();
+}
+
+void MatrixCache::Disable()
+{
+    studyFolder.clear();
+}
+
+bool MatrixCache::Enabled()
+{
+    return not studyFolder.empty();
+}
+
+std::string MatrixCache::Folder()
+{
+    return studyFolder.empty() ? std::string() : (fs::path(studyFolder) / folderName).string();
+}
+
+bool MatrixCache::Prepare(Entry& entry,
+                          const AnyString& csvFilename,
+                          const char* data,
+                          size_t size,
+                          uint32_t type,
+                          uint32_t options,
+                          uint32_t minWidth,
+                          uint32_t maxHeight)
+{
+    if (studyFolder.empty() or type == 0)
+        return false;
+
+    std::error_code ec;
+    auto csvPath = fs::absolute(fs::path(csvFilename.to<std::string>()), ec).lexically_normal();
+    if (ec)
+        return false;
+    auto relative = csvPath.lexically_relative(studyFolder);
+    if (relative.empty() or *relative.begin() == ".." or *relative.begin() == folderName)
+        return false;
+
+    entry.filename = (fs::path(studyFolder) / folderName / relative).string() + ".bin";
+
+    Header& header = entry.header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+    header.version = cacheVersion;
+    header.type = type;
+    header.options = options;
+    header.minWidth = minWidth;
+    header.maxHeight = maxHeight;
+    header.csvSize = static_cast<uint64_t>(size);
+    header.csvLastModification = lastModification(csvPath);
+    header.csvHash = Hash(data, size);
+    return true;
+}
+
+bool MatrixCache::Matches(const Header& expected, const Header& cached)
+{
+    // Cheap checks first, the hash guards against changes not seen by the date
+    return not memcmp(expected.magic, cached.magic, sizeof(cacheMagic))
+           and expected.version == cached.version and expected.type == cached.type
+           and expected.options == cached.options and expected.minWidth == cached.minWidth
+           and expected.maxHeight == cached.maxHeight and expected.csvSize == cached.csvSize
+           and expected.csvLastModification == cached.csvLastModification
+           and expected.csvHash == cached.csvHash;
+}
+
+bool MatrixCache::PrepareForWriting(const Entry& entry, std::string& temporaryFilename)
+{
+    std::error_code ec;
+    fs::create_directories(fs::path(entry.filename).parent_path(), ec);
+    if (ec)
+        return false;
+
+    // Unique name, several processes may work on the same study
+    static thread_local std::mt19937_64 generator{std::random_device{}()};
+    temporaryFilename = entry.filename + '.' + std::to_string(generator()) + ".tmp";
+    return true;
+}
+
+bool MatrixCache::Commit(const Entry& entry, const std::string& temporaryFilename)
+{
+    std::error_code ec;
+    fs::rename(temporaryFilename, entry.filename, ec);
+    if (ec)
+    {
+        fs::remove(temporaryFilename, ec);
+        return false;
+    }
+    return true;
+}
+
+uint64_t MatrixCache::Hash(const char* data, size_t size)
+{
+    // FNV-1a, 8 bytes at a time
+    constexpr uint64_t prime = 0x100000001b3ULL;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; ++i)
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * prime;
+    return hash;
+}
+
+} // namespace Antares
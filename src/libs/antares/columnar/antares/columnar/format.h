@@ -0,0 +1,114 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#pragma once
+
+#include <cstdint>
+
+/*!
+** \brief Layout of the columnar result files (.bin)
+**
+** A columnar file holds the same report as a txt result file, column by column :
+**
+** - a header (FileHeader),
+** - the string table : the end offsets of the strings (uint64), followed by the characters,
+**   each string being followed by a zero. The captions, units, statistics, printf formats and
+**   labels of the index columns are all stored once in this table (string 0 is empty),
+** - the column directory (ColumnHeader), the index columns first (index, day, month...),
+** - the data of the columns, each block being aligned on 8 bytes.
+**
+** Numbers are stored in the byte order of the machine which wrote the file (see byteOrderMark)
+** and the data of the plain columns can be used in place once the file is mapped in memory.
+*/
+namespace Antares::Columnar
+{
+constexpr char magic[8] = {'A', 'N', 'T', 'C', 'O', 'L', 'S', '\0'};
+constexpr uint32_t version = 1;
+constexpr uint32_t byteOrderMark = 0x01020304;
+
+//! Encoding of the data of a column
+enum class Encoding : uint8_t
+{
+    //! One double per row
+    plain = 0,
+    //! A single double, for all rows
+    constant,
+    //! No data, the values are not applicable ("N/A")
+    notApplicable,
+    //! One uint32 per row, index in the string table (index columns)
+    dictionary
+};
+
+//! Fields of the title of a report (first lines of the txt files)
+enum TitleField
+{
+    //! Name of the area, "system" for the whole system
+    titleElement = 0,
+    //! "area", "link", "thermal"...
+    titleDataLevel,
+    //! "va", "id", "de"...
+    titleFileLevel,
+    //! "hourly", "daily"...
+    titleTimeLevel,
+    //! Other end of the link, empty for the other reports
+    titleLinkedElement,
+    titleFieldCount
+};
+
+struct FileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint32_t rowCount;
+    //! Number of the first row (one-based, as the "BEGIN" field of the txt files)
+    uint32_t firstRow;
+    uint32_t indexColumnCount;
+    uint32_t valueColumnCount;
+    //! Title of the report (indexes in the string table)
+    uint32_t title[titleFieldCount];
+    uint32_t stringCount;
+    uint64_t stringsOffset;
+    uint64_t columnsOffset;
+};
+
+struct ColumnHeader
+{
+    //! Caption, unit, statistic and printf format (indexes in the string table)
+    uint32_t name;
+    uint32_t unit;
+    uint32_t stat;
+    uint32_t format;
+    Encoding encoding;
+    uint8_t reserved[7];
+    //! Position and size of the data, in bytes
+    uint64_t offset;
+    uint64_t size;
+};
+
+static_assert(sizeof(FileHeader) == 72, "Unexpected padding");
+static_assert(sizeof(ColumnHeader) == 40, "Unexpected padding");
+} // namespace Antares::Columnar
@@ -0,0 +1,137 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "format.h"
+
+namespace Antares::Columnar
+{
+/*!
+** \brief Write a value as in the txt files ("0", "12.50", "NaN"...)
+**
+** The text is zero-terminated, "ERR" if it does not fit into the buffer (at least 5 bytes).
+** \return The length of the text
+*/
+size_t formatValue(char* buffer, size_t size, double value, const char* format);
+
+/*!
+** \brief Read a columnar result file
+**
+** The file is mapped in memory and checked once when it is opened, nothing is copied : the
+** strings and the plain columns point into the mapping, and remain valid until the file is
+** closed.
+*/
+class Reader
+{
+public:
+    Reader() = default;
+    ~Reader();
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    //! Map a file in memory, false if it can not be read or is not a valid columnar file
+    bool open(const std::string& filename);
+    //! Read a file already in memory (aligned on 8 bytes), which is not copied
+    bool assign(const char* data, size_t size);
+    void close();
+
+    uint32_t rowCount() const
+    {
+        return header().rowCount;
+    }
+    uint32_t firstRow() const
+    {
+        return header().firstRow;
+    }
+    uint32_t indexColumnCount() const
+    {
+        return header().indexColumnCount;
+    }
+    uint32_t valueColumnCount() const
+    {
+        return header().valueColumnCount;
+    }
+
+    std::string_view title(TitleField field) const
+    {
+        return string(header().title[field]);
+    }
+
+    //! \name Index columns
+    //@{
+    std::string_view indexName(uint32_t column) const;
+    std::string_view label(uint32_t column, uint32_t row) const;
+    //@}
+
+    //! \name Value columns
+    //@{
+    std::string_view name(uint32_t column) const;
+    std::string_view unit(uint32_t column) const;
+    std::string_view stat(uint32_t column) const;
+    //! The printf format of the values (the string is zero-terminated)
+    std::string_view format(uint32_t column) const;
+    Encoding encoding(uint32_t column) const;
+    //! The column named `name`, case-insensitive, -1 if there is none
+    int find(std::string_view name) const;
+
+    //! A value, 0 when it is not applicable
+    double value(uint32_t column, uint32_t row) const;
+    //! All the values of a plain column, nullptr for the other encodings
+    const double* values(uint32_t column) const;
+    //! Append a value as it is written in the txt files ("N/A", "0", "12.50"...)
+    void appendValue(std::string& output, uint32_t column, uint32_t row) const;
+    //@}
+
+    //! Append the report, as it is written in the txt files
+    void appendText(std::string& output) const;
+
+private:
+    bool check() const;
+    const FileHeader& header() const
+    {
+        return *reinterpret_cast<const FileHeader*>(data_);
+    }
+    const ColumnHeader& column(uint32_t index) const
+    {
+        return reinterpret_cast<const ColumnHeader*>(data_ + header().columnsOffset)[index];
+    }
+    const ColumnHeader& valueColumn(uint32_t index) const
+    {
+        return column(header().indexColumnCount + index);
+    }
+    std::string_view string(uint32_t index) const;
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    //! True if data_ is a mapping made by open()
+    bool mapped_ = false;
+};
+} // namespace Antares::Columnar
@@ -0,0 +1,91 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "format.h"
+
+namespace Antares::Columnar
+{
+/*!
+** \brief Build a columnar result file in memory
+**
+** The index columns are given label by label, row after row. The values of a column are
+** only read when the file is built : they must remain valid until `finish()`.
+*/
+class Writer
+{
+public:
+    Writer(uint32_t firstRow, uint32_t rowCount);
+
+    void setTitle(TitleField field, std::string_view text);
+
+    //! Add an index column (e.g. "index", "day", "month"), returns its index
+    uint32_t addIndexColumn(std::string_view name);
+    //! Add the label of the next row of an index column
+    void addLabel(uint32_t indexColumn, std::string_view label);
+
+    /*!
+    ** \brief Add a column of values
+    **
+    ** \param format        The printf format used to write the values as text (e.g. "%.2f")
+    ** \param values        The values of the rows (rowCount values)
+    ** \param notApplicable True if the values are not applicable ("N/A")
+    */
+    void addValueColumn(std::string_view name,
+                        std::string_view unit,
+                        std::string_view stat,
+                        std::string_view format,
+                        const double* values,
+                        bool notApplicable);
+
+    //! Append the file to a buffer
+    void finish(std::string& output);
+
+private:
+    uint32_t intern(std::string_view text);
+
+    struct Column
+    {
+        ColumnHeader header{};
+        const double* values = nullptr;
+        std::vector<uint32_t> labels;
+    };
+
+    FileHeader header_;
+    std::vector<Column> indexColumns_;
+    std::vector<Column> valueColumns_;
+    std::vector<std::string> strings_;
+    std::unordered_map<std::string, uint32_t> stringIds_;
+    //! Temporary used for the lookups
+    std::string key_;
+};
+} // namespace Antares::Columnar
@@ -0,0 +1,430 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "antares/columnar/reader.h"
+#include <yuni/yuni.h>
+#include <yuni/core/math.h>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#ifdef YUNI_OS_WINDOWS
+#include <yuni/core/system/windows.hdr.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Yuni;
+
+namespace Antares::Columnar
+{
+namespace
+{
+template<class T>
+T load(const char* p)
+{
+    T value;
+    memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+//! "%.Nf", the only formats used by the reports
+bool isValueFormat(std::string_view format)
+{
+    if (format.size() < 4 || format.size() > 5 || format[0] != '%' || format[1] != '.'
+        || format.back() != 'f')
+        return false;
+    for (size_t i = 2; i + 1 < format.size(); ++i)
+    {
+        if (format[i] < '0' || format[i] > '9')
+            return false;
+    }
+    return true;
+}
+
+bool equalsIgnoringCase(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i != a.size(); ++i)
+    {
+        if (tolower((unsigned char)a[i]) != tolower((unsigned char)b[i]))
+            return false;
+    }
+    return true;
+}
+
+//! The content of a file, mapped in memory (nullptr on failure)
+const char* mapFile(const std::string& filename, size_t& size)
+{
+#ifdef YUNI_OS_WINDOWS
+    int length = MultiByteToWideChar(CP_UTF8, 0, filename.c_str(), -1, nullptr, 0);
+    if (length <= 0)
+        return nullptr;
+    std::wstring wfilename(length, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, filename.c_str(), -1, wfilename.data(), length);
+
+    HANDLE file = CreateFileW(wfilename.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+    LARGE_INTEGER fileSize;
+    const char* data = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+        {
+            data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            size = (size_t)fileSize.QuadPart;
+            // The view keeps the mapping alive
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+    return data;
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+    struct stat status;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &status) == 0 && status.st_size > 0)
+    {
+        size = (size_t)status.st_size;
+        data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // The mapping remains valid once the file is closed
+    ::close(fd);
+    return data == MAP_FAILED ? nullptr : static_cast<const char*>(data);
+#endif
+}
+
+void unmapFile(const char* data, size_t size)
+{
+#ifdef YUNI_OS_WINDOWS
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<char*>(data), size);
+#endif
+}
+} // namespace
+
+size_t formatValue(char* buffer, size_t size, double value, const char* format)
+{
+    assert(size >= 5);
+    const char* text = "ERR";
+    if (Math::Zero(value))
+        text = "0";
+    else if (Math::NaN(value))
+        text = "NaN";
+    else if (Math::Infinite(value))
+        text = (value > 0) ? "+inf" : "-inf";
+    else
+    {
+        const int length = snprintf(buffer, size, format, value);
+        if (length >= 0 && (size_t)length < size)
+            return (size_t)length;
+    }
+    const size_t length = strlen(text);
+    memcpy(buffer, text, length + 1);
+    return length;
+}
+
+Reader::~Reader()
+{
+    close();
+}
+
+bool Reader::open(const std::string& filename)
+{
+    close();
+    size_t size = 0;
+    const char* data = mapFile(filename, size);
+    if (!data)
+        return false;
+    if (!assign(data, size))
+    {
+        unmapFile(data, size);
+        return false;
+    }
+    mapped_ = true;
+    return true;
+}
+
+bool Reader::assign(const char* data, size_t size)
+{
+    close();
+    data_ = data;
+    size_ = size;
+    if (check())
+        return true;
+    data_ = nullptr;
+    size_ = 0;
+    return false;
+}
+
+void Reader::close()
+{
+    if (mapped_)
+        unmapFile(data_, size_);
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+}
+
+bool Reader::check() const
+{
+    // The whole file is checked once, so that the accessors do not have to
+    if (!data_ || reinterpret_cast<uintptr_t>(data_) % 8 != 0 || size_ < sizeof(FileHeader))
+        return false;
+    const FileHeader& h = header();
+    if (memcmp(h.magic, magic, sizeof(magic)) != 0 || h.version != version
+        || h.byteOrderMark != byteOrderMark)
+        return false;
+
+    // Strings
+    if (h.stringCount == 0 || h.stringsOffset % 8 != 0 || h.stringsOffset > size_
+        || (size_ - h.stringsOffset) / sizeof(uint64_t) < h.stringCount)
+        return false;
+    const char* ends = data_ + h.stringsOffset;
+    const uint64_t charsOffset = h.stringsOffset + sizeof(uint64_t) * (uint64_t)h.stringCount;
+    uint64_t begin = 0;
+    for (uint32_t i = 0; i != h.stringCount; ++i)
+    {
+        const auto end = load<uint64_t>(ends + sizeof(uint64_t) * i);
+        if (end <= begin || end > size_ - charsOffset || data_[charsOffset + end - 1] != '\0')
+            return false;
+        begin = end;
+    }
+    for (uint32_t field : h.title)
+    {
+        if (field >= h.stringCount)
+            return false;
+    }
+
+    // Columns
+    const uint64_t columnCount = (uint64_t)h.indexColumnCount + h.valueColumnCount;
+    if (h.columnsOffset % 8 != 0 || h.columnsOffset > size_
+        || (size_ - h.columnsOffset) / sizeof(ColumnHeader) < columnCount)
+        return false;
+    for (uint64_t i = 0; i != columnCount; ++i)
+    {
+        const ColumnHeader& c = column((uint32_t)i);
+        if (c.name >= h.stringCount || c.unit >= h.stringCount || c.stat >= h.stringCount
+            || c.format >= h.stringCount || c.offset % 8 != 0 || c.offset > size_
+            || c.size > size_ - c.offset)
+            return false;
+
+        uint64_t expectedSize = 0;
+        if (i < h.indexColumnCount)
+        {
+            if (c.encoding != Encoding::dictionary)
+                return false;
+            expectedSize = sizeof(uint32_t) * (uint64_t)h.rowCount;
+        }
+        else
+        {
+            switch (c.encoding)
+            {
+            case Encoding::plain:
+                expectedSize = sizeof(double) * (uint64_t)h.rowCount;
+                break;
+            case Encoding::constant:
+                expectedSize = sizeof(double);
+                break;
+            case Encoding::notApplicable:
+                break;
+            default:
+                return false;
+            }
+            // The format is given to snprintf()
+            if (!isValueFormat(string(c.format)))
+                return false;
+        }
+        if (c.size != expectedSize)
+            return false;
+
+        if (c.encoding == Encoding::dictionary)
+        {
+            for (uint32_t row = 0; row != h.rowCount; ++row)
+            {
+                if (load<uint32_t>(data_ + c.offset + sizeof(uint32_t) * row) >= h.stringCount)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::string_view Reader::string(uint32_t index) const
+{
+    const FileHeader& h = header();
+    const char* ends = data_ + h.stringsOffset;
+    const char* chars = ends + sizeof(uint64_t) * (uint64_t)h.stringCount;
+    const uint64_t begin = index == 0 ? 0 : load<uint64_t>(ends + sizeof(uint64_t) * (index - 1));
+    const uint64_t end = load<uint64_t>(ends + sizeof(uint64_t) * index);
+    return std::string_view(chars + begin, end - begin - 1);
+}
+
+std::string_view Reader::indexName(uint32_t index) const
+{
+    return string(column(index).name);
+}
+
+std::string_view Reader::label(uint32_t index, uint32_t row) const
+{
+    const ColumnHeader& c = column(index);
+    return string(load<uint32_t>(data_ + c.offset + sizeof(uint32_t) * row));
+}
+
+std::string_view Reader::name(uint32_t index) const
+{
+    return string(valueColumn(index).name);
+}
+
+std::string_view Reader::unit(uint32_t index) const
+{
+    return string(valueColumn(index).unit);
+}
+
+std::string_view Reader::stat(uint32_t index) const
+{
+    return string(valueColumn(index).stat);
+}
+
+std::string_view Reader::format(uint32_t index) const
+{
+    return string(valueColumn(index).format);
+}
+
+Encoding Reader::encoding(uint32_t index) const
+{
+    return valueColumn(index).encoding;
+}
+
+int Reader::find(std::string_view text) const
+{
+    for (uint32_t i = 0; i != valueColumnCount(); ++i)
+    {
+        if (equalsIgnoringCase(name(i), text))
+            return (int)i;
+    }
+    return -1;
+}
+
+double Reader::value(uint32_t index, uint32_t row) const
+{
+    const ColumnHeader& c = valueColumn(index);
+    switch (c.encoding)
+    {
+    case Encoding::plain:
+        return load<double>(data_ + c.offset + sizeof(double) * row);
+    case Encoding::constant:
+        return load<double>(data_ + c.offset);
+    default:
+        return 0.;
+    }
+}
+
+const double* Reader::values(uint32_t index) const
+{
+    const ColumnHeader& c = valueColumn(index);
+    if (c.encoding != Encoding::plain)
+        return nullptr;
+    return reinterpret_cast<const double*>(data_ + c.offset);
+}
+
+void Reader::appendValue(std::string& output, uint32_t index, uint32_t row) const
+{
+    // Same text as in the txt files
+    if (encoding(index) == Encoding::notApplicable)
+    {
+        output.append("N/A", 3);
+        return;
+    }
+    char buffer[512];
+    const size_t length
+      = formatValue(buffer, sizeof(buffer), value(index, row), format(index).data());
+    output.append(buffer, length);
+}
+
+void Reader::appendText(std::string& output) const
+{
+    const uint32_t indexCount = indexColumnCount();
+    const uint32_t valueCount = valueColumnCount();
+    const uint32_t rows = rowCount();
+
+    output.reserve(output.size() + (size_t)(rows + 8) * (32 + 12 * (size_t)valueCount));
+
+    // Big header
+    output.append(title(titleElement)).append(1, '\t');
+    output.append(title(titleDataLevel)).append(1, '\t');
+    output.append(title(titleFileLevel)).append(1, '\t');
+    output.append(title(titleTimeLevel)).append(1, '\n');
+    output.append(title(titleLinkedElement)).append("\tVARIABLES\tBEGIN\tEND\n");
+    output.append(1, '\t').append(std::to_string(valueCount));
+    output.append(1, '\t').append(std::to_string(firstRow()));
+    output.append(1, '\t').append(std::to_string(firstRow() + rows - 1)).append("\n\n");
+
+    // Captions, units and statistics
+    output.append(title(titleElement)).append(1, '\t').append(title(titleTimeLevel));
+    output.append(indexCount != 0 ? indexCount - 1 : 0, '\t');
+    for (uint32_t x = 0; x != valueCount; ++x)
+        output.append(1, '\t').append(name(x));
+    output += '\n';
+    output.append(indexCount, '\t');
+    for (uint32_t x = 0; x != valueCount; ++x)
+        output.append(1, '\t').append(unit(x));
+    output += '\n';
+    for (uint32_t x = 0; x != indexCount; ++x)
+        output.append(1, '\t').append(indexName(x));
+    for (uint32_t x = 0; x != valueCount; ++x)
+        output.append(1, '\t').append(stat(x));
+    output += '\n';
+
+    for (uint32_t y = 0; y != rows; ++y)
+    {
+        for (uint32_t x = 0; x != indexCount; ++x)
+            output.append(1, '\t').append(label(x, y));
+        for (uint32_t x = 0; x != valueCount; ++x)
+        {
+            output += '\t';
+            appendValue(output, x, y);
+        }
+        output += '\n';
+    }
+}
+} // namespace Antares::Columnar
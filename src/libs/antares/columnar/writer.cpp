@@ -0,0 +1,191 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "antares/columnar/writer.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace Antares::Columnar
+{
+namespace
+{
+template<class T>
+void append(std::string& output, const T& value)
+{
+    output.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void alignTo8(std::string& output, size_t start)
+{
+    output.resize(start + ((output.size() - start + 7) & ~size_t(7)), '\0');
+}
+} // namespace
+
+Writer::Writer(uint32_t firstRow, uint32_t rowCount) : header_()
+{
+    memcpy(header_.magic, magic, sizeof(magic));
+    header_.version = version;
+    header_.byteOrderMark = byteOrderMark;
+    header_.rowCount = rowCount;
+    header_.firstRow = firstRow;
+    intern(""); // string 0
+}
+
+uint32_t Writer::intern(std::string_view text)
+{
+    key_.assign(text.data(), text.size());
+    auto it = stringIds_.find(key_);
+    if (it != stringIds_.end())
+        return it->second;
+
+    const auto id = static_cast<uint32_t>(strings_.size());
+    strings_.push_back(key_);
+    stringIds_.emplace(key_, id);
+    return id;
+}
+
+void Writer::setTitle(TitleField field, std::string_view text)
+{
+    header_.title[field] = intern(text);
+}
+
+uint32_t Writer::addIndexColumn(std::string_view name)
+{
+    Column& column = indexColumns_.emplace_back();
+    column.header.name = intern(name);
+    column.header.encoding = Encoding::dictionary;
+    column.labels.reserve(header_.rowCount);
+    return static_cast<uint32_t>(indexColumns_.size() - 1);
+}
+
+void Writer::addLabel(uint32_t indexColumn, std::string_view label)
+{
+    assert(indexColumns_[indexColumn].labels.size() < header_.rowCount);
+    indexColumns_[indexColumn].labels.push_back(intern(label));
+}
+
+void Writer::addValueColumn(std::string_view name,
+                            std::string_view unit,
+                            std::string_view stat,
+                            std::string_view format,
+                            const double* values,
+                            bool notApplicable)
+{
+    Column& column = valueColumns_.emplace_back();
+    column.header.name = intern(name);
+    column.header.unit = intern(unit);
+    column.header.stat = intern(stat);
+    column.header.format = intern(format);
+    column.values = values;
+
+    const uint32_t rowCount = header_.rowCount;
+    if (notApplicable)
+        column.header.encoding = Encoding::notApplicable;
+    else if (rowCount != 0
+             && std::all_of(values + 1, values + rowCount, [values](const double& value) {
+                    return memcmp(&value, values, sizeof(double)) == 0;
+                }))
+        column.header.encoding = Encoding::constant; // e.g. all zero
+    else
+        column.header.encoding = Encoding::plain;
+}
+
+void Writer::finish(std::string& output)
+{
+    const size_t start = output.size();
+    const uint32_t rowCount = header_.rowCount;
+
+    header_.indexColumnCount = static_cast<uint32_t>(indexColumns_.size());
+    header_.valueColumnCount = static_cast<uint32_t>(valueColumns_.size());
+    header_.stringCount = static_cast<uint32_t>(strings_.size());
+    header_.stringsOffset = sizeof(FileHeader);
+
+    size_t size = sizeof(FileHeader) + sizeof(uint64_t) * strings_.size();
+    for (auto& text : strings_)
+        size += text.size() + 1;
+    header_.columnsOffset = (size + 7) & ~size_t(7);
+
+    // The data of the columns follows the directory
+    uint64_t offset = header_.columnsOffset
+                      + sizeof(ColumnHeader) * (indexColumns_.size() + valueColumns_.size());
+    auto place = [&offset](Column& column, uint64_t size) {
+        column.header.offset = offset;
+        column.header.size = size;
+        offset += (size + 7) & ~uint64_t(7);
+    };
+    for (auto& column : indexColumns_)
+    {
+        assert(column.labels.size() == rowCount && "missing labels");
+        column.labels.resize(rowCount, 0);
+        place(column, sizeof(uint32_t) * (uint64_t)rowCount);
+    }
+    for (auto& column : valueColumns_)
+    {
+        switch (column.header.encoding)
+        {
+        case Encoding::plain:
+            place(column, sizeof(double) * (uint64_t)rowCount);
+            break;
+        case Encoding::constant:
+            place(column, sizeof(double));
+            break;
+        default:
+            place(column, 0);
+            break;
+        }
+    }
+
+    output.reserve(start + offset);
+    append(output, header_);
+
+    uint64_t end = 0;
+    for (auto& text : strings_)
+    {
+        end += text.size() + 1;
+        append(output, end);
+    }
+    for (auto& text : strings_)
+        output.append(text.c_str(), text.size() + 1);
+    alignTo8(output, start);
+
+    for (auto& column : indexColumns_)
+        append(output, column.header);
+    for (auto& column : valueColumns_)
+        append(output, column.header);
+
+    for (auto& column : indexColumns_)
+    {
+        output.append(reinterpret_cast<const char*>(column.labels.data()), column.header.size);
+        alignTo8(output, start);
+    }
+    for (auto& column : valueColumns_)
+        output.append(reinterpret_cast<const char*>(column.values), column.header.size);
+
+    assert(output.size() - start == offset);
+}
+} // namespace Antares::Columnar
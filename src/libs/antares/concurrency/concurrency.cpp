@@ -24,6 +24,9 @@
 **
 ** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
 */
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include "yuni/job/job.h"
 #include "antares/concurrency/concurrency.h"
@@ -53,6 +56,91 @@ private:
     std::packaged_task<void()> task_;
 };
 
+/*!
+* Indices still to process by ForEachIndex. It is shared with the jobs of the pool, which may
+* start after all the indices are processed.
+*/
+class IndexedWork {
+public:
+    IndexedWork(unsigned int count, const IndexedTask& task) :
+        count_(count), task_(task), errors_(count)
+    {
+    }
+
+    // Processes indices until there is none left
+    void run() {
+        for (unsigned int i = next_++; i < count_; i = next_++) {
+            try {
+                task_(i);
+            } catch (...) {
+                errors_[i] = std::current_exception();
+            }
+
+            std::lock_guard lock(mutex_);
+            if (++done_ == count_) {
+                allDone_.notify_all();
+            }
+        }
+    }
+
+    void wait() {
+        std::unique_lock lock(mutex_);
+        allDone_.wait(lock, [this]() { return done_ == count_; });
+    }
+
+    void rethrowFirstError() const {
+        for (const auto& error: errors_) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+private:
+    const unsigned int count_;
+    const IndexedTask task_;
+    std::vector<std::exception_ptr> errors_;
+    std::atomic<unsigned int> next_ = 0;
+    unsigned int done_ = 0;
+    std::mutex mutex_;
+    std::condition_variable allDone_;
+};
+
+/*!
+* A job of the pool taking part in a ForEachIndex.
+*/
+class IndexedJob : public Yuni::Job::IJob {
+public:
+    explicit IndexedJob(std::shared_ptr<IndexedWork> work) : work_(std::move(work)) {}
+
+protected:
+    void onExecute() override {
+        work_->run();
+    }
+
+private:
+    std::shared_ptr<IndexedWork> work_;
+};
+
+}
+
+void ForEachIndex(Yuni::Job::QueueService& threadPool,
+                  unsigned int count,
+                  const IndexedTask& task) {
+    if (count == 0) {
+        return;
+    }
+
+    auto work = std::make_shared<IndexedWork>(count, task);
+    // The calling thread processes indices too : one job less
+    const unsigned int jobCount = std::min(threadPool.maximumThreadCount(), count - 1);
+    for (unsigned int j = 0; j != jobCount; ++j) {
+        threadPool.add(new IndexedJob(work));
+    }
+
+    work->run();
+    work->wait();
+    work->rethrowFirstError();
 }
 
 std::future<void> AddTask(Yuni::Job::QueueService& threadPool,
@@ -27,6 +27,7 @@
 #ifndef ANTARES_CONCURRENCY_H
 #define ANTARES_CONCURRENCY_H
 
+#include <functional>
 #include <future>
 #include "yuni/job/queue/service.h"
 
@@ -59,6 +60,20 @@ template <class T>
                                  const std::shared_ptr<T>& task,
                                  Yuni::Job::Priority priority = Yuni::Job::priorityDefault);
 
+using IndexedTask = std::function<void(unsigned int)>;
+
+/*!
+ * \brief Runs task(i) for each index i in [0, count), on the calling thread and on the
+ * threads of the pool.
+ *
+ * The indices are handed out on demand, and the calling thread takes its share of them :
+ * the work goes on even when all the threads of the pool are busy with other jobs, and the
+ * caller never waits for a job of the pool which has not started yet.
+ * All the indices are processed when returning. If some of them end on exception, the
+ * exception of the lowest index is re-thrown.
+ */
+void ForEachIndex(Yuni::Job::QueueService& threadPool, unsigned int count, const IndexedTask& task);
+
 /*!
  * \brief Utility class to gather futures to wait for.
  */
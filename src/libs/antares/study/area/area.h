@@ -440,10 +440,13 @@ public:
     /*!
     ** \brief Load all informations about areas from a folder (-> input/generalData)
     **
-    ** \param l The list of areas
-    ** \param folder The target folder
+    ** Data specific to each area are read by `nbThreads` threads, the results do not
+    ** depend on this number.
+    **
+    ** \param options  Options for loading the study
+    ** \param nbThreads The number of areas that can be loaded at the same time
     */
-    bool loadFromFolder(const StudyLoadOptions& options);
+    bool loadFromFolder(const StudyLoadOptions& options, uint nbThreads = 1);
 
     /*!
     ** \brief Fill the list of areas from an input file
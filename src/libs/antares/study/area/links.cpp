@@ -416,14 +416,14 @@ bool AreaLinksInternalLoadFromProperty(AreaLink& link, const String& key, const
     return false;
 }
 
-void logLinkDataCheckError(bool& gotFatalError, const AreaLink& link, const String& msg, int hour)
+void logLinkDataCheckError(std::atomic<bool>& gotFatalError, const AreaLink& link, const String& msg, int hour)
 {
     logs.error() << "Link (" << link.from->name << "/" << link.with->name << "): Invalid values ("
                  << msg << ") for hour " << hour;
     gotFatalError = true;
 }
 
-void logLinkDataCheckErrorDirectIndirect(bool& gotFatalError,
+void logLinkDataCheckErrorDirectIndirect(std::atomic<bool>& gotFatalError,
                                          const AreaLink& link,
                                          uint direct,
                                          uint indirect)
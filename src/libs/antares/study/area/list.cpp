@@ -35,6 +35,10 @@
 #include "constants.h"
 #include "antares/study/parts/parts.h"
 #include "antares/study/parts/load/prepro.h"
+#include <antares/benchmarking/timer.h>
+#include <antares/concurrency/concurrency.h>
+#include <memory>
+#include <vector>
 
 #define SEP IO::Separator
 
@@ -1062,7 +1066,55 @@ void AreaList::ensureDataIsInitialized(Parameters& params, bool loadOnlyNeeded)
     AreaListEnsureDataThermalPrepro(this);
 }
 
-bool AreaList::loadFromFolder(const StudyLoadOptions& options)
+namespace // anonymous
+{
+// Call `load` for each area, using the jobs of the queue if any.
+// The results are merged in the order of the areas, and if some of them have thrown
+// an exception, the one of the first area is re-thrown : the outcome doesn't depend
+// on the order in which the areas were actually loaded.
+template<class LoadT>
+bool loadEachArea(AreaList& list, Yuni::Job::QueueService* queueService, const LoadT& load)
+{
+    std::vector<Area*> areas;
+    areas.reserve(list.size());
+    list.each([&areas](Area& area) { areas.push_back(&area); });
+
+    bool ret = true;
+    if (!queueService)
+    {
+        for (uint i = 0; i != areas.size(); ++i)
+            ret = load(*areas[i], i) && ret;
+        return ret;
+    }
+
+    std::vector<char> results(areas.size(), true);
+    std::vector<Concurrency::TaskFuture> tasks;
+    tasks.reserve(areas.size());
+    for (uint i = 0; i != areas.size(); ++i)
+    {
+        tasks.push_back(Concurrency::AddTask(
+          *queueService, [&areas, &results, &load, i]() { results[i] = load(*areas[i], i); }));
+    }
+
+    // All tasks must be over before leaving, since they refer to local data
+    for (auto& task : tasks)
+        task.wait();
+    for (uint i = 0; i != areas.size(); ++i)
+    {
+        tasks[i].get();
+        ret = results[i] && ret;
+    }
+    return ret;
+}
+
+void logLoadingTime(const char* phase, Benchmarking::Timer& timer)
+{
+    timer.stop();
+    logs.info() << "  " << phase << " loaded in " << timer.get_duration() << " ms";
+}
+} // anonymous namespace
+
+bool AreaList::loadFromFolder(const StudyLoadOptions& options, uint nbThreads)
 {
     bool ret = true;
     Clob buffer;
@@ -1075,6 +1127,16 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
         ret = loadListFromFile(buffer) && ret;
     }
 
+    // Areas are loaded in parallel if several threads are allowed
+    std::unique_ptr<Yuni::Job::QueueService> queueService;
+    if (nbThreads > 1 && areas.size() > 1)
+    {
+        logs.info() << "Loading the areas using " << nbThreads << " threads";
+        queueService = std::make_unique<Yuni::Job::QueueService>();
+        queueService->maximumThreadCount(nbThreads);
+        queueService->start();
+    }
+
     // Hydro
     {
         logs.info() << "Loading global hydro data...";
@@ -1085,6 +1147,7 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
     // Thermal data, specific to areas
     {
         logs.info() << "Loading thermal clusters...";
+        Benchmarking::Timer timer;
         buffer.clear() << pStudy.folderInput << SEP << "thermal" << SEP << "areas.ini";
         ret = AreaListLoadThermalDataFromFile(*this, buffer) && ret;
 
@@ -1094,14 +1157,19 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
         CString<30, false> thermalPlant;
         thermalPlant << SEP << "thermal" << SEP << "clusters" << SEP;
 
-        auto end = areas.end();
-        for (auto i = areas.begin(); i != end; ++i)
-        {
-            Area& area = *(i->second);
-            buffer.clear() << pStudy.folderInput << thermalPlant << area.id;
-            ret = area.thermal.list.loadFromFolder(pStudy, buffer.c_str(), &area) && ret;
-            area.thermal.prepareAreaWideIndexes();
-        }
+        ret = loadEachArea(*this,
+                           queueService.get(),
+                           [&](Area& area, uint)
+                           {
+                               Clob folder;
+                               folder << pStudy.folderInput << thermalPlant << area.id;
+                               bool r = area.thermal.list.loadFromFolder(
+                                 pStudy, folder.c_str(), &area);
+                               area.thermal.prepareAreaWideIndexes();
+                               return r;
+                           })
+              && ret;
+        logLoadingTime("Thermal clusters", timer);
     }
 
     // Short term storage data, specific to areas
@@ -1112,12 +1180,19 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
 
         if (IO::Directory::Exists(buffer))
         {
-            for (const auto& [id, area] : areas)
-            {
-                buffer.clear() << pStudy.folderInput << SEP << "st-storage" << SEP << "clusters" << SEP << area->id;
-                ret = area->shortTermStorage.createSTStorageClustersFromIniFile(buffer.c_str())
-                      && ret;
-            }
+            Benchmarking::Timer timer;
+            ret = loadEachArea(*this,
+                               queueService.get(),
+                               [&](Area& area, uint)
+                               {
+                                   Clob folder;
+                                   folder << pStudy.folderInput << SEP << "st-storage" << SEP
+                                          << "clusters" << SEP << area.id;
+                                   return area.shortTermStorage.createSTStorageClustersFromIniFile(
+                                     folder.c_str());
+                               })
+                  && ret;
+            logLoadingTime("Short term storage clusters", timer);
         }
         else
         {
@@ -1131,33 +1206,53 @@ bool AreaList::loadFromFolder(const StudyLoadOptions& options)
         // The cluster list must be loaded before the method
         // ensureDataIsInitialized is called
         // in order to allocate data with all renewable clusters.
+        Benchmarking::Timer timer;
         CString<30, false> renewablePlant;
         renewablePlant << SEP << "renewables" << SEP << "clusters" << SEP;
 
-        auto end = areas.end();
-        for (auto i = areas.begin(); i != end; ++i)
-        {
-            Area& area = *(i->second);
-            buffer.clear() << pStudy.folderInput << renewablePlant << area.id;
-            ret = area.renewable.list.loadFromFolder(buffer.c_str(), &area) && ret;
-            area.renewable.prepareAreaWideIndexes();
-        }
+        ret = loadEachArea(*this,
+                           queueService.get(),
+                           [&](Area& area, uint)
+                           {
+                               Clob folder;
+                               folder << pStudy.folderInput << renewablePlant << area.id;
+                               bool r = area.renewable.list.loadFromFolder(folder.c_str(), &area);
+                               area.renewable.prepareAreaWideIndexes();
+                               return r;
+                           })
+              && ret;
+        logLoadingTime("Renewable clusters", timer);
     }
 
     // Prepare
     ensureDataIsInitialized(pStudy.parameters, options.loadOnlyNeeded);
 
     // Load all nodes
-    uint indx = 0;
-    each([&](Data::Area& area) {
-        // Progression
-        options.logMessage.clear()
-          << "Loading the area " << (++indx) << '/' << areas.size() << ": " << area.name;
-        logs.info() << options.logMessage;
+    {
+        Benchmarking::Timer timer;
+        const auto nbAreas = areas.size();
+        ret = loadEachArea(*this,
+                           queueService.get(),
+                           [&](Area& area, uint index)
+                           {
+                               // Each area has its own progression
+                               StudyLoadOptions areaOptions = options;
+                               areaOptions.logMessage.clear() << "Loading the area " << (index + 1)
+                                                              << '/' << nbAreas << ": "
+                                                              << area.name;
+                               logs.info() << areaOptions.logMessage;
+
+                               // Load a single area
+                               Clob areaBuffer;
+                               return AreaListLoadFromFolderSingleArea(
+                                 pStudy, this, area, areaBuffer, areaOptions);
+                           })
+              && ret;
+        logLoadingTime("Areas", timer);
+    }
 
-        // Load a single area
-        ret = AreaListLoadFromFolderSingleArea(pStudy, this, area, buffer, options) && ret;
-    });
+    if (queueService)
+        queueService->stop();
 
     // update nameid set
     updateNameIDSet();
@@ -65,6 +65,9 @@ public:
     // This option might be useful for running old studies without upgrading
     bool noTimeseriesImportIntoInput;
 
+    //! Use a binary cache of the input matrices, in the study folder
+    bool useInputCache = false;
+
     //! Simplex optimization range
     SimplexOptimization simplexOptimizationRange;
     //! Mps files export asked
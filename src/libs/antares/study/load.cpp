@@ -28,6 +28,7 @@
 #include "study.h"
 #include "version.h"
 #include <antares/benchmarking/DurationCollector.h>
+#include <antares/array/matrix-cache.h>
 #include "scenario-builder/sets.h"
 #include "ui-runtimeinfos.h"
 
@@ -174,6 +175,12 @@ bool Study::internalLoadFromFolder(const String& path, const StudyLoadOptions& o
     // Initialize all internal paths
     relocate(path);
 
+    // Binary cache of the input matrices (opt-in)
+    if (options.useInputCache)
+        MatrixCache::Enable(path);
+    else
+        MatrixCache::Disable();
+
     // Reserving enough space in buffer to avoid several calls to realloc
     this->dataBuffer.reserve(4 * 1024 * 1024); // For matrices, reserving 4Mo
     this->bufferLoadingTS.reserve(2096);
@@ -198,7 +205,8 @@ bool Study::internalLoadFromFolder(const String& path, const StudyLoadOptions& o
     // End logical core --------
 
     // Areas - Raw Data
-    bool ret = areas.loadFromFolder(options);
+    // The areas are loaded with as many threads as MC years run in parallel
+    bool ret = areas.loadFromFolder(options, maxNbYearsInParallel);
 
     logs.info() << "Loading correlation matrices...";
     // Correlation matrices
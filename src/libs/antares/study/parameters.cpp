@@ -117,6 +117,11 @@ static bool ConvertCStrToResultFormat(const AnyString& text, ResultFormat& out)
         out = zipArchive;
         return true;
     }
+    if (s == "columnar")
+    {
+        out = columnarFiles;
+        return true;
+    }
 
     logs.warning() << "parameters:  invalid result format. Got '" << text << "'";
     out = legacyFilesDirectories;
@@ -132,6 +137,9 @@ static void ParametersSaveResultFormat(IniFile::Section* section, ResultFormat f
     case zipArchive:
         section->add(name, "zip");
         break;
+    case columnarFiles:
+        section->add(name, "columnar");
+        break;
     default:
         section->add(name, "txt-files");
     }
@@ -338,12 +346,16 @@ void Parameters::reset()
     ortoolsSolver = "sirius";
 
     resultFormat = legacyFilesDirectories;
+    zipCompressionLevel = defaultZipCompressionLevel;
 
     // Adequacy patch parameters
     adqPatchParams.reset();
 
     // Initialize all seeds
     resetSeeds();
+    // The time-series of existing studies are unchanged, unless the new sequences are chosen
+    legacyThermalTSRandomSequence = true;
+    legacyXCastTSRandomSequence = true;
 }
 
 bool Parameters::isTSGeneratedByPrepro(const TimeSeriesType ts) const
@@ -553,6 +565,8 @@ static bool SGDIntLoadFamily_Output(Parameters& d,
         return value.to<bool>(d.hydroDebug);
     if (key == "result-format")
         return ConvertCStrToResultFormat(value, d.resultFormat);
+    if (key == "zip-compression-level")
+        return value.to<uint>(d.zipCompressionLevel);
     return false;
 }
 static bool SGDIntLoadFamily_Optimization(Parameters& d,
@@ -753,6 +767,10 @@ static bool SGDIntLoadFamily_AdvancedParameters(Parameters& d,
 {
     if (key == "accuracy-on-correlation")
         return ConvertCStrToListTimeSeries(value, d.timeSeriesAccuracyOnCorrelation);
+    if (key == "legacy-thermal-ts-random-sequence")
+        return value.to<bool>(d.legacyThermalTSRandomSequence);
+    if (key == "legacy-xcast-ts-random-sequence")
+        return value.to<bool>(d.legacyXCastTSRandomSequence);
     return false;
 }
 static bool SGDIntLoadFamily_Playlist(Parameters& d,
@@ -1169,6 +1187,13 @@ void Parameters::fixBadValues()
         nbTimeSeriesWind = 1;
     if (!nbTimeSeriesSolar)
         nbTimeSeriesSolar = 1;
+
+    if (zipCompressionLevel > 9)
+    {
+        logs.warning() << "parameters: invalid zip compression level " << zipCompressionLevel
+                       << ", the maximum level (9) will be used";
+        zipCompressionLevel = 9;
+    }
 }
 
 uint64_t Parameters::memoryUsage() const
@@ -1569,6 +1594,8 @@ void Parameters::saveToINI(IniFile& ini) const
             section->add("hydro-debug", hydroDebug);
         ParametersSaveTimeSeries(section, "archives", timeSeriesToArchive);
         ParametersSaveResultFormat(section, resultFormat);
+        if (zipCompressionLevel != defaultZipCompressionLevel)
+            section->add("zip-compression-level", zipCompressionLevel);
     }
 
     // Optimization
@@ -1632,6 +1659,10 @@ void Parameters::saveToINI(IniFile& ini) const
         // Accuracy on correlation
         ParametersSaveTimeSeries(
           section, "accuracy-on-correlation", timeSeriesAccuracyOnCorrelation);
+        if (!legacyThermalTSRandomSequence)
+            section->add("legacy-thermal-ts-random-sequence", legacyThermalTSRandomSequence);
+        if (!legacyXCastTSRandomSequence)
+            section->add("legacy-xcast-ts-random-sequence", legacyXCastTSRandomSequence);
     }
 
     // User's playlist
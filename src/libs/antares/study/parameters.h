@@ -512,6 +512,14 @@ public:
     //@{
     //! Seeds
     uint seed[seedMax];
+    //! Draw the thermal time-series of all clusters from a single random sequence, as before
+    //! 8.9 (serial generation, default : the time-series of a study don't change). Otherwise
+    //! each cluster has its own sequence derived from the seed (opt-in, parallel generation)
+    bool legacyThermalTSRandomSequence = true;
+    //! Draw the load, solar and wind time-series from a single random sequence, as before 8.9
+    //! (serial generation, default : the time-series of a study don't change). Otherwise each
+    //! time-series has its own sequence derived from the seed (opt-in, parallel generation)
+    bool legacyXCastTSRandomSequence = true;
     //@}
 
     //! \name Ortools configuration
@@ -523,6 +531,9 @@ public:
     //@}
     // Format of results. Currently, only single files or zip archive are supported
     ResultFormat resultFormat = legacyFilesDirectories;
+    // Level of compression of the zip archive, from 0 (no compression) to 9 (best compression)
+    static constexpr uint defaultZipCompressionLevel = 2;
+    uint zipCompressionLevel = defaultZipCompressionLevel;
 
     // Naming constraints and variables in problems
     bool namedProblems;
@@ -73,12 +73,14 @@ int Cluster::loadDataSeriesFromFolder(Study& s, const AnyString& folder)
 {
     if (not folder.empty())
     {
-        auto& buffer = s.bufferLoadingTS;
+        // Local buffers, since clusters of different areas may be loaded concurrently
+        Yuni::String buffer;
+        Matrix<>::BufferType dataBuffer;
 
         int ret = 1;
         buffer.clear() << folder << SEP << parentArea->id << SEP << id() << SEP << "series."
                        << s.inputExtension;
-        ret = series.timeSeries.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &s.dataBuffer) && ret;
+        ret = series.timeSeries.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &dataBuffer) && ret;
 
         if (s.usedByTheSolver && s.parameters.derated)
             series.timeSeries.averageTimeseries();
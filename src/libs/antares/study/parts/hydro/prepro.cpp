@@ -153,7 +153,8 @@ bool PreproHydro::loadFromFolder(Study& s, const AreaName& areaID, const char* f
     };
 
     data.resize(hydroPreproMax, 12, true);
-    String& buffer = s.bufferLoadingTS;
+    String buffer;
+    Matrix<>::BufferType dataBuffer;
 
     buffer.clear() << folder << SEP << areaID << SEP << "prepro.ini";
     bool ret = (PreproHydroLoadSettings(this, buffer.c_str()) ? true : false);
@@ -168,7 +169,7 @@ bool PreproHydro::loadFromFolder(Study& s, const AreaName& areaID, const char* f
     }
 
     buffer.clear() << folder << SEP << areaID << SEP << "energy.txt";
-    ret = data.loadFromCSVFile(buffer, hydroPreproMax, 12, mtrxOption, &s.dataBuffer) && ret;
+    ret = data.loadFromCSVFile(buffer, hydroPreproMax, 12, mtrxOption, &dataBuffer) && ret;
 
     if (JIT::enabled)
         return ret;
@@ -90,14 +90,15 @@ bool DataSeriesHydro::saveToFolder(const AreaName& areaID, const AnyString& fold
 bool DataSeriesHydro::loadFromFolder(Study& study, const AreaName& areaID, const AnyString& folder)
 {
     bool ret = true;
-    auto& buffer = study.bufferLoadingTS;
+    String buffer;
+    Matrix<>::BufferType dataBuffer;
 
     buffer.clear() << folder << SEP << areaID << SEP << "ror." << study.inputExtension;
 
-    ret = ror.timeSeries.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &study.dataBuffer) && ret;
+    ret = ror.timeSeries.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &dataBuffer) && ret;
 
     buffer.clear() << folder << SEP << areaID << SEP << "mod." << study.inputExtension;
-    ret = storage.timeSeries.loadFromCSVFile(buffer, 1, DAYS_PER_YEAR, &study.dataBuffer) && ret;
+    ret = storage.timeSeries.loadFromCSVFile(buffer, 1, DAYS_PER_YEAR, &dataBuffer) && ret;
 
     // The number of time-series
     count = storage.timeSeries.width;
@@ -108,7 +109,7 @@ bool DataSeriesHydro::loadFromFolder(Study& study, const AreaName& areaID, const
     if (study.header.version >= 860)
     {
         buffer.clear() << folder << SEP << areaID << SEP << "mingen." << study.inputExtension;
-        ret = mingen.timeSeries.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &study.dataBuffer) && ret;
+        ret = mingen.timeSeries.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &dataBuffer) && ret;
     }
 
     if (!study.usedByTheSolver)
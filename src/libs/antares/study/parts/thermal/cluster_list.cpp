@@ -44,9 +44,10 @@ bool ThermalClusterList::loadFromFolder(Study& study, const AnyString& folder, A
     logs.info() << "Loading thermal configuration for the area " << area->name;
 
     // Open the ini file
-    study.buffer.clear() << folder << SEP << "list.ini";
+    String filename;
+    filename << folder << SEP << "list.ini";
     IniFile ini;
-    if (!ini.open(study.buffer))
+    if (!ini.open(filename))
         return false;
 
     bool ret = true;
@@ -64,7 +65,7 @@ bool ThermalClusterList::loadFromFolder(Study& study, const AnyString& folder, A
         auto cluster = std::make_shared<ThermalCluster>(area);
 
         // Load data of a thermal cluster from a ini file section
-        if (not ThermalClusterLoadFromSection(study.buffer, *cluster, *section))
+        if (not ThermalClusterLoadFromSection(filename, *cluster, *section))
         {
             continue;
         }
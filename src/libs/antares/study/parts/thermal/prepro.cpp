@@ -67,7 +67,8 @@ bool PreproThermal::saveToFolder(const AnyString& folder)
 bool PreproThermal::loadFromFolder(Study& study, const AnyString& folder)
 {
     bool ret = true;
-    auto& buffer = study.bufferLoadingTS;
+    Yuni::String buffer;
+    Matrix<>::BufferType dataBuffer;
 
     auto cluster = itsThermalCluster.lock();
     if (!cluster)
@@ -79,7 +80,7 @@ bool PreproThermal::loadFromFolder(Study& study, const AnyString& folder)
 
     // standard loading
     ret = data.loadFromCSVFile(
-            buffer, thermalPreproMax, DAYS_PER_YEAR, Matrix<>::optFixedSize, &study.dataBuffer)
+            buffer, thermalPreproMax, DAYS_PER_YEAR, Matrix<>::optFixedSize, &dataBuffer)
           and ret;
 
     bool thermalTSglobalGeneration = study.parameters.isTSGeneratedByPrepro(timeSeriesThermal);
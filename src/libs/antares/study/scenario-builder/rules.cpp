@@ -30,6 +30,7 @@
 #include "../study.h"
 #include <antares/logs/logs.h>
 #include "scBuilderUtils.h"
+#include "scBuilderIndex.h"
 #include "TSnumberData.h"
 
 using namespace Yuni;
@@ -117,34 +118,49 @@ bool Rules::reset()
     return true;
 }
 
-Data::Area* Rules::getArea(const AreaName& areaname, bool updaterMode)
+Data::Area* Rules::getArea(std::string_view areaname, const StudyIndex& index, bool updaterMode)
 {
-    Data::Area* area = study_.areas.find(areaname);
+    Data::Area* area = index.area(areaname);
     if (!area && !updaterMode)
     {
         // silently ignore the error
-        logs.warning() << "[scenario-builder] The area '" << areaname << "' has not been found";
+        logs.warning() << "[scenario-builder] The area '"
+                       << AnyString(areaname.data(), (uint)areaname.size())
+                       << "' has not been found";
     }
     return area;
 }
 
-bool Rules::readThermalCluster(const AreaName::Vector& splitKey, String value, bool updaterMode)
+bool Rules::isTheActiveRule() const
+{
+    return pName.equalsInsensitive(study_.parameters.activeRulesScenario);
+}
+
+void Rules::addDisabledCluster(const Data::Area& area, std::string_view clustername, uint year)
+{
+    std::string clusterId = (area.id).to<std::string>();
+    clusterId += '.';
+    clusterId.append(clustername.data(), clustername.size());
+    disabledClustersOnRuleActive[clusterId].push_back(year + 1);
+}
+
+bool Rules::readThermalCluster(const Key& key,
+                               std::string_view value,
+                               const StudyIndex& index,
+                               bool updaterMode)
 {
-    const AreaName& areaname = splitKey[1];
-    const uint year = splitKey[2].to<uint>();
-    const ClusterName& clustername = splitKey[3];
+    const std::string_view areaname = key[1];
+    const uint year = fromStringToYear(key[2]);
+    const std::string_view clustername = key[3];
 
     if (clustername.empty())
         return false;
 
-    Data::Area* area = getArea(areaname, updaterMode);
+    Data::Area* area = getArea(areaname, index, updaterMode);
     if (!area)
         return false;
 
-    const ThermalCluster* cluster = area->thermal.list.find(clustername);
-    if (!cluster)
-        cluster = area->thermal.mustrunList.find(clustername);
-
+    const ThermalCluster* cluster = index.thermalCluster(*area, clustername);
     if (cluster)
     {
         uint val = fromStringToTSnumber(value);
@@ -152,23 +168,23 @@ bool Rules::readThermalCluster(const AreaName::Vector& splitKey, String value, b
     }
     else
     {
-        bool isTheActiveRule = (pName.toLower() == study_.parameters.activeRulesScenario.toLower());
-        if (!updaterMode and isTheActiveRule)
+        if (!updaterMode and isTheActiveRule())
         {
-            std::string clusterId
-              = (area->id).to<std::string>() + "." + clustername;
-            disabledClustersOnRuleActive[clusterId].push_back(year + 1);
+            addDisabledCluster(*area, clustername, year);
             return false;
         }
     }
     return true;
 }
 
-bool Rules::readRenewableCluster(const AreaName::Vector& splitKey, String value, bool updaterMode)
+bool Rules::readRenewableCluster(const Key& key,
+                                 std::string_view value,
+                                 const StudyIndex& index,
+                                 bool updaterMode)
 {
-    const AreaName& areaname = splitKey[1];
-    const uint year = splitKey[2].to<uint>();
-    const ClusterName& clustername = splitKey[3];
+    const std::string_view areaname = key[1];
+    const uint year = fromStringToYear(key[2]);
+    const std::string_view clustername = key[3];
 
     if (!study_.parameters.renewableGeneration.isClusters())
         return false;
@@ -176,12 +192,11 @@ bool Rules::readRenewableCluster(const AreaName::Vector& splitKey, String value,
     if (clustername.empty())
         return false;
 
-    Data::Area* area = getArea(areaname, updaterMode);
+    Data::Area* area = getArea(areaname, index, updaterMode);
     if (!area)
         return false;
 
-    const RenewableCluster* cluster = area->renewable.list.find(clustername);
-
+    const RenewableCluster* cluster = index.renewableCluster(*area, clustername);
     if (cluster)
     {
         uint val = fromStringToTSnumber(value);
@@ -189,24 +204,23 @@ bool Rules::readRenewableCluster(const AreaName::Vector& splitKey, String value,
     }
     else
     {
-        bool isTheActiveRule = (pName.toLower() == study_.parameters.activeRulesScenario.toLower());
-        if (!updaterMode and isTheActiveRule)
+        if (!updaterMode and isTheActiveRule())
         {
-            std::string clusterId
-              = (area->id).to<std::string>() + "." + clustername;
-            disabledClustersOnRuleActive[clusterId].push_back(year + 1);
+            addDisabledCluster(*area, clustername, year);
             return false;
         }
     }
     return true;
 }
 
-bool Rules::readLoad(const AreaName::Vector& splitKey, String value, bool updaterMode)
+bool Rules::readLoad(const Key& key,
+                     std::string_view value,
+                     const StudyIndex& index,
+                     bool updaterMode)
 {
-    const AreaName& areaname = splitKey[1];
-    const uint year = splitKey[2].to<uint>();
+    const uint year = fromStringToYear(key[2]);
 
-    const Data::Area* area = getArea(areaname, updaterMode);
+    const Data::Area* area = getArea(key[1], index, updaterMode);
     if (!area)
         return false;
 
@@ -215,12 +229,14 @@ bool Rules::readLoad(const AreaName::Vector& splitKey, String value, bool update
     return true;
 }
 
-bool Rules::readWind(const AreaName::Vector& splitKey, String value, bool updaterMode)
+bool Rules::readWind(const Key& key,
+                     std::string_view value,
+                     const StudyIndex& index,
+                     bool updaterMode)
 {
-    const uint year = splitKey[2].to<uint>();
-    const AreaName& areaname = splitKey[1];
+    const uint year = fromStringToYear(key[2]);
 
-    const Data::Area* area = getArea(areaname, updaterMode);
+    const Data::Area* area = getArea(key[1], index, updaterMode);
     if (!area)
         return false;
 
@@ -229,12 +245,14 @@ bool Rules::readWind(const AreaName::Vector& splitKey, String value, bool update
     return true;
 }
 
-bool Rules::readHydro(const AreaName::Vector& splitKey, String value, bool updaterMode)
+bool Rules::readHydro(const Key& key,
+                      std::string_view value,
+                      const StudyIndex& index,
+                      bool updaterMode)
 {
-    const uint year = splitKey[2].to<uint>();
-    const AreaName& areaname = splitKey[1];
+    const uint year = fromStringToYear(key[2]);
 
-    const Data::Area* area = getArea(areaname, updaterMode);
+    const Data::Area* area = getArea(key[1], index, updaterMode);
     if (!area)
         return false;
 
@@ -243,12 +261,14 @@ bool Rules::readHydro(const AreaName::Vector& splitKey, String value, bool updat
     return true;
 }
 
-bool Rules::readSolar(const AreaName::Vector& splitKey, String value, bool updaterMode)
+bool Rules::readSolar(const Key& key,
+                      std::string_view value,
+                      const StudyIndex& index,
+                      bool updaterMode)
 {
-    const uint year = splitKey[2].to<uint>();
-    const AreaName& areaname = splitKey[1];
+    const uint year = fromStringToYear(key[2]);
 
-    const Data::Area* area = getArea(areaname, updaterMode);
+    const Data::Area* area = getArea(key[1], index, updaterMode);
     if (!area)
         return false;
 
@@ -257,12 +277,14 @@ bool Rules::readSolar(const AreaName::Vector& splitKey, String value, bool updat
     return true;
 }
 
-bool Rules::readHydroLevels(const AreaName::Vector& splitKey, String value, bool updaterMode)
+bool Rules::readHydroLevels(const Key& key,
+                            std::string_view value,
+                            const StudyIndex& index,
+                            bool updaterMode)
 {
-    const uint year = splitKey[2].to<uint>();
-    const AreaName& areaname = splitKey[1];
+    const uint year = fromStringToYear(key[2]);
 
-    const Data::Area* area = getArea(areaname, updaterMode);
+    const Data::Area* area = getArea(key[1], index, updaterMode);
     if (!area)
         return false;
 
@@ -271,37 +293,36 @@ bool Rules::readHydroLevels(const AreaName::Vector& splitKey, String value, bool
     return true;
 }
 
-Data::AreaLink* Rules::getLink(const AreaName& fromAreaName,
-                               const AreaName& toAreaName,
-                               bool updaterMode)
+bool Rules::readLink(const Key& key,
+                     std::string_view value,
+                     const StudyIndex& index,
+                     bool updaterMode)
 {
-    Data::AreaLink* link = study_.areas.findLink(fromAreaName, toAreaName);
-    if (!link && !updaterMode)
-    {
-        // silently ignore the error
-        logs.warning() << "[scenario-builder] The link '" << fromAreaName << " / " << toAreaName
-                       << "' has not been found";
-    }
-    return link;
-}
-
-bool Rules::readLink(const AreaName::Vector& splitKey, String value, bool updaterMode)
-{
-    const AreaName& fromAreaName = splitKey[1];
-    const AreaName& toAreaName = splitKey[2];
-    const uint year = splitKey[3].to<uint>();
+    const std::string_view fromAreaName = key[1];
+    const std::string_view toAreaName = key[2];
+    const uint year = fromStringToYear(key[3]);
 
-    Data::Area* fromArea = getArea(fromAreaName, updaterMode);
+    Data::Area* fromArea = getArea(fromAreaName, index, updaterMode);
     if (!fromArea)
         return false;
 
-    const Data::Area* toArea = getArea(toAreaName, updaterMode);
+    Data::Area* toArea = getArea(toAreaName, index, updaterMode);
     if (!toArea)
         return false;
 
-    AreaLink* link = getLink(fromAreaName, toAreaName, updaterMode);
+    AreaLink* link = fromArea->findExistingLinkWith(*toArea);
     if (!link)
+    {
+        if (!updaterMode)
+        {
+            // silently ignore the error
+            logs.warning() << "[scenario-builder] The link '"
+                           << AnyString(fromAreaName.data(), (uint)fromAreaName.size())
+                           << " / " << AnyString(toAreaName.data(), (uint)toAreaName.size())
+                           << "' has not been found";
+        }
         return false;
+    }
 
     uint val = fromStringToTSnumber(value);
     fromArea = link->from;
@@ -320,9 +341,10 @@ bool Rules::checkGroupExists(const std::string& groupName) const
     return true;
 }
 
-bool Rules::readBindingConstraints(const AreaName::Vector &splitKey, String value) {
-    std::string group_name = splitKey[1].c_str();
-    auto year = std::stoi(splitKey[2].c_str());
+bool Rules::readBindingConstraints(const Key& key, std::string_view value)
+{
+    std::string group_name(key[1]);
+    auto year = fromStringToYear(key[2]);
 
     if (!checkGroupExists(group_name))
         return false;
@@ -332,33 +354,37 @@ bool Rules::readBindingConstraints(const AreaName::Vector &splitKey, String valu
     return true;
 }
 
-bool Rules::readLine(const AreaName::Vector& splitKey, String value, bool updaterMode)
+bool Rules::readLine(const Key& key,
+                     std::string_view value,
+                     const StudyIndex& index,
+                     bool updaterMode)
 {
-    if (splitKey.size() <= 2)
+    if (key.size() <= 2)
         return false;
 
-    const AreaName& kind_of_scenario = splitKey[0]; // load, thermal, hydro, ..., hydro levels, ...
+    // load, thermal, hydro, ..., hydro levels, ...
+    const std::string_view kind_of_scenario = key[0];
     if (kind_of_scenario.size() > 3)
         return false;
 
     if (kind_of_scenario == "t")
-        return readThermalCluster(splitKey, value, updaterMode);
+        return readThermalCluster(key, value, index, updaterMode);
     else if (kind_of_scenario == "r")
-        return readRenewableCluster(splitKey, value, updaterMode);
+        return readRenewableCluster(key, value, index, updaterMode);
     else if (kind_of_scenario == "l")
-        return readLoad(splitKey, value, updaterMode);
+        return readLoad(key, value, index, updaterMode);
     else if (kind_of_scenario == "w")
-        return readWind(splitKey, value, updaterMode);
+        return readWind(key, value, index, updaterMode);
     else if (kind_of_scenario == "h")
-        return readHydro(splitKey, value, updaterMode);
+        return readHydro(key, value, index, updaterMode);
     else if (kind_of_scenario == "s")
-        return readSolar(splitKey, value, updaterMode);
+        return readSolar(key, value, index, updaterMode);
     else if (kind_of_scenario == "hl")
-        return readHydroLevels(splitKey, value, updaterMode);
+        return readHydroLevels(key, value, index, updaterMode);
     else if (kind_of_scenario == "ntc")
-        return readLink(splitKey, value, updaterMode);
+        return readLink(key, value, index, updaterMode);
     else if (kind_of_scenario == "bc")
-        return readBindingConstraints(splitKey, value);
+        return readBindingConstraints(key, value);
     return false;
 }
 
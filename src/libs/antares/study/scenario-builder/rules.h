@@ -40,8 +40,10 @@
 #include "HydroTSNumberData.h"
 #include "WindTSNumberData.h"
 #include "LoadTSNumberData.h"
+#include "scBuilderIndex.h"
 #include <map>
 #include <memory>
+#include <string_view>
 
 namespace Antares
 {
@@ -82,9 +84,15 @@ public:
     bool reset();
 
     /*!
-    ** \brief Load information from a single line (extracted from an INI file)
+    ** \brief Load information from a single line (extracted from an INI file), the key being
+    ** in lower case
+    **
+    ** \param index Areas and clusters of the study, indexed once for all the lines
     */
-    bool readLine(const AreaName::Vector& splitKey, String value, bool updaterMode = false);
+    bool readLine(const Key& key,
+                  std::string_view value,
+                  const StudyIndex& index,
+                  bool updaterMode = false);
 
     /*!
     ** \brief Export the data into a mere INI file
@@ -133,21 +141,44 @@ public:
 
 private:
     // Member methods
-    bool readThermalCluster(const AreaName::Vector& instrs, String value, bool updaterMode);
-    bool readRenewableCluster(const AreaName::Vector& instrs, String value, bool updaterMode);
-    bool readLoad(const AreaName::Vector& instrs, String value, bool updaterMode);
-    bool readWind(const AreaName::Vector& instrs, String value, bool updaterMode);
-    bool readHydro(const AreaName::Vector& instrs, String value, bool updaterMode);
-    bool readSolar(const AreaName::Vector& instrs, String value, bool updaterMode);
-    bool readHydroLevels(const AreaName::Vector& instrs, String value, bool updaterMode);
-    bool readLink(const AreaName::Vector& instrs, String value, bool updaterMode);
-    bool readBindingConstraints(const AreaName::Vector &splitKey, String value);
-
-
-    Data::Area* getArea(const AreaName& areaname, bool updaterMode);
-    Data::AreaLink* getLink(const AreaName& fromAreaName,
-                            const AreaName& toAreaName,
+    bool readThermalCluster(const Key& key,
+                            std::string_view value,
+                            const StudyIndex& index,
                             bool updaterMode);
+    bool readRenewableCluster(const Key& key,
+                              std::string_view value,
+                              const StudyIndex& index,
+                              bool updaterMode);
+    bool readLoad(const Key& key,
+                  std::string_view value,
+                  const StudyIndex& index,
+                  bool updaterMode);
+    bool readWind(const Key& key,
+                  std::string_view value,
+                  const StudyIndex& index,
+                  bool updaterMode);
+    bool readHydro(const Key& key,
+                   std::string_view value,
+                   const StudyIndex& index,
+                   bool updaterMode);
+    bool readSolar(const Key& key,
+                   std::string_view value,
+                   const StudyIndex& index,
+                   bool updaterMode);
+    bool readHydroLevels(const Key& key,
+                         std::string_view value,
+                         const StudyIndex& index,
+                         bool updaterMode);
+    bool readLink(const Key& key,
+                  std::string_view value,
+                  const StudyIndex& index,
+                  bool updaterMode);
+    bool readBindingConstraints(const Key& key, std::string_view value);
+
+    Data::Area* getArea(std::string_view areaname, const StudyIndex& index, bool updaterMode);
+    //! Case-insensitive comparison of the name of the rules with the active rules
+    bool isTheActiveRule() const;
+    void addDisabledCluster(const Data::Area& area, std::string_view clustername, uint year);
     bool checkGroupExists(const std::string& groupName) const;
 
     // Member data
@@ -0,0 +1,114 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "scBuilderIndex.h"
+#include "../study.h"
+
+namespace Antares
+{
+namespace Data
+{
+namespace ScenarioBuilder
+{
+namespace
+{
+std::string_view ToStringView(const AnyString& text)
+{
+    return std::string_view(text.c_str(), text.size());
+}
+
+template<class MapT, class ListT>
+void AddClusters(MapT& map, const ListT& list)
+{
+    // The first cluster wins, as with successive calls to ClusterList::find()
+    for (auto& [id, cluster] : list.cluster)
+        map.emplace(ToStringView(id), cluster.get());
+}
+} // namespace
+
+void Key::split(std::string_view key)
+{
+    pSize = 0;
+    size_t begin = 0;
+    while (true)
+    {
+        const size_t end = key.find(',', begin);
+        if (end == std::string_view::npos)
+        {
+            add(key.substr(begin));
+            break;
+        }
+        add(key.substr(begin, end - begin));
+        begin = end + 1;
+    }
+}
+
+StudyIndex::StudyIndex(Study& study)
+{
+    const uint areaCount = study.areas.size();
+    pAreas.reserve(areaCount);
+    pThermalClusters.resize(areaCount);
+    pRenewableClusters.resize(areaCount);
+
+    for (auto& [id, area] : study.areas)
+    {
+        pAreas.emplace(ToStringView(id), area);
+        if (area->index >= areaCount)
+            continue;
+        AddClusters(pThermalClusters[area->index], area->thermal.list);
+        AddClusters(pThermalClusters[area->index], area->thermal.mustrunList);
+        AddClusters(pRenewableClusters[area->index], area->renewable.list);
+    }
+}
+
+Area* StudyIndex::area(std::string_view id) const
+{
+    auto i = pAreas.find(id);
+    return i != pAreas.end() ? i->second : nullptr;
+}
+
+const ThermalCluster* StudyIndex::thermalCluster(const Area& area, std::string_view id) const
+{
+    if (area.index >= pThermalClusters.size())
+        return nullptr;
+    auto& clusters = pThermalClusters[area.index];
+    auto i = clusters.find(id);
+    return i != clusters.end() ? i->second : nullptr;
+}
+
+const RenewableCluster* StudyIndex::renewableCluster(const Area& area, std::string_view id) const
+{
+    if (area.index >= pRenewableClusters.size())
+        return nullptr;
+    auto& clusters = pRenewableClusters[area.index];
+    auto i = clusters.find(id);
+    return i != clusters.end() ? i->second : nullptr;
+}
+
+} // namespace ScenarioBuilder
+} // namespace Data
+} // namespace Antares
@@ -0,0 +1,122 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __LIBS_STUDY_SCENARIO_BUILDER_INDEX_H__
+#define __LIBS_STUDY_SCENARIO_BUILDER_INDEX_H__
+
+#include <yuni/yuni.h>
+#include <array>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "../fwd.h"
+
+namespace Antares
+{
+namespace Data
+{
+namespace ScenarioBuilder
+{
+/*!
+** \brief Fields of a key of the scenario builder (e.g. "t,fr,0,base")
+**
+** The fields are views on the key, nothing is copied.
+*/
+class Key final
+{
+public:
+    enum
+    {
+        maxFields = 4
+    };
+
+    Key() = default;
+    explicit Key(std::string_view key)
+    {
+        split(key);
+    }
+
+    //! Split a key on ',' (the fields beyond `maxFields` are counted but not kept)
+    void split(std::string_view key);
+
+    //! Append a field
+    void add(std::string_view field)
+    {
+        if (pSize < maxFields)
+            pFields[pSize] = field;
+        ++pSize;
+    }
+
+    //! Number of fields
+    uint size() const
+    {
+        return pSize;
+    }
+
+    //! A field, empty if there is none
+    std::string_view operator[](uint index) const
+    {
+        return index < pSize && index < maxFields ? pFields[index] : std::string_view();
+    }
+
+private:
+    std::array<std::string_view, maxFields> pFields;
+    uint pSize = 0;
+};
+
+/*!
+** \brief Hash tables of the areas and of the clusters of a study, by their id
+**
+** The tables are built once before reading all the lines of the scenario builder, and refer
+** to the ids held by the study : the study must not be modified meanwhile.
+*/
+class StudyIndex final
+{
+public:
+    explicit StudyIndex(Study& study);
+
+    //! Area from its id, null if there is none
+    Area* area(std::string_view id) const;
+    //! Thermal cluster (including the must-run ones) of an area from its id, null if there is none
+    const ThermalCluster* thermalCluster(const Area& area, std::string_view id) const;
+    //! Renewable cluster of an area from its id, null if there is none
+    const RenewableCluster* renewableCluster(const Area& area, std::string_view id) const;
+
+private:
+    template<class ClusterT>
+    using ClusterMap = std::unordered_map<std::string_view, const ClusterT*>;
+
+    std::unordered_map<std::string_view, Area*> pAreas;
+    //! Clusters, by area index
+    std::vector<ClusterMap<ThermalCluster>> pThermalClusters;
+    std::vector<ClusterMap<RenewableCluster>> pRenewableClusters;
+};
+
+} // namespace ScenarioBuilder
+} // namespace Data
+} // namespace Antares
+
+#endif // __LIBS_STUDY_SCENARIO_BUILDER_INDEX_H__
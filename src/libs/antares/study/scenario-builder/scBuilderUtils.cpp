@@ -25,6 +25,10 @@
 ** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
 */
 
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 #include <iomanip>
 #include <string>
@@ -45,59 +49,65 @@ std::string fromHydroLevelToString(double d)
     return stream.str();
 }
 
+namespace
+{
+//! Same as std::stod(), without any allocation : false if there is no number
+bool parseDouble(std::string_view value, double& result)
+{
+    char buffer[64];
+    if (value.size() >= sizeof(buffer))
+        value = value.substr(0, sizeof(buffer) - 1);
+    memcpy(buffer, value.data(), value.size());
+    buffer[value.size()] = '\0';
+
+    char* end = nullptr;
+    result = strtod(buffer, &end);
+    return end != buffer;
+}
+} // namespace
+
 double fromStringToHydroLevel(const Yuni::String& value, const double maxLevel)
 {
-    double result;
-    double result_tmp;
+    return fromStringToHydroLevel(std::string_view(value.c_str(), value.size()), maxLevel);
+}
 
-    std::string val = value.to<std::string>();
-    try
-    {
-        result_tmp = stod(val);
-    }
-    catch (std::invalid_argument&)
-    {
+double fromStringToHydroLevel(std::string_view value, const double maxLevel)
+{
+    double result_tmp;
+    if (!parseDouble(value, result_tmp))
         return std::nan("");
-    }
 
     if (result_tmp < 0.)
-        result = 0.;
-    else
-    {
-        if (result_tmp > maxLevel)
-            result = maxLevel;
-        else
-            result = result_tmp;
-    }
-    return result;
+        return 0.;
+    if (result_tmp > maxLevel)
+        return maxLevel;
+    return result_tmp;
 }
 
 uint fromStringToTSnumber(const Yuni::String& value)
 {
-    uint result;
+    return fromStringToTSnumber(std::string_view(value.c_str(), value.size()));
+}
+
+uint fromStringToTSnumber(std::string_view value)
+{
     const uint maxTSnumber = 10000;
     double result_dbl;
-
-    std::string val = value.to<std::string>();
-    try
-    {
-        result_dbl = stod(val);
-    }
-    catch (std::invalid_argument&)
-    {
+    if (!parseDouble(value, result_dbl) || std::isnan(result_dbl))
         return 0;
-    }
 
     if (result_dbl < 0.)
-        result = 0;
-    else
-    {
-        if (result_dbl > maxTSnumber)
-            result = maxTSnumber;
-        else
-            result = (uint)result_dbl;
-    }
-    return result;
+        return 0;
+    if (result_dbl > maxTSnumber)
+        return maxTSnumber;
+    return (uint)result_dbl;
+}
+
+uint fromStringToYear(std::string_view value)
+{
+    uint year = 0;
+    std::from_chars(value.data(), value.data() + value.size(), year);
+    return year;
 }
 
 } // namespace ScenarioBuilder
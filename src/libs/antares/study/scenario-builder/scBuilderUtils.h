@@ -30,6 +30,7 @@
 #include <yuni/yuni.h>
 #include <yuni/core/fwd.h>
 #include <string>
+#include <string_view>
 
 namespace Antares
 {
@@ -39,8 +40,13 @@ namespace ScenarioBuilder
 {
 std::string fromHydroLevelToString(double d);
 double fromStringToHydroLevel(const Yuni::String& value, const double maxLevel);
+double fromStringToHydroLevel(std::string_view value, const double maxLevel);
 
 uint fromStringToTSnumber(const Yuni::String& value);
+uint fromStringToTSnumber(std::string_view value);
+
+//! Year of a key of the scenario builder (0 if invalid)
+uint fromStringToYear(std::string_view value);
 
 } // namespace ScenarioBuilder
 } // namespace Data
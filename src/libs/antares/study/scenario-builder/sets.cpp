@@ -26,8 +26,13 @@
 */
 
 #include "sets.h"
+#include "scBuilderIndex.h"
 #include "../study.h"
 #include <antares/logs/logs.h>
+#include <antares/io/statistics.h>
+#include <yuni/io/file.h>
+#include <string>
+#include <string_view>
 
 using namespace Yuni;
 
@@ -165,6 +170,28 @@ bool Sets::internalSaveToIniFile(const AnyString& filename) const
     return true;
 }
 
+namespace
+{
+std::string_view Trim(std::string_view text)
+{
+    const size_t first = text.find_first_not_of(" \t\r\n");
+    if (first == std::string_view::npos)
+        return std::string_view();
+    const size_t last = text.find_last_not_of(" \t\r\n");
+    return text.substr(first, last - first + 1);
+}
+
+// The keys are case-insensitive, as in IniFile
+void ToLowerAscii(char* begin, char* end)
+{
+    for (; begin != end; ++begin)
+    {
+        if (*begin >= 'A' && *begin <= 'Z')
+            *begin = (char)(*begin - 'A' + 'a');
+    }
+}
+} // namespace
+
 bool Sets::internalLoadFromINIFile(const AnyString& filename)
 {
     // Logs
@@ -172,32 +199,90 @@ bool Sets::internalLoadFromINIFile(const AnyString& filename)
     // Cleaning
     pMap.clear();
 
-    IniFile ini;
-    if (not ini.open(filename))
+    // The whole file is read at once and parsed in place, in a single pass : the scenario builder
+    // may have millions of lines, IniFile would allocate a property for each of them.
+    std::string content;
+    if (IO::errNone != IO::File::LoadFromFile(content, filename))
+    {
+        logs.error() << "I/O error: " << filename << ": Impossible to read the file";
         return false;
+    }
+    Statistics::HasReadFromDisk(content.size());
 
-    ini.each([&](const IniFile::Section& section) {
-        if (section.name.empty())
-            return;
-
-        RulesScenarioName name = section.name;
-        name.trim(" \t");
-        if (!name)
-            return;
+    // The areas and the clusters are indexed once for all the lines
+    const StudyIndex index(*pStudy);
+    Rules::Ptr ruleset;
+    Key key;
 
-        // Create a new ruleset
-        Rules::Ptr rulesetptr = createNew(name);
-        Rules& ruleset = *rulesetptr;
-        AreaName::Vector splitKey;
+    char* const data = content.data();
+    const size_t size = content.size();
+    size_t offset = 0;
+    while (offset < size)
+    {
+        size_t eol = content.find('\n', offset);
+        if (eol == std::string::npos)
+            eol = size;
+        char* const begin = data + offset;
+        const std::string_view line(begin, eol - offset);
+        offset = eol + 1;
 
-        for (auto* p = section.firstProperty; p != nullptr; p = p->next)
+        // The first '[' or '=' gives the type of the line
+        const size_t separator = line.find_first_of("[=");
+        if (separator == std::string_view::npos || line[separator] == '[')
         {
-            p->key.split(splitKey, ",", true, false);
-            ruleset.readLine(splitKey, p->value, inUpdaterMode);
+            if (separator == std::string_view::npos)
+            {
+                const std::string_view text = Trim(line);
+                if (!text.empty() && text[0] != ';' && text[0] != '#')
+                {
+                    logs.error() << filename
+                                 << ": invalid INI format. Got a key without any value '"
+                                 << AnyString(text.data(), (uint)text.size()) << "'";
+                }
+                continue;
+            }
+
+            std::string_view rawName = line.substr(separator + 1);
+            rawName = rawName.substr(0, rawName.find(']'));
+            if (rawName.empty())
+                continue;
+
+            // New section
+            if (ruleset)
+                ruleset->sendWarningsForDisabledClusters();
+            ruleset = nullptr;
+
+            const std::string_view name = Trim(rawName);
+            if (name.empty())
+                continue;
+
+            RulesScenarioName rulesName(name.data(), (uint)name.size());
+            ruleset = createNew(rulesName);
+            if (!ruleset)
+            {
+                // The section is duplicated : its lines are added to the existing ruleset
+                rulesName.toLower();
+                ruleset = find(rulesName);
+            }
+            continue;
         }
 
-        ruleset.sendWarningsForDisabledClusters();
-    });
+        // Property
+        if (!ruleset)
+            continue;
+        const std::string_view value = Trim(line.substr(separator + 1));
+        if (value.empty())
+            continue;
+        const std::string_view rawKey = Trim(line.substr(0, separator));
+        char* const keyBegin = begin + (rawKey.data() - line.data());
+        ToLowerAscii(keyBegin, keyBegin + rawKey.size());
+
+        key.split(rawKey);
+        ruleset->readLine(key, value, index, inUpdaterMode);
+    }
+
+    if (ruleset)
+        ruleset->sendWarningsForDisabledClusters();
     return true;
 }
 
@@ -54,6 +54,7 @@
 #include "antares/study/binding_constraint/BindingConstraintsRepository.h"
 #include "antares/study/binding_constraint/BindingConstraintGroupRepository.h"
 
+#include <atomic>
 #include <memory>
 
 namespace Antares::Data
@@ -665,9 +666,11 @@ public:
     //@}
 
     /*!
-    ** \brief
+    ** \brief True if a fatal error occurred while loading the study
+    **
+    ** Areas may be loaded concurrently, hence the atomic.
     */
-    bool gotFatalError = false;
+    std::atomic<bool> gotFatalError = false;
 
     /*!
     ** \brief A non-zero value when the study will be used by the solver
@@ -12,6 +12,8 @@ namespace Antares::Data
         // Store outputs as files inside directories
         legacyFilesDirectories = 0,
         // Store outputs inside a single zip archive
-        zipArchive
+        zipArchive,
+        // Store outputs as binary, column-oriented files (.bin) inside directories
+        columnarFiles
     };
 }
\ No newline at end of file
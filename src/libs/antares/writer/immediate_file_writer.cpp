@@ -1,6 +1,9 @@
 #include <yuni/core/string.h>
 #include <yuni/io/file.h>
 
+#include <string>
+#include <unordered_set>
+
 #include "private/immediate_file_writer.h"
 #include <antares/io/file.h>
 #include <antares/logs/logs.h>
@@ -26,15 +29,24 @@ static bool createDirectory(const Yuni::String& path)
     return true;
 }
 
-static bool createDirectoryHierarchy(const Yuni::String& root, const Yuni::String& toCreate)
+// Directories found in `createdDirectories` (relative to root, "" being the root itself)
+// are not created again. Newly created directories are added to it.
+static bool createDirectoryHierarchy(const Yuni::String& root,
+                                     const Yuni::String& toCreate,
+                                     std::unordered_set<std::string>& createdDirectories)
 {
     using namespace Yuni;
     String::Vector dirs;
     toCreate.split(dirs, IO::SeparatorAsString);
     String currentDir = root;
+    std::string relativeDir;
 
-    if (!createDirectory(root))
-        return false;
+    if (!createdDirectories.count(relativeDir))
+    {
+        if (!createDirectory(root))
+            return false;
+        createdDirectories.insert(relativeDir);
+    }
 
     // Remove file component
     dirs.pop_back();
@@ -42,8 +54,15 @@ static bool createDirectoryHierarchy(const Yuni::String& root, const Yuni::Strin
     for (auto& dir : dirs)
     {
         currentDir << Yuni::IO::Separator << dir;
+        if (!relativeDir.empty())
+            relativeDir += Yuni::IO::Separator;
+        relativeDir.append(dir.c_str(), dir.size());
+
+        if (createdDirectories.count(relativeDir))
+            continue;
         if (!createDirectory(currentDir))
             return false;
+        createdDirectories.insert(relativeDir);
     }
     return true;
 }
@@ -52,44 +71,70 @@ namespace Antares
 {
 namespace Solver
 {
-ImmediateFileResultWriter::ImmediateFileResultWriter(const char* folderOutput) :
- pOutputFolder(folderOutput)
+ImmediateFileResultWriter::ImmediateFileResultWriter(
+  const char* folderOutput,
+  std::shared_ptr<Yuni::Job::QueueService> qs,
+  size_t maxPendingBytes) :
+ pOutputFolder(folderOutput), pQueueService(qs), maxPendingBytes_(maxPendingBytes)
+{
+}
+
+ImmediateFileResultWriter::~ImmediateFileResultWriter()
+{
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+        // Catch all, do nothing
+    }
+}
+
+bool ImmediateFileResultWriter::prepareDirectoryHierarchy(const std::string& entryPath,
+                                                          Yuni::String& output)
 {
+    output << pOutputFolder << Yuni::IO::Separator << entryPath.c_str();
+
+    std::lock_guard lock(directoriesMutex_);
+    return createDirectoryHierarchy(pOutputFolder, entryPath.c_str(), createdDirectories_);
 }
 
-ImmediateFileResultWriter::~ImmediateFileResultWriter() = default;
+void ImmediateFileResultWriter::reservePendingBytes(size_t size)
+{
+    std::unique_lock lock(pendingBytesMutex_);
+    // An entry larger than the limit is accepted once every other entry has been written
+    pendingBytesReleased_.wait(
+      lock, [this, size] { return pendingBytes_ == 0 || pendingBytes_ + size <= maxPendingBytes_; });
+    pendingBytes_ += size;
+}
 
-static bool prepareDirectoryHierarchy(const YString& root,
-                                      const std::string& entryPath,
-                                      Yuni::String& output)
+void ImmediateFileResultWriter::releasePendingBytes(size_t size)
 {
-    output << root << Yuni::IO::Separator << entryPath.c_str();
-    return createDirectoryHierarchy(root, entryPath.c_str());
+    {
+        std::lock_guard lock(pendingBytesMutex_);
+        pendingBytes_ -= size;
+    }
+    pendingBytesReleased_.notify_all();
 }
 
-// Write to file immediately, creating directories if needed
 void ImmediateFileResultWriter::addEntryFromBuffer(const std::string& entryPath,
                                                    Yuni::Clob& entryContent)
 {
-    Yuni::String output;
-    if (prepareDirectoryHierarchy(pOutputFolder, entryPath, output))
-        IOFileSetContent(output, entryContent);
+    addEntryFromBufferHelper<Yuni::Clob>(entryPath, entryContent);
 }
 
-// Write to file immediately, creating directories if needed
 void ImmediateFileResultWriter::addEntryFromBuffer(const std::string& entryPath,
                                                    std::string& entryContent)
 {
-    Yuni::String output;
-    if (prepareDirectoryHierarchy(pOutputFolder, entryPath, output))
-        IOFileSetContent(output, entryContent);
+    addEntryFromBufferHelper<std::string>(entryPath, entryContent);
 }
 
 void ImmediateFileResultWriter::addEntryFromFile(const std::string& entryPath,
                                                  const std::string& filePath)
 {
     Yuni::String fullPath;
-    if (!prepareDirectoryHierarchy(pOutputFolder, entryPath, fullPath))
+    if (!prepareDirectoryHierarchy(entryPath, fullPath))
         return;
 
     switch (Yuni::IO::File::Copy(filePath.c_str(), fullPath))
@@ -113,16 +158,18 @@ void ImmediateFileResultWriter::addEntryFromFile(const std::string& entryPath,
 }
 
 void ImmediateFileResultWriter::flush()
-{}
+{
+    pendingTasks_.join();
+}
 
 bool ImmediateFileResultWriter::needsTheJobQueue() const
 {
-    return false;
+    return pQueueService != nullptr;
 }
 
 void ImmediateFileResultWriter::finalize(bool /*verbose*/)
 {
-    // Do nothing
+    flush();
 }
 
 void NullResultWriter::addEntryFromBuffer(const std::string&, Yuni::Clob&)
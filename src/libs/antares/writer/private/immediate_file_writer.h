@@ -1,26 +1,70 @@
 #pragma once
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
+
 #include <yuni/core/string.h>
+#include <yuni/job/queue/service.h>
+
 #include "antares/writer/i_writer.h"
+#include "antares/concurrency/concurrency.h"
 
 namespace Antares::Solver
 {
 class ImmediateFileResultWriter : public IResultWriter
 {
 public:
-    ImmediateFileResultWriter(const char* folderOutput);
+    // Default limit of the memory used by the entries waiting to be written
+    static constexpr size_t defaultMaxPendingBytes = 256 * 1024 * 1024;
+
+    // If a queue service is provided, entries are written in the background by jobs
+    // of this queue. Otherwise, they are written immediately by the calling thread.
+    ImmediateFileResultWriter(const char* folderOutput,
+                              std::shared_ptr<Yuni::Job::QueueService> qs = nullptr,
+                              size_t maxPendingBytes = defaultMaxPendingBytes);
     virtual ~ImmediateFileResultWriter();
-    // Write to file immediately, creating directories if needed
+    // Write to file, creating directories if needed
     void addEntryFromBuffer(const std::string& entryPath, Yuni::Clob& entryContent) override;
     void addEntryFromBuffer(const std::string& entryPath, std::string& entryContent) override;
+    // Copy the file immediately, creating directories if needed
     void addEntryFromFile(const std::string& entryPath, const std::string& filePath) override;
     void flush() override;
     bool needsTheJobQueue() const override;
     void finalize(bool verbose) override;
 
+private:
+    template<class ContentType>
+    void addEntryFromBufferHelper(const std::string& entryPath, ContentType& entryContent);
+    template<class ContentType>
+    void writeEntry(const std::string& entryPath, const ContentType& entryContent);
+
+    // Create the directories of an entry (if not already done), and compute its full path
+    bool prepareDirectoryHierarchy(const std::string& entryPath, Yuni::String& output);
+
+    // Back-pressure : wait until there is enough room for a new entry of this size
+    void reservePendingBytes(size_t size);
+    void releasePendingBytes(size_t size);
+
 private:
     Yuni::String pOutputFolder;
+
+    // Queue where jobs will be appended, may be null
+    std::shared_ptr<Yuni::Job::QueueService> pQueueService;
+    Concurrency::FutureSet pendingTasks_;
+
+    // Size of the entries waiting to be written
+    std::mutex pendingBytesMutex_;
+    std::condition_variable pendingBytesReleased_;
+    size_t pendingBytes_ = 0;
+    const size_t maxPendingBytes_;
+
+    // Directories already created, relative to the output folder
+    std::mutex directoriesMutex_;
+    std::unordered_set<std::string> createdDirectories_;
 };
 } // namespace Antares::Solver
 
+#include "immediate_file_writer.hxx"
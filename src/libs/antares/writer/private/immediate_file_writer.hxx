@@ -0,0 +1,51 @@
+#pragma once
+
+#include <antares/io/file.h>
+#include "ensure_queue_started.h"
+
+namespace Antares::Solver
+{
+template<class ContentType>
+void ImmediateFileResultWriter::writeEntry(const std::string& entryPath,
+                                           const ContentType& entryContent)
+{
+    Yuni::String output;
+    if (prepareDirectoryHierarchy(entryPath, output))
+        IOFileSetContent(output, entryContent);
+}
+
+template<class ContentType>
+void ImmediateFileResultWriter::addEntryFromBufferHelper(const std::string& entryPath,
+                                                         ContentType& entryContent)
+{
+    if (!pQueueService)
+    {
+        writeEntry(entryPath, entryContent);
+        return;
+    }
+
+    const size_t size = entryContent.size();
+    reservePendingBytes(size);
+
+    // The content is moved, so that the caller doesn't wait for the write
+    auto content = std::make_shared<ContentType>(std::move(entryContent));
+    EnsureQueueStartedIfNeeded ensureQueue(this, pQueueService);
+    pendingTasks_.add(Concurrency::AddTask(
+      *pQueueService,
+      [this, entryPath, content, size]()
+      {
+          try
+          {
+              writeEntry(entryPath, *content);
+          }
+          catch (...)
+          {
+              releasePendingBytes(size);
+              throw;
+          }
+          releasePendingBytes(size);
+      },
+      Yuni::Job::priorityLow));
+}
+
+} // namespace Antares::Solver
@@ -49,6 +49,8 @@ private:
     const std::string pEntryPath;
     // Content of the new file
     ContentT pContent;
+    // Level of compression of the new entry
+    const int pCompressionLevel;
     // Benchmarking. How long do we wait ? How long does the zip write take ?
     Benchmarking::IDurationCollector& pDurationCollector;
 };
@@ -58,7 +60,8 @@ class ZipWriter : public IResultWriter
 public:
     ZipWriter(std::shared_ptr<Yuni::Job::QueueService> qs,
               const char* archivePath,
-              Benchmarking::IDurationCollector& duration_collector);
+              Benchmarking::IDurationCollector& duration_collector,
+              int compressionLevel);
     virtual ~ZipWriter();
     void addEntryFromBuffer(const std::string& entryPath, Yuni::Clob& entryContent) override;
     void addEntryFromBuffer(const std::string& entryPath, std::string& entryContent) override;
@@ -80,6 +83,8 @@ private:
     ZipState pState;
     // Absolute path to the archive
     const std::string pArchivePath;
+    // Level of compression of the entries, from 0 (no compression) to 9 (best compression)
+    const int pCompressionLevel;
     // Benchmarking. Passed to jobs
     Benchmarking::IDurationCollector& pDurationCollector;
 
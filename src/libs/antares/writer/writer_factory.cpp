@@ -7,16 +7,19 @@ namespace Antares::Solver
 IResultWriter::Ptr resultWriterFactory(Antares::Data::ResultFormat fmt,
                                        const YString& folderOutput,
                                        std::shared_ptr<Yuni::Job::QueueService> qs,
-                                       Benchmarking::IDurationCollector& duration_collector)
+                                       Benchmarking::IDurationCollector& duration_collector,
+                                       int zipCompressionLevel)
 {
     using namespace Antares::Data;
     switch (fmt)
     {
     case zipArchive:
-        return std::make_shared<ZipWriter>(qs, folderOutput.c_str(), duration_collector);
+        return std::make_shared<ZipWriter>(
+          qs, folderOutput.c_str(), duration_collector, zipCompressionLevel);
     case legacyFilesDirectories:
+    case columnarFiles:
     default:
-        return std::make_shared<ImmediateFileResultWriter>(folderOutput.c_str());
+        return std::make_shared<ImmediateFileResultWriter>(folderOutput.c_str(), qs);
     }
 }
 } // namespace Antares::Solver
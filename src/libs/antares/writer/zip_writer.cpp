@@ -12,11 +12,16 @@ extern "C"
 #include <mz_zip.h>
 #include <mz_strm.h>
 #include <mz_zip_rw.h>
+#include <mz_crypt.h>
+#include <mz_strm_mem.h>
+#include <mz_strm_zlib.h>
 }
 
 #include <ctime> // std::time
+#include <cstdint>
 #include <utility>
 #include <sstream>
+#include <vector>
 
 namespace Antares::Solver
 {
@@ -30,8 +35,67 @@ void logErrorAndThrow(const std::string& errorMessage)
     throw IOError(errorMessage);
 }
 
+// Content of an entry, already compressed
+struct DeflatedEntry
+{
+    std::vector<uint8_t> data;
+    uint32_t crc = 0;
+};
+
+// Compress the content of an entry (raw deflate, as stored in the archive).
+// This doesn't require the zip handle, so that entries may be compressed concurrently.
+template<class ContentT>
+DeflatedEntry deflateEntry(const ContentT& content, int level, const std::string& entryPath)
+{
+    const auto size = static_cast<int32_t>(content.size());
+    const auto* input = reinterpret_cast<const uint8_t*>(content.data());
+
+    DeflatedEntry entry;
+    entry.crc = mz_crypt_crc32_update(0, input, size);
+
+    void* memStream = mz_stream_mem_create();
+    mz_stream_mem_open(memStream, nullptr, MZ_OPEN_MODE_CREATE);
+    // Avoid reallocating the buffer for each chunk produced by zlib
+    mz_stream_mem_set_grow_size(memStream, size / 2 + 4096);
+
+    void* zlibStream = mz_stream_zlib_create();
+    mz_stream_set_base(zlibStream, memStream);
+    mz_stream_set_prop_int64(zlibStream, MZ_STREAM_PROP_COMPRESS_LEVEL, level);
+
+    int32_t ret = mz_stream_open(zlibStream, nullptr, MZ_OPEN_MODE_WRITE);
+    int32_t bw = 0;
+    if (ret == MZ_OK)
+    {
+        bw = mz_stream_write(zlibStream, input, size);
+        // Closing the stream flushes the remaining compressed data
+        ret = mz_stream_close(zlibStream);
+    }
+
+    if (ret == MZ_OK && bw == size)
+    {
+        const void* buffer = nullptr;
+        int32_t length = 0;
+        mz_stream_mem_get_buffer(memStream, &buffer);
+        mz_stream_mem_get_buffer_length(memStream, &length);
+        const auto* first = static_cast<const uint8_t*>(buffer);
+        entry.data.assign(first, first + length);
+    }
+
+    mz_stream_zlib_delete(&zlibStream);
+    mz_stream_mem_close(memStream);
+    mz_stream_mem_delete(&memStream);
+
+    if (ret != MZ_OK || bw != size)
+    {
+        logErrorAndThrow("Error compressing entry " + entryPath + " (" + std::to_string(ret)
+                         + ", compressed = " + std::to_string(bw)
+                         + ", size = " + std::to_string(size) + ")");
+    }
+    return entry;
 }
 
+} // namespace
+
 // Class ZipWriteJob
 template<class ContentT>
 ZipWriteJob<ContentT>::ZipWriteJob(ZipWriter& writer,
@@ -43,11 +107,14 @@ ZipWriteJob<ContentT>::ZipWriteJob(ZipWriter& writer,
  pState(writer.pState),
  pEntryPath(std::move(entryPath)),
  pContent(std::move(content)),
+ pCompressionLevel(writer.pCompressionLevel),
  pDurationCollector(duration_collector)
 {
 }
 
-static std::unique_ptr<mz_zip_file> createInfo(const std::string& entryPath)
+static std::unique_ptr<mz_zip_file> createInfo(const std::string& entryPath,
+                                               const DeflatedEntry& entry,
+                                               size_t uncompressedSize)
 {
     auto info = std::make_unique<mz_zip_file>();
     memset(info.get(), 0, sizeof(mz_zip_file));
@@ -55,6 +122,10 @@ static std::unique_ptr<mz_zip_file> createInfo(const std::string& entryPath)
     info->zip64 = MZ_ZIP64_FORCE;
     info->compression_method = MZ_COMPRESS_METHOD_DEFLATE;
     info->modified_date = info->creation_date = std::time(0);
+    // The entry is written raw, since it has already been compressed
+    info->crc = entry.crc;
+    info->compressed_size = static_cast<int64_t>(entry.data.size());
+    info->uncompressed_size = static_cast<int64_t>(uncompressedSize);
     return info;
 }
 
@@ -65,7 +136,13 @@ void ZipWriteJob<ContentT>::writeEntry()
     if (pState != ZipState::can_receive_data)
         return;
 
-    auto file_info = createInfo(pEntryPath);
+    // Compress before taking the lock, so that several entries are compressed in parallel
+    Benchmarking::Timer timer_compress;
+    const DeflatedEntry entry = deflateEntry(pContent, pCompressionLevel, pEntryPath);
+    timer_compress.stop();
+    pDurationCollector.addDuration("zip_compress", timer_compress.get_duration());
+
+    auto file_info = createInfo(pEntryPath, entry, pContent.size());
 
     Benchmarking::Timer timer_wait;
     std::lock_guard<std::mutex> guard(pZipMutex); // Wait
@@ -78,11 +155,15 @@ void ZipWriteJob<ContentT>::writeEntry()
     {
         logErrorAndThrow("Error opening entry " + pEntryPath + " (" + std::to_string(ret) + ")");
     }
-    int32_t bw = mz_zip_writer_entry_write(pZipHandle, pContent.data(), pContent.size());
-    if (static_cast<unsigned int>(bw) != pContent.size())
+    int32_t bw = mz_zip_writer_entry_write(pZipHandle, entry.data.data(), entry.data.size());
+    if (static_cast<size_t>(bw) != entry.data.size())
     {
         logErrorAndThrow("Error writing entry " + pEntryPath + "(written = " + std::to_string(bw)
-                                                + ", size = " + std::to_string(pContent.size()) + ")");
+                                                + ", size = " + std::to_string(entry.data.size()) + ")");
+    }
+    if (int32_t ret = mz_zip_writer_entry_close(pZipHandle); ret != MZ_OK)
+    {
+        logErrorAndThrow("Error closing entry " + pEntryPath + " (" + std::to_string(ret) + ")");
     }
 
     timer_write.stop();
@@ -92,10 +173,12 @@ void ZipWriteJob<ContentT>::writeEntry()
 // Class ZipWriter
 ZipWriter::ZipWriter(std::shared_ptr<Yuni::Job::QueueService> qs,
                      const char* archivePath,
-                     Benchmarking::IDurationCollector& duration_collector) :
+                     Benchmarking::IDurationCollector& duration_collector,
+                     int compressionLevel) :
  pQueueService(qs),
  pState(ZipState::can_receive_data),
  pArchivePath(std::string(archivePath) + ".zip"),
+ pCompressionLevel(compressionLevel),
  pDurationCollector(duration_collector)
 {
     pZipHandle = mz_zip_writer_create();
@@ -103,8 +186,9 @@ ZipWriter::ZipWriter(std::shared_ptr<Yuni::Job::QueueService> qs,
     {
         logErrorAndThrow("Error opening zip file " + pArchivePath + " (" + std::to_string(ret) + ")");
     }
-    // TODO : make level of compression configurable
-    mz_zip_writer_set_compress_level(pZipHandle, MZ_COMPRESS_LEVEL_FAST);
+    // Entries are compressed by the jobs themselves (see deflateEntry), minizip-ng only
+    // copies the compressed data into the archive
+    mz_zip_writer_set_raw(pZipHandle, 1);
 }
 
 ZipWriter::~ZipWriter()
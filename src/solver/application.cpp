@@ -24,6 +24,7 @@
 #include <yuni/io/io.h>
 #include <yuni/datetime/timestamp.h>
 #include <yuni/core/process/rename.h>
+#include <yuni/core/system/cpu.h>
 
 #include <algorithm>
 
@@ -285,10 +286,19 @@ void Application::prepareWriter(Antares::Data::Study& study,
                                 Benchmarking::IDurationCollector& duration_collector)
 {
     ioQueueService = std::make_shared<Yuni::Job::QueueService>();
-    ioQueueService->maximumThreadCount(1);
+    // Zip entries are compressed by the jobs of this queue, possibly one per MC year in parallel,
+    // but no more than one per logical core.
+    // Txt files are written by a single job at a time, in the order they were added.
+    const bool zipOutput = study.parameters.resultFormat == Antares::Data::zipArchive;
+    const uint zipThreads = std::max(
+      1u, std::min(study.maxNbYearsInParallel, Yuni::System::CPU::Count()));
+    ioQueueService->maximumThreadCount(zipOutput ? zipThreads : 1);
     ioQueueService->start();
-    resultWriter = resultWriterFactory(
-            study.parameters.resultFormat, study.folderOutput, ioQueueService, duration_collector);
+    resultWriter = resultWriterFactory(study.parameters.resultFormat,
+                                       study.folderOutput,
+                                       ioQueueService,
+                                       duration_collector,
+                                       study.parameters.zipCompressionLevel);
 }
 
 void Application::readDataForTheStudy(Data::StudyLoadOptions& options)
@@ -50,6 +50,7 @@ void H2O2_J_Free(DONNEES_MENSUELLES_ETENDUES& DonneesMensuelles)
         auto ProbSpx = ProblemeHydrauliqueEtendu.ProblemeSpx[i];
         if (ProbSpx)
             SPX_LibererProbleme(ProbSpx);
+        ProblemeHydrauliqueEtendu.ProblemeSpx[i] = nullptr;
     }
 
     return;
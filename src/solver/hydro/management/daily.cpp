@@ -43,6 +43,7 @@
 #include <limits>
 #include <variable/state.h>
 #include <array>
+#include <memory>
 
 using namespace Yuni;
 
@@ -50,6 +51,62 @@ using namespace Yuni;
 
 namespace
 {
+// Each instance of the daily problems holds one problem per month length (28 to 31 days),
+// whose structure does not depend on the data. They are built once per thread and reused
+// for every month, area and year handled by that thread.
+class DailyProblems
+{
+public:
+    DailyProblems() = default;
+    DailyProblems(const DailyProblems&) = delete;
+    DailyProblems& operator=(const DailyProblems&) = delete;
+
+    ~DailyProblems()
+    {
+        if (problemWithoutReservoir_)
+        {
+            H2O_J_Free(problemWithoutReservoir_);
+            delete problemWithoutReservoir_;
+        }
+        if (problemWithReservoir_)
+            H2O2_J_Free(*problemWithReservoir_);
+    }
+
+    // The simplex bases are only kept between the months of an area : the results of an area
+    // must not depend on the areas previously handled by the thread
+    void startNewArea()
+    {
+        if (problemWithoutReservoir_)
+            H2O_J_Free(problemWithoutReservoir_);
+        if (problemWithReservoir_)
+            H2O2_J_Free(*problemWithReservoir_);
+    }
+
+    DONNEES_MENSUELLES* problemWithoutReservoirManagement()
+    {
+        if (!problemWithoutReservoir_)
+        {
+            problemWithoutReservoir_ = H2O_J_Instanciation();
+            H2O_J_AjouterBruitAuCout(*problemWithoutReservoir_);
+        }
+        return problemWithoutReservoir_;
+    }
+
+    DONNEES_MENSUELLES_ETENDUES& problemWithReservoirManagement()
+    {
+        // The problem must not be moved : some of its variables are bound to its own members
+        if (!problemWithReservoir_)
+            problemWithReservoir_.reset(new DONNEES_MENSUELLES_ETENDUES(H2O2_J_Instanciation()));
+        return *problemWithReservoir_;
+    }
+
+private:
+    DONNEES_MENSUELLES* problemWithoutReservoir_ = nullptr;
+    std::unique_ptr<DONNEES_MENSUELLES_ETENDUES> problemWithReservoir_;
+};
+
+thread_local DailyProblems dailyProblems;
+
 FatalError fatalError(const std::string& areaName, int year)
 {
     std::ostringstream msg;
@@ -221,10 +278,10 @@ struct DebugData
     }
 };
 
-inline void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::State& state,
-                                                            Data::Area& area,
-                                                            uint y,
-                                                            uint numSpace)
+void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::State& state,
+                                                     Data::Area& area,
+                                                     uint y,
+                                                     uint numSpace)
 {
     uint z = area.index;
     assert(z < areas_.size());
@@ -371,6 +428,8 @@ inline void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::St
         }
     }
 
+    dailyProblems.startNewArea();
+
     if (not area.hydro.reservoirManagement)
     {
         for (uint month = 0; month != 12; ++month)
@@ -383,8 +442,7 @@ inline void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::St
             uint firstDay = calendar_.months[simulationMonth].daysYear.first;
             uint endDay = firstDay + daysPerMonth;
 
-            DONNEES_MENSUELLES* problem = H2O_J_Instanciation();
-            H2O_J_AjouterBruitAuCout(*problem);
+            DONNEES_MENSUELLES* problem = dailyProblems.problemWithoutReservoirManagement();
             problem->NombreDeJoursDuMois = (int)daysPerMonth;
             problem->TurbineDuMois = data.MOG[realmonth];
 
@@ -416,8 +474,6 @@ inline void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::St
                 break;
             }
 
-            H2O_J_Free(problem);
-
 #ifndef NDEBUG
             for (uint day = firstDay; day != endDay; ++day)
             {
@@ -451,7 +507,7 @@ inline void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::St
             uint firstDay = calendar_.months[simulationMonth].daysYear.first;
             uint endDay = firstDay + daysPerMonth;
 
-            DONNEES_MENSUELLES_ETENDUES problem = H2O2_J_Instanciation();
+            DONNEES_MENSUELLES_ETENDUES& problem = dailyProblems.problemWithReservoirManagement();
             H2O2_J_apply_costs(h2o2_optim_costs, problem);
 
             if (debugData)
@@ -530,8 +586,6 @@ inline void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::St
                 throw fatalError(area.name.c_str(), y);
                 break;
             }
-
-            H2O2_J_Free(problem);
         }
 
         uint firstDaySimu = parameters_.simulationDays.first;
@@ -545,14 +599,4 @@ inline void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::St
     }
 }
 
-void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::State& state,
-                                                     uint y,
-                                                     uint numSpace)
-{
-    areas_.each(
-      [&](Data::Area& area) {
-          prepareDailyOptimalGenerations(state, area, y, numSpace);
-          });
-}
-
 } // namespace Antares
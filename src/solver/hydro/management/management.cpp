@@ -34,6 +34,7 @@
 #include <yuni/core/math.h>
 #include <limits>
 #include <antares/study/parts/hydro/container.h>
+#include <antares/concurrency/concurrency.h>
 #include <numeric>
 
 using namespace Yuni;
@@ -113,12 +114,14 @@ HydroManagement::HydroManagement(const Data::AreaList& areas,
                                  const Data::Parameters& params,
                                  const Date::Calendar& calendar,
                                  unsigned int maxNbYearsInParallel,
-                                 Solver::IResultWriter& resultWriter) :
+                                 Solver::IResultWriter& resultWriter,
+                                 std::shared_ptr<Yuni::Job::QueueService> queueService) :
     areas_(areas),
     calendar_(calendar),
     parameters_(params),
     maxNbYearsInParallel_(maxNbYearsInParallel),
-    resultWriter_(resultWriter)
+    resultWriter_(resultWriter),
+    queueService_(std::move(queueService))
 {
     // Ventilation results memory allocation
     uint nbDaysPerYear = 365;
@@ -490,6 +493,30 @@ void HydroManagement::prepareEffectiveDemand()
     });
 }
 
+void HydroManagement::prepareOptimalGenerations(double* randomReservoirLevel,
+                                                Solver::Variable::State& state,
+                                                uint y,
+                                                uint numSpace)
+{
+    // Each area only reads and writes its own data : areas can be processed in any order,
+    // results do not depend on the number of threads
+    auto ventilateArea = [this, randomReservoirLevel, &state, y, numSpace](Data::Area& area) {
+        prepareMonthlyOptimalGenerations(randomReservoirLevel, area, y);
+        prepareDailyOptimalGenerations(state, area, y, numSpace);
+    };
+
+    if (!queueService_)
+    {
+        areas_.each(ventilateArea);
+        return;
+    }
+
+    // The first error, in the order of the areas, is re-thrown
+    Concurrency::ForEachIndex(*queueService_, areas_.size(), [this, &ventilateArea](uint i) {
+        ventilateArea(*areas_.byIndex[i]);
+    });
+}
+
 void HydroManagement::makeVentilation(double* randomReservoirLevel,
                                       Solver::Variable::State& state,
                                       uint y,
@@ -508,8 +535,7 @@ void HydroManagement::makeVentilation(double* randomReservoirLevel,
     prepareNetDemand(numSpace, y, parameters_.mode);
     prepareEffectiveDemand();
 
-    prepareMonthlyOptimalGenerations(randomReservoirLevel, y);
-    prepareDailyOptimalGenerations(state, y, numSpace);
+    prepareOptimalGenerations(randomReservoirLevel, state, y, numSpace);
 }
 
 } // namespace Antares
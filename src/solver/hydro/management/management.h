@@ -30,6 +30,8 @@
 #include <yuni/yuni.h>
 #include <antares/study/fwd.h>
 #include <antares/mersenne-twister/mersenne-twister.h>
+#include <yuni/job/queue/service.h>
+#include <memory>
 #include "../../simulation/sim_structure_donnees.h"
 
 namespace Antares
@@ -109,7 +111,8 @@ public:
                     const Data::Parameters& params,
                     const Date::Calendar& calendar,
                     unsigned int maxNbYearsInParallel,
-                    Solver::IResultWriter& resultWriter);
+                    Solver::IResultWriter& resultWriter,
+                    std::shared_ptr<Yuni::Job::QueueService> queueService = nullptr);
 
     //! Perform the hydro ventilation
     void makeVentilation(double* randomReservoirLevel,
@@ -138,18 +141,22 @@ private:
     void prepareNetDemand(uint numSpace, uint year, Data::StudyMode mode);
     //! Prepare the effective demand for each area
     void prepareEffectiveDemand();
+    //! Monthly and daily optimal generations of all areas, areas are independent from each other
+    void prepareOptimalGenerations(double* random_reservoir_level,
+                                   Solver::Variable::State& state,
+                                   uint y,
+                                   uint numSpace);
+
     //! Monthly Optimal generations
-    void prepareMonthlyOptimalGenerations(double* random_reservoir_level, uint y);
+    void prepareMonthlyOptimalGenerations(double* random_reservoir_level,
+                                          Data::Area& area,
+                                          uint y);
 
     //! Monthly target generations
     // note: inflows may have two different types, if in swap mode or not
     // \return The total inflow for the whole year
     double prepareMonthlyTargetGenerations(Data::Area& area, TmpDataByArea& data);
 
-    void prepareDailyOptimalGenerations(Solver::Variable::State& state,
-                                        uint y,
-                                        uint numSpace);
-
     void prepareDailyOptimalGenerations(Solver::Variable::State& state,
                                         Data::Area& area,
                                         uint y,
@@ -163,6 +170,8 @@ private:
     const Data::Parameters& parameters_;
     unsigned int maxNbYearsInParallel_ = 0;
     Solver::IResultWriter& resultWriter_;
+    //! Queue service used to ventilate areas in parallel (optional)
+    std::shared_ptr<Yuni::Job::QueueService> queueService_;
 
     HYDRO_VENTILATION_RESULTS ventilationResults_;
 }; // class HydroManagement
@@ -27,6 +27,7 @@
 #include <iomanip>
 #include <sstream>
 #include <limits>
+#include <memory>
 
 #include <yuni/yuni.h>
 #include <antares/study/study.h>
@@ -42,6 +43,41 @@ using namespace Yuni;
 
 #define SEP IO::Separator
 
+namespace
+{
+// The structure of the monthly problem does not depend on the data : it is built once per
+// thread and reused for every area and year handled by that thread
+class MonthlyProblem
+{
+public:
+    MonthlyProblem() = default;
+    MonthlyProblem(const MonthlyProblem&) = delete;
+    MonthlyProblem& operator=(const MonthlyProblem&) = delete;
+
+    ~MonthlyProblem()
+    {
+        if (problem_)
+            H2O_M_Free(*problem_);
+    }
+
+    // The simplex basis of the previous area is dropped, so that the results of an area
+    // do not depend on the areas previously handled by the thread
+    DONNEES_ANNUELLES& forNewArea()
+    {
+        if (!problem_)
+            problem_ = std::make_unique<DONNEES_ANNUELLES>(H2O_M_Instanciation(1));
+        else
+            H2O_M_Free(*problem_);
+        return *problem_;
+    }
+
+private:
+    std::unique_ptr<DONNEES_ANNUELLES> problem_;
+};
+
+thread_local MonthlyProblem monthlyProblem;
+} // namespace
+
 namespace Antares
 {
 template<class ProblemT>
@@ -142,157 +178,152 @@ double HydroManagement::prepareMonthlyTargetGenerations(Data::Area& area, TmpDat
     return total;
 }
 
-void HydroManagement::prepareMonthlyOptimalGenerations(double* random_reservoir_level, uint y)
+void HydroManagement::prepareMonthlyOptimalGenerations(double* random_reservoir_level,
+                                                       Data::Area& area,
+                                                       uint y)
 {
-    uint indexArea = 0;
-    areas_.each([&](Data::Area& area) {
-        uint z = area.index;
-
-        auto& data = tmpDataByArea_[z];
+    uint z = area.index;
 
-        auto& minLvl = area.hydro.reservoirLevel[Data::PartHydro::minimum];
-        auto& maxLvl = area.hydro.reservoirLevel[Data::PartHydro::maximum];
+    auto& data = tmpDataByArea_[z];
 
-        int initReservoirLvlMonth = area.hydro.initializeReservoirLevelDate;
+    auto& minLvl = area.hydro.reservoirLevel[Data::PartHydro::minimum];
+    auto& maxLvl = area.hydro.reservoirLevel[Data::PartHydro::maximum];
 
-        double lvi = -1.;
-        if (area.hydro.reservoirManagement)
-            lvi = random_reservoir_level[indexArea];
+    int initReservoirLvlMonth = area.hydro.initializeReservoirLevelDate;
 
-        indexArea++;
+    double lvi = -1.;
+    if (area.hydro.reservoirManagement)
+        lvi = random_reservoir_level[z];
 
-        double solutionCost = 0.;
-        double solutionCostNoised = 0.;
+    double solutionCost = 0.;
+    double solutionCostNoised = 0.;
 
-        if (area.hydro.reservoirManagement)
-        {
-            auto problem = H2O_M_Instanciation(1);
-
-            double totalInflowsYear = prepareMonthlyTargetGenerations(area, data);
-            assert(totalInflowsYear >= 0.);
+    if (area.hydro.reservoirManagement)
+    {
+        auto& problem = monthlyProblem.forNewArea();
 
-            problem.CoutDepassementVolume = 1e2;
-            problem.CoutViolMaxDuVolumeMin = 1e5;
-            problem.VolumeInitial = lvi;
+        double totalInflowsYear = prepareMonthlyTargetGenerations(area, data);
+        assert(totalInflowsYear >= 0.);
 
-            for (unsigned month = 0; month != 12; ++month)
-            {
-                uint realmonth = (initReservoirLvlMonth + month) % 12;
+        problem.CoutDepassementVolume = 1e2;
+        problem.CoutViolMaxDuVolumeMin = 1e5;
+        problem.VolumeInitial = lvi;
 
-                uint simulationMonth = calendar_.mapping.months[realmonth];
-                uint firstDay = calendar_.months[simulationMonth].daysYear.first;
+        for (unsigned month = 0; month != 12; ++month)
+        {
+            uint realmonth = (initReservoirLvlMonth + month) % 12;
 
-                problem.TurbineMax[month] = totalInflowsYear;
-                problem.TurbineMin[month] = data.mingens[realmonth];
-                problem.TurbineCible[month] = data.MTG[realmonth];
-                problem.Apport[month] = data.inflows[realmonth];
-                problem.VolumeMin[month] = minLvl[firstDay];
-                problem.VolumeMax[month] = maxLvl[firstDay];
-            }
+            uint simulationMonth = calendar_.mapping.months[realmonth];
+            uint firstDay = calendar_.months[simulationMonth].daysYear.first;
 
-            H2O_M_OptimiserUneAnnee(problem, 0);
-            switch (problem.ResultatsValides) {
-                case OUI: {
-                    if (Logs::Verbosity::Debug::enabled)
-                        CheckHydroAllocationProblem(area, problem, initReservoirLvlMonth, lvi);
+            problem.TurbineMax[month] = totalInflowsYear;
+            problem.TurbineMin[month] = data.mingens[realmonth];
+            problem.TurbineCible[month] = data.MTG[realmonth];
+            problem.Apport[month] = data.inflows[realmonth];
+            problem.VolumeMin[month] = minLvl[firstDay];
+            problem.VolumeMax[month] = maxLvl[firstDay];
+        }
 
-                    for (uint month = 0; month != 12; ++month) {
-                        uint realmonth = (initReservoirLvlMonth + month) % 12;
+        H2O_M_OptimiserUneAnnee(problem, 0);
+        switch (problem.ResultatsValides) {
+            case OUI: {
+                if (Logs::Verbosity::Debug::enabled)
+                    CheckHydroAllocationProblem(area, problem, initReservoirLvlMonth, lvi);
 
-                        data.MOG[realmonth] = problem.Turbine[month] * area.hydro.reservoirCapacity;
-                        data.MOL[realmonth] = problem.Volume[month];
-                    }
-                    data.MOL[initReservoirLvlMonth] = lvi;
-                    solutionCost = problem.ProblemeHydraulique.CoutDeLaSolution;
-                    solutionCostNoised = problem.ProblemeHydraulique.CoutDeLaSolutionBruite;
+                for (uint month = 0; month != 12; ++month) {
+                    uint realmonth = (initReservoirLvlMonth + month) % 12;
 
-                    break;
+                    data.MOG[realmonth] = problem.Turbine[month] * area.hydro.reservoirCapacity;
+                    data.MOL[realmonth] = problem.Volume[month];
                 }
-                case NON: {
-                    std::ostringstream msg;
-                    msg << "Year : " << y + 1 << " - hydro: " << area.name
-                        << " [month] no solution found";
-                    throw FatalError(msg.str());
-                }
-                case EMERGENCY_SHUT_DOWN: {
-                    std::ostringstream msg;
-                    msg << "Year : " << y + 1 << " - hydro: " << area.name
-                        << " [month] fatal error";
-                    throw FatalError(msg.str());
-                }
-            }
+                data.MOL[initReservoirLvlMonth] = lvi;
+                solutionCost = problem.ProblemeHydraulique.CoutDeLaSolution;
+                solutionCostNoised = problem.ProblemeHydraulique.CoutDeLaSolutionBruite;
 
-            H2O_M_Free(problem);
-        }
-
-        else
-        {
-            auto& reservoirLevel = area.hydro.reservoirLevel[Data::PartHydro::average];
-
-            for (uint realmonth = 0; realmonth != 12; ++realmonth)
-            {
-                data.MOG[realmonth] = data.inflows[realmonth];
-                data.MOL[realmonth] = reservoirLevel[realmonth];
+                break;
+            }
+            case NON: {
+                std::ostringstream msg;
+                msg << "Year : " << y + 1 << " - hydro: " << area.name
+                    << " [month] no solution found";
+                throw FatalError(msg.str());
+            }
+            case EMERGENCY_SHUT_DOWN: {
+                std::ostringstream msg;
+                msg << "Year : " << y + 1 << " - hydro: " << area.name
+                    << " [month] fatal error";
+                throw FatalError(msg.str());
             }
         }
+    }
+
+    else
+    {
+        auto& reservoirLevel = area.hydro.reservoirLevel[Data::PartHydro::average];
 
-#ifndef NDEBUG
         for (uint realmonth = 0; realmonth != 12; ++realmonth)
         {
-            assert(!Math::NaN(data.MOG[realmonth]) && "nan value detected for MOG");
-            assert(!Math::NaN(data.MOL[realmonth]) && "nan value detected for MOL");
-            assert(!Math::Infinite(data.MOG[realmonth]) && "infinite value detected for MOG");
-            assert(!Math::Infinite(data.MOL[realmonth]) && "infinite value detected for MOL");
+            data.MOG[realmonth] = data.inflows[realmonth];
+            data.MOL[realmonth] = reservoirLevel[realmonth];
         }
+    }
+
+#ifndef NDEBUG
+    for (uint realmonth = 0; realmonth != 12; ++realmonth)
+    {
+        assert(!Math::NaN(data.MOG[realmonth]) && "nan value detected for MOG");
+        assert(!Math::NaN(data.MOL[realmonth]) && "nan value detected for MOL");
+        assert(!Math::Infinite(data.MOG[realmonth]) && "infinite value detected for MOG");
+        assert(!Math::Infinite(data.MOL[realmonth]) && "infinite value detected for MOL");
+    }
 #endif
-        if (parameters_.hydroDebug)
+    if (parameters_.hydroDebug)
+    {
+        std::ostringstream buffer, path;
+        path << "debug" << SEP << "solver" << SEP << (1 + y) << SEP << "monthly." << area.name
+             << ".txt";
+
+        if (area.hydro.reservoirManagement)
+            buffer << "Initial Reservoir Level\t" << lvi << "\n";
+        else
+            buffer << "Initial Reservoir Level : unrelevant (no reservoir mgmt)\n";
+        buffer << "\n";
+
+        auto writeSolutionCost = [&buffer](const std::string& caption, double cost) {
+            auto precision = buffer.precision();
+            buffer << caption << std::fixed << std::setprecision(13) << cost;
+            buffer << std::setprecision(precision) << std::defaultfloat;
+        };
+        writeSolutionCost("Solution cost : ", solutionCost);
+        writeSolutionCost("Solution cost (noised) : ", solutionCostNoised);
+        buffer << "\n\n";
+
+        buffer << '\t' << "\tInflows" << '\t' << "\tTarget Gen."
+               << "\tTurbined"
+               << "\tLevels" << '\t' << "\tLvl min" << '\t' << "\tLvl max\n";
+        for (uint month = 0; month != 12; ++month)
         {
-            std::ostringstream buffer, path;
-            path << "debug" << SEP << "solver" << SEP << (1 + y) << SEP << "monthly." << area.name
-                 << ".txt";
-
-            if (area.hydro.reservoirManagement)
-                buffer << "Initial Reservoir Level\t" << lvi << "\n";
-            else
-                buffer << "Initial Reservoir Level : unrelevant (no reservoir mgmt)\n";
-            buffer << "\n";
-
-            auto writeSolutionCost = [&buffer](const std::string& caption, double cost) {
-                auto precision = buffer.precision();
-                buffer << caption << std::fixed << std::setprecision(13) << cost;
-                buffer << std::setprecision(precision) << std::defaultfloat;
-            };
-            writeSolutionCost("Solution cost : ", solutionCost);
-            writeSolutionCost("Solution cost (noised) : ", solutionCostNoised);
-            buffer << "\n\n";
-
-            buffer << '\t' << "\tInflows" << '\t' << "\tTarget Gen."
-                   << "\tTurbined"
-                   << "\tLevels" << '\t' << "\tLvl min" << '\t' << "\tLvl max\n";
-            for (uint month = 0; month != 12; ++month)
-            {
-                uint realmonth = (initReservoirLvlMonth + month) % 12;
-
-                uint simulationMonth = calendar_.mapping.months[realmonth];
-
-                uint firstDay = calendar_.months[simulationMonth].daysYear.first;
-
-                auto monthName = calendar_.text.months[simulationMonth].name;
-
-                buffer << monthName[0] << monthName[1] << monthName[2] << '\t';
-                buffer << '\t';
-                buffer << data.inflows[realmonth] << '\t';
-                buffer << data.MTG[realmonth] << '\t';
-                buffer << data.MOG[realmonth] / area.hydro.reservoirCapacity << '\t';
-                buffer << data.MOL[realmonth] << '\t';
-                buffer << minLvl[firstDay] << '\t';
-                buffer << maxLvl[firstDay] << '\t';
-                buffer << '\n';
-            }
-            auto content = buffer.str();
-            resultWriter_.addEntryFromBuffer(path.str(), content);
+            uint realmonth = (initReservoirLvlMonth + month) % 12;
+
+            uint simulationMonth = calendar_.mapping.months[realmonth];
+
+            uint firstDay = calendar_.months[simulationMonth].daysYear.first;
+
+            auto monthName = calendar_.text.months[simulationMonth].name;
+
+            buffer << monthName[0] << monthName[1] << monthName[2] << '\t';
+            buffer << '\t';
+            buffer << data.inflows[realmonth] << '\t';
+            buffer << data.MTG[realmonth] << '\t';
+            buffer << data.MOG[realmonth] / area.hydro.reservoirCapacity << '\t';
+            buffer << data.MOL[realmonth] << '\t';
+            buffer << minLvl[firstDay] << '\t';
+            buffer << maxLvl[firstDay] << '\t';
+            buffer << '\n';
         }
-    });
+        auto content = buffer.str();
+        resultWriter_.addEntryFromBuffer(path.str(), content);
+    }
 }
 
 } // namespace Antares
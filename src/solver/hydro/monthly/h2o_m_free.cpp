@@ -50,6 +50,7 @@ void H2O_M_Free(DONNEES_ANNUELLES& DonneesAnnuelles)
         PROBLEME_SPX* ProbSpx = (PROBLEME_SPX*)ProblemeHydraulique.ProblemeSpx[i];
         if (ProbSpx)
             SPX_LibererProbleme(ProbSpx);
+        ProblemeHydraulique.ProblemeSpx[i] = nullptr;
     }
 
     return;
@@ -1,4 +1,4 @@
-#include <regex>
+#include <string_view>
 #include "constraint-slack-analysis.h"
 #include <antares/logs/logs.h>
 #include "report.h"
@@ -7,9 +7,28 @@ using namespace operations_research;
 
 namespace Antares::Optimization
 {
+namespace
+{
+// Binding constraints, fictive loads and hydro levels, selected from the names of the
+// constraints when the problem comes without their types
+bool hasRelaxableName(std::string_view name)
+{
+    return name.rfind("AreaHydroLevel::", 0) == 0 || name.rfind("FictiveLoads::", 0) == 0
+           || name.find("::hourly::") != std::string_view::npos
+           || name.find("::daily::") != std::string_view::npos
+           || name.find("::weekly::") != std::string_view::npos;
+}
+} // namespace
+
+ConstraintSlackAnalysis::ConstraintSlackAnalysis(std::vector<int> relaxableConstraints,
+                                                 LpBasis startingBasis) :
+ relaxableConstraints_(std::move(relaxableConstraints)), startingBasis_(std::move(startingBasis))
+{
+}
 
 void ConstraintSlackAnalysis::run(MPSolver* problem)
 {
+    const int variableCount = problem->NumVariables();
     addSlackVariables(problem);
     if (slackVariables_.empty())
     {
@@ -17,7 +36,7 @@ void ConstraintSlackAnalysis::run(MPSolver* problem)
         return;
     }
 
-    buildObjective(problem);
+    setStartingBasis(problem, variableCount);
 
     const MPSolver::ResultStatus status = problem->Solve();
     if ((status != MPSolver::OPTIMAL) && (status != MPSolver::FEASIBLE))
@@ -29,51 +48,77 @@ void ConstraintSlackAnalysis::run(MPSolver* problem)
     hasDetectedInfeasibilityCause_ = true;
 }
 
-void ConstraintSlackAnalysis::addSlackVariables(MPSolver* problem)
+void ConstraintSlackAnalysis::selectConstraints(MPSolver* problem)
 {
-    /* Optimization:
-        We assess that less than 1 every 3 constraint will match
-        the regex. If more, push_back may force the copy of memory blocks.
-        This should not happen in most cases.
-    */
-    const unsigned int selectedConstraintsInverseRatio = 3;
-    slackVariables_.reserve(problem->NumConstraints() / selectedConstraintsInverseRatio);
-    std::regex rgx(constraint_name_pattern);
-    const double infinity = MPSolver::infinity();
-    for (MPConstraint* constraint : problem->constraints())
+    if (relaxableConstraints_)
+        return;
+
+    relaxableConstraints_.emplace();
+    const auto& constraints = problem->constraints();
+    for (int i = 0; i != (int)constraints.size(); ++i)
     {
-        if (std::regex_search(constraint->name(), rgx))
-        {
-            if (constraint->lb() != -infinity)
-            {
-                const MPVariable* slack
-                    = problem->MakeNumVar(0, infinity, constraint->name() + "::low");
-                constraint->SetCoefficient(slack, 1.);
-                slackVariables_.push_back(slack);
-            }
-
-            if (constraint->ub() != infinity)
-            {
-                const MPVariable* slack
-                    = problem->MakeNumVar(0, infinity, constraint->name() + "::up");
-                constraint->SetCoefficient(slack, -1.);
-                slackVariables_.push_back(slack);
-            }
-        }
+        if (hasRelaxableName(constraints[i]->name()))
+            relaxableConstraints_->push_back(i);
     }
 }
 
-void ConstraintSlackAnalysis::buildObjective(MPSolver* problem) const
+void ConstraintSlackAnalysis::addSlackVariables(MPSolver* problem)
 {
+    selectConstraints(problem);
+
+    const auto& constraints = problem->constraints();
+    const double infinity = MPSolver::infinity();
+
+    // The slacks are counted first, so that they are stored without reallocation
+    size_t slackCount = 0;
+    for (int index : *relaxableConstraints_)
+    {
+        const MPConstraint* constraint = constraints[index];
+        slackCount += (constraint->lb() != -infinity) + (constraint->ub() != infinity);
+    }
+    slackVariables_.clear();
+    slackVariables_.reserve(slackCount);
+
+    // Only slack variables have a non-zero cost: the objective is built along with them
     MPObjective* objective = problem->MutableObjective();
-    // Reset objective function
     objective->Clear();
-    // Only slack variables have a non-zero cost
-    for (const MPVariable* slack : slackVariables_)
+    objective->SetMinimization();
+
+    std::string name;
+    for (int index : *relaxableConstraints_)
     {
-        objective->SetCoefficient(slack, 1.);
+        MPConstraint* constraint = constraints[index];
+        if (constraint->lb() != -infinity)
+        {
+            name.assign(constraint->name()).append("::low");
+            const MPVariable* slack = problem->MakeNumVar(0, infinity, name);
+            constraint->SetCoefficient(slack, 1.);
+            objective->SetCoefficient(slack, 1.);
+            slackVariables_.push_back(slack);
+        }
+
+        if (constraint->ub() != infinity)
+        {
+            name.assign(constraint->name()).append("::up");
+            const MPVariable* slack = problem->MakeNumVar(0, infinity, name);
+            constraint->SetCoefficient(slack, -1.);
+            objective->SetCoefficient(slack, 1.);
+            slackVariables_.push_back(slack);
+        }
     }
-    objective->SetMinimization();
+}
+
+void ConstraintSlackAnalysis::setStartingBasis(MPSolver* problem, int variableCount) const
+{
+    // The basis of the problem remains a basis once relaxed, the slacks being out of it (at 0)
+    if (startingBasis_.variables.empty()
+        || (int)startingBasis_.variables.size() != variableCount
+        || (int)startingBasis_.constraints.size() != problem->NumConstraints())
+        return;
+
+    std::vector<int> variables(startingBasis_.variables);
+    variables.resize(problem->NumVariables(), MPSolver::AT_LOWER_BOUND);
+    problem->SetStartingLpBasisInt(variables, startingBasis_.constraints);
 }
 
 void ConstraintSlackAnalysis::printReport() const
@@ -82,4 +127,4 @@ void ConstraintSlackAnalysis::printReport() const
     report.prettyPrint();
 }
 
-} // namespace Antares::Optimization
\ No newline at end of file
+} // namespace Antares::Optimization
@@ -1,10 +1,21 @@
 #pragma once
 
+#include <optional>
+#include <vector>
 #include "unfeasibility-analysis.h"
 
 namespace Antares::Optimization
 {
 
+/*!
+ * Simplex basis of a problem, as given to MPSolver::SetStartingLpBasisInt
+ */
+struct LpBasis
+{
+    std::vector<int> variables;
+    std::vector<int> constraints;
+};
+
 /*!
  * That particular analysis relaxes all constraints by
  * adding slack variables for each one.
@@ -12,7 +23,13 @@ namespace Antares::Optimization
 class ConstraintSlackAnalysis : public UnfeasibilityAnalysis
 {
 public:
+    //! The relaxed constraints are selected from their names
     ConstraintSlackAnalysis() = default;
+    /*!
+     * \param relaxableConstraints Indices of the constraints to relax
+     * \param startingBasis Basis of the problem before relaxation, empty if there is none
+     */
+    ConstraintSlackAnalysis(std::vector<int> relaxableConstraints, LpBasis startingBasis);
     ~ConstraintSlackAnalysis() override = default;
 
     void run(operations_research::MPSolver* problem) override;
@@ -20,11 +37,13 @@ public:
     std::string title() const override { return "Slack variables analysis"; }
 
 private:
-    void buildObjective(operations_research::MPSolver* problem) const;
+    void selectConstraints(operations_research::MPSolver* problem);
     void addSlackVariables(operations_research::MPSolver* problem);
+    void setStartingBasis(operations_research::MPSolver* problem, int variableCount) const;
 
+    std::optional<std::vector<int>> relaxableConstraints_;
+    LpBasis startingBasis_;
     std::vector<const operations_research::MPVariable*> slackVariables_;
-    const std::string constraint_name_pattern = "^AreaHydroLevel::|::hourly::|::daily::|::weekly::|^FictiveLoads::";
 };
 
 } // namespace Antares::Optimization
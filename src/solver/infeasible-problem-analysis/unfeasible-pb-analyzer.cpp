@@ -12,11 +12,26 @@ using namespace operations_research;
 namespace Antares::Optimization
 {
 
-std::unique_ptr<UnfeasiblePbAnalyzer> makeUnfeasiblePbAnalyzer()
+std::unique_ptr<UnfeasiblePbAnalyzer> makeUnfeasiblePbAnalyzer(
+  const PROBLEME_SIMPLEXE_NOMME& problem)
 {
+    std::vector<int> relaxableConstraints;
+    const LpNames& constraintNames = problem.ConstraintNames();
+    const int count = std::min<int>(problem.NombreDeContraintes, (int)constraintNames.size());
+    for (int i = 0; i < count; ++i)
+    {
+        if (constraintNames.relaxable(i))
+            relaxableConstraints.push_back(i);
+    }
+
+    LpBasis startingBasis;
+    if (problem.basisExists())
+        startingBasis = {problem.StatutDesVariables, problem.StatutDesContraintes};
+
     std::vector<std::unique_ptr<UnfeasibilityAnalysis>> analysisList;
     analysisList.push_back(std::make_unique<VariablesBoundsConsistency>());
-    analysisList.push_back(std::make_unique<ConstraintSlackAnalysis>());
+    analysisList.push_back(std::make_unique<ConstraintSlackAnalysis>(
+      std::move(relaxableConstraints), std::move(startingBasis)));
 
     return std::make_unique<UnfeasiblePbAnalyzer>(std::move(analysisList));
 }
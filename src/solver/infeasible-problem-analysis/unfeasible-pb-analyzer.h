@@ -27,6 +27,11 @@ private:
     std::vector<std::unique_ptr<UnfeasibilityAnalysis>> analysisList_;
 };
 
-std::unique_ptr<UnfeasiblePbAnalyzer> makeUnfeasiblePbAnalyzer();
+/*!
+ * The constraints relaxed by the slack analysis are the ones that are marked as such in the names
+ * of the problem, which is warm-started from the basis of the problem, if any.
+ */
+std::unique_ptr<UnfeasiblePbAnalyzer> makeUnfeasiblePbAnalyzer(
+  const PROBLEME_SIMPLEXE_NOMME& problem);
 
 } // namespace Antares::Optimization
\ No newline at end of file
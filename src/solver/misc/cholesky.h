@@ -29,12 +29,35 @@
 
 #include <yuni/yuni.h>
 #include <yuni/core/math.h>
+#include <cstdint>
 #include <antares/array/matrix.h>
 
 namespace Antares
 {
 namespace Solver
 {
+//! Order of the additions of the dot products of a Cholesky factorization
+enum class CholeskySummation
+{
+    //! One column after the other, as historically (the results of previous versions)
+    sequential,
+    //! By panels of columns and independent partial sums, faster for large matrices
+    byPanels,
+};
+
+/*!
+** \brief Identifier of the implementation of a summation order
+**
+** It is kept along with the factorizations cached on disk (see FactorizationCache) : the
+** version of an implementation must be increased whenever a change of the code may change
+** its results.
+*/
+constexpr uint32_t CholeskyAlgorithm(CholeskySummation summation)
+{
+    // The summation order in the high bits, the version of its implementation in the low ones
+    return summation == CholeskySummation::byPanels ? (2u << 16) | 1u : (1u << 16) | 1u;
+}
+
 /*!
 ** \brief Factorisation de Cholesky d'une matrice A symetrique reelle
 **
@@ -51,10 +74,15 @@ namespace Solver
 ** \param A A bi-dimensional array of the form T**
 ** \param size The number of process
 ** \param temp A temporary array for calculations (with at least @size items)
+** \param summation Order of the additions : the last bits of L depend on it
 ** \return true si A n'est ni definie positive ni semi-positive, false sinon
 */
 template<class T, class U1, class U2>
-bool Cholesky(U1& L, U2& A, uint size, T* temp);
+bool Cholesky(U1& L,
+              U2& A,
+              uint size,
+              T* temp,
+              CholeskySummation summation = CholeskySummation::sequential);
 
 } // namespace Solver
 } // namespace Antares
@@ -25,6 +25,9 @@
 ** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
 */
 
+#include <algorithm>
+#include <vector>
+
 //! Precision sur la factorisation des matrices
 #define ANTARES_CHOLESKY_EPSIMIN ((T)1.0e-9)
 
@@ -32,8 +35,54 @@ namespace Antares
 {
 namespace Solver
 {
+namespace Detail
+{
+//! Number of partial sums of a dot product (fixed, the results must not depend on the CPU)
+constexpr uint choleskyLanes = 4;
+//! Number of columns of L computed together (multiple of choleskyLanes)
+constexpr uint choleskyPanel = 32;
+
+/*!
+** \brief Add the products a[j] * b[j], from <= j < to, to the partial sums of a dot product
+**
+** `from` and `to` must be multiples of choleskyLanes. The partial sums are independent,
+** which lets the compiler vectorize the loop.
+*/
+template<class T>
+inline void CholeskyAccumulate(T* sums, const T* a, const T* b, uint from, uint to)
+{
+    T s0 = sums[0];
+    T s1 = sums[1];
+    T s2 = sums[2];
+    T s3 = sums[3];
+    for (uint j = from; j != to; j += choleskyLanes)
+    {
+        s0 += a[j] * b[j];
+        s1 += a[j + 1] * b[j + 1];
+        s2 += a[j + 2] * b[j + 2];
+        s3 += a[j + 3] * b[j + 3];
+    }
+    sums[0] = s0;
+    sums[1] = s1;
+    sums[2] = s2;
+    sums[3] = s3;
+}
+
+//! Dot product of a[0..to[ and b[0..to[, the partial sums for j < from being already known
+template<class T>
+inline T CholeskyDotProduct(const T* sums, const T* a, const T* b, uint from, uint to)
+{
+    T partial[choleskyLanes] = {sums[0], sums[1], sums[2], sums[3]};
+    uint end = from + (to - from) / choleskyLanes * choleskyLanes;
+    CholeskyAccumulate(partial, a, b, from, end);
+    for (uint j = end; j < to; ++j)
+        partial[0] += a[j] * b[j];
+    return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+}
+
+//! The textbook algorithm, each dot product being summed in the order of the columns
 template<class T, class U1, class U2>
-bool Cholesky(U1& L, U2& A, uint size, T* temp)
+bool CholeskySequential(U1& L, U2& A, uint size, T* temp)
 {
     using namespace Yuni;
 
@@ -94,6 +143,123 @@ bool Cholesky(U1& L, U2& A, uint size, T* temp)
     return false;
 }
 
+//! Buffer for the partial sums of CholeskyByPanels(), kept from a call to the next
+template<class T>
+inline T* CholeskyScratch(size_t count)
+{
+    thread_local std::vector<T> buffer;
+    if (buffer.size() < count)
+        buffer.resize(count);
+    return buffer.data();
+}
+
+template<class T, class U1, class U2>
+bool CholeskyByPanels(U1& L, U2& A, uint size, T* temp)
+{
+    using namespace Yuni;
+
+    for (uint i = 0; i != size; ++i)
+        temp[i] = 0;
+
+    T som;
+
+    // Partial sums of the dot products of the rows k >= i0 with the rows of the panel,
+    // for the columns before the panel (none for the first panel)
+    T* partial = nullptr;
+    if (size > choleskyPanel)
+        partial = CholeskyScratch<T>(size * choleskyPanel * choleskyLanes);
+    const T noSums[choleskyLanes] = {};
+
+    // The columns are computed by panels : the contributions of the columns before the
+    // panel are gathered while each row is read once, the rows of the panel staying in the
+    // cache. The order of the additions only depends on the size of the matrix.
+    for (uint i0 = 0; i0 < size; i0 += choleskyPanel)
+    {
+        const uint i1 = std::min(i0 + choleskyPanel, size);
+        const uint width = i1 - i0;
+        auto sums = [&](uint k, uint i) -> T* {
+            return partial + ((k - i0) * width + (i - i0)) * choleskyLanes;
+        };
+        auto previousSums = [&](uint k, uint i) -> const T* {
+            return (i0 == 0) ? noSums : sums(k, i);
+        };
+
+        if (i0 != 0)
+        {
+            for (uint k = i0; k < size; ++k)
+            {
+                const T* Lk = &L[k][0];
+                for (uint i = i0; i < i1 and i <= k; ++i)
+                {
+                    T* s = sums(k, i);
+                    std::fill(s, s + choleskyLanes, T(0));
+                    CholeskyAccumulate(s, &L[i][0], Lk, 0, i0);
+                }
+            }
+        }
+
+        for (uint i = i0; i < i1; ++i)
+        {
+            typename MatrixSubColumn<U1>::Type Li = L[i];
+
+            // on calcule d'abord L[i][i]
+            som = A[i][i]
+                  - CholeskyDotProduct(previousSums(i, i), &Li[0], &Li[0], i0, i);
+
+            if (som > ANTARES_CHOLESKY_EPSIMIN)
+            {
+                Li[i] = Math::SquareRootNoCheck(som);
+
+                // maintenant on cherche L[k][i], k > i.
+                for (uint k = i + 1; k < size; ++k)
+                {
+                    typename MatrixSubColumn<U1>::Type Lk = L[k];
+                    typename MatrixSubColumn<U2>::Type Ak = A[k];
+
+                    if (temp[k] == Ak[k])
+                    {
+                        Lk[i] = 0;
+                    }
+                    else
+                    {
+                        const T* s = previousSums(k, i);
+                        som = Ak[i] - CholeskyDotProduct(s, &Li[0], &Lk[0], i0, i);
+
+                        Lk[i] = som / Li[i];
+                        temp[k] += Lk[i] * Lk[i];
+
+                        // si temp[k] = A[k][k] la matrice n'est pas dp mais il est encore
+                        // possible qu'elle soit sdp.
+                        // si temp > A[k][k] alors il est certain que A n'est ni sdp ni dp donc
+                        // on arrete le calcul
+                        if (temp[k] > Ak[k])
+                            return true;
+                    }
+                }
+            }
+            else
+            {
+                // annule le reste de la colonne
+                for (uint k = i; k != size; ++k)
+                    L[k][i] = 0;
+            }
+        }
+    }
+
+    return false;
+}
+} // namespace Detail
+
+// Any change of the results of an implementation must come with a new CholeskyAlgorithm(),
+// so that the factorizations cached on disk by the previous versions are not used
+template<class T, class U1, class U2>
+bool Cholesky(U1& L, U2& A, uint size, T* temp, CholeskySummation summation)
+{
+    if (summation == CholeskySummation::byPanels)
+        return Detail::CholeskyByPanels<T>(L, A, size, temp);
+    return Detail::CholeskySequential<T>(L, A, size, temp);
+}
+
 } // namespace Solver
 } // namespace Antares
 
@@ -0,0 +1,184 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_SOLVER_MISC_FACTORIZATION_CACHE_H__
+#define __ANTARES_SOLVER_MISC_FACTORIZATION_CACHE_H__
+
+#include <yuni/yuni.h>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Antares
+{
+namespace Solver
+{
+//! Computations whose result may be kept by the factorization cache
+enum class FactorizationKind : uint32_t
+{
+    //! Test of the positive definiteness of a matrix (only `npsd` is relevant)
+    positiveDefinitenessCheck = 1,
+    //! MatrixDPMake() with a given matrix C
+    matrixDPMake,
+    //! MatrixDPMake() with C as identity, followed by a Cholesky() of B
+    matrixDPMakeWithIdentity,
+};
+
+/*!
+** \brief Cache of the factorizations of correlation matrices
+**
+** The factorizations computed by the TS generators only depend on correlation matrices,
+** which do not change from one refresh of the time-series to the next. They are kept in
+** memory, keyed by a hash of the input matrices. When the binary cache of the input is
+** enabled (see MatrixCache), they are also written into the folder `.antares-cache` of
+** the study, to be reused by the next runs.
+**
+** The input matrices are kept along with the factorization and compared on lookup :
+** a collision of hashes can not lead to a wrong factorization. So is the identifier of the
+** implementation of the factorization (see CholeskyAlgorithm()) : the files written by
+** another version of the code are ignored.
+*/
+template<class T>
+class FactorizationCache final
+{
+public:
+    //! Lower triangle of a square matrix (diagonal included), one row after the other
+    using Triangle = std::vector<T>;
+
+    //! Identifier of a factorization : the kind of computation, its implementation and its
+    //! input matrices
+    struct Key
+    {
+        template<class U>
+        Key(FactorizationKind kind, uint32_t algorithm, uint size, const U& matrix);
+        template<class U1, class U2>
+        Key(FactorizationKind kind,
+            uint32_t algorithm,
+            uint size,
+            const U1& matrix,
+            const U2& other);
+
+        //! Hash of the key, for a quick lookup
+        uint64_t hash() const;
+
+        bool operator==(const Key& rhs) const;
+
+        FactorizationKind kind;
+        //! Identifier of the implementation of the factorization (see CholeskyAlgorithm())
+        uint32_t algorithm;
+        uint size;
+        //! The lower triangles of the input matrices, one after the other
+        Triangle inputs;
+    };
+
+    //! Result of a computation
+    struct Factorization
+    {
+        //! The lower triangular matrix L
+        Triangle L;
+        //! The correlation matrix B actually factorized (optional)
+        Triangle B;
+        //! The shrink coefficient of the matrix (1 if it was left untouched)
+        T shrink = 1;
+        //! True if the matrix was not positive definite
+        bool npsd = false;
+    };
+
+    using FactorizationPtr = std::shared_ptr<const Factorization>;
+
+    /*!
+    ** \brief Look for the result of a previous computation (in memory, then on disk)
+    **
+    ** \return The factorization, nullptr if not found
+    */
+    static FactorizationPtr Find(const Key& key);
+
+    //! Keep the result of a computation
+    static FactorizationPtr Store(const Key& key, Factorization&& factorization);
+
+    //! Remove all factorizations kept in memory
+    static void Clear();
+
+    //! Append the lower triangle of a matrix to `out`
+    template<class U>
+    static void CopyTriangle(Triangle& out, const U& matrix, uint size);
+
+    //! Copy a lower triangle into a matrix (the upper part is left untouched)
+    template<class U>
+    static void RestoreTriangle(U& matrix, const Triangle& triangle, uint size);
+
+private:
+    //! Max number of factorizations kept in memory
+    static constexpr uint maxEntryCount = 64;
+
+    struct Item
+    {
+        uint64_t hash;
+        Key key;
+        FactorizationPtr factorization;
+    };
+
+    //! The factorizations kept in memory, the most recently used first
+    struct Storage
+    {
+        std::mutex mutex;
+        std::list<Item> items;
+    };
+
+    //! Header of a cache file
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t kind;
+        uint32_t size;
+        uint32_t scalarSize;
+        uint32_t npsd;
+        uint32_t algorithm;
+        double shrink;
+        uint64_t inputCount;
+        uint64_t lCount;
+        uint64_t bCount;
+    };
+
+    static Storage& GetStorage();
+    static FactorizationPtr Insert(Item&& item);
+
+    static FactorizationPtr Load(const Key& key, uint64_t hash);
+    static void Save(const Key& key, uint64_t hash, const Factorization& factorization);
+    static std::string Filename(const Key& key, uint64_t hash);
+
+}; // class FactorizationCache
+
+} // namespace Solver
+} // namespace Antares
+
+#include "factorization-cache.hxx"
+
+#endif // __ANTARES_SOLVER_MISC_FACTORIZATION_CACHE_H__
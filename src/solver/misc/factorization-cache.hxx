@@ -0,0 +1,282 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_SOLVER_MISC_FACTORIZATION_CACHE_HXX__
+#define __ANTARES_SOLVER_MISC_FACTORIZATION_CACHE_HXX__
+
+#include <antares/array/matrix-cache.h>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Antares
+{
+namespace Solver
+{
+namespace Detail
+{
+constexpr char factorizationCacheMagic[8] = {'A', 'N', 'T', 'F', 'A', 'C', 'T', 'O'};
+//! Version of the format of the files (the version of the factorizations is in the key)
+constexpr uint32_t factorizationCacheVersion = 2;
+} // namespace Detail
+
+template<class T>
+template<class U>
+FactorizationCache<T>::Key::Key(FactorizationKind kind,
+                                uint32_t algorithm,
+                                uint size,
+                                const U& matrix) :
+ kind(kind), algorithm(algorithm), size(size)
+{
+    inputs.reserve(size * (size + 1) / 2);
+    CopyTriangle(inputs, matrix, size);
+}
+
+template<class T>
+template<class U1, class U2>
+FactorizationCache<T>::Key::Key(FactorizationKind kind,
+                                uint32_t algorithm,
+                                uint size,
+                                const U1& matrix,
+                                const U2& other) :
+ kind(kind), algorithm(algorithm), size(size)
+{
+    inputs.reserve(size * (size + 1));
+    CopyTriangle(inputs, matrix, size);
+    CopyTriangle(inputs, other, size);
+}
+
+template<class T>
+uint64_t FactorizationCache<T>::Key::hash() const
+{
+    uint64_t h = MatrixCache::Hash(reinterpret_cast<const char*>(inputs.data()),
+                                   inputs.size() * sizeof(T));
+    h ^= ((static_cast<uint64_t>(kind) << 32) | size) * 0x9e3779b97f4a7c15ULL;
+    h ^= static_cast<uint64_t>(algorithm) * 0xc2b2ae3d27d4eb4fULL;
+    return h;
+}
+
+template<class T>
+bool FactorizationCache<T>::Key::operator==(const Key& rhs) const
+{
+    // Bitwise comparison, the results must be exactly the ones of a new computation
+    return kind == rhs.kind and algorithm == rhs.algorithm and size == rhs.size
+           and inputs.size() == rhs.inputs.size()
+           and not memcmp(inputs.data(), rhs.inputs.data(), inputs.size() * sizeof(T));
+}
+
+template<class T>
+template<class U>
+void FactorizationCache<T>::CopyTriangle(Triangle& out, const U& matrix, uint size)
+{
+    for (uint i = 0; i != size; ++i)
+    {
+        for (uint j = 0; j <= i; ++j)
+            out.push_back(matrix[i][j]);
+    }
+}
+
+template<class T>
+template<class U>
+void FactorizationCache<T>::RestoreTriangle(U& matrix, const Triangle& triangle, uint size)
+{
+    assert(triangle.size() == size * (size + 1) / 2);
+    auto it = triangle.begin();
+    for (uint i = 0; i != size; ++i)
+    {
+        for (uint j = 0; j <= i; ++j, ++it)
+            matrix[i][j] = *it;
+    }
+}
+
+template<class T>
+typename FactorizationCache<T>::Storage& FactorizationCache<T>::GetStorage()
+{
+    static Storage storage;
+    return storage;
+}
+
+template<class T>
+typename FactorizationCache<T>::FactorizationPtr FactorizationCache<T>::Find(const Key& key)
+{
+    uint64_t hash = key.hash();
+    {
+        auto& storage = GetStorage();
+        std::lock_guard locker(storage.mutex);
+        auto& items = storage.items;
+        for (auto it = items.begin(); it != items.end(); ++it)
+        {
+            if (it->hash == hash and it->key == key)
+            {
+                items.splice(items.begin(), items, it);
+                return items.front().factorization;
+            }
+        }
+    }
+
+    auto factorization = Load(key, hash);
+    if (factorization)
+        return Insert({hash, key, factorization});
+    return nullptr;
+}
+
+template<class T>
+typename FactorizationCache<T>::FactorizationPtr FactorizationCache<T>::Store(
+  const Key& key,
+  Factorization&& factorization)
+{
+    uint64_t hash = key.hash();
+    auto result = Insert({hash, key, std::make_shared<Factorization>(std::move(factorization))});
+    Save(key, hash, *result);
+    return result;
+}
+
+template<class T>
+typename FactorizationCache<T>::FactorizationPtr FactorizationCache<T>::Insert(Item&& item)
+{
+    auto& storage = GetStorage();
+    std::lock_guard locker(storage.mutex);
+    auto& items = storage.items;
+    items.push_front(std::move(item));
+    while (items.size() > maxEntryCount)
+        items.pop_back();
+    return items.front().factorization;
+}
+
+template<class T>
+void FactorizationCache<T>::Clear()
+{
+    auto& storage = GetStorage();
+    std::lock_guard locker(storage.mutex);
+    storage.items.clear();
+}
+
+template<class T>
+std::string FactorizationCache<T>::Filename(const Key& key, uint64_t hash)
+{
+    auto folder = MatrixCache::Folder();
+    if (folder.empty())
+        return folder;
+
+    char name[64];
+    snprintf(name,
+             sizeof(name),
+             "%u-%016llx-%u.bin",
+             static_cast<uint>(key.kind),
+             static_cast<unsigned long long>(hash),
+             static_cast<uint>(sizeof(T)));
+    return (std::filesystem::path(folder) / "factorizations" / name).string();
+}
+
+template<class T>
+typename FactorizationCache<T>::FactorizationPtr FactorizationCache<T>::Load(const Key& key,
+                                                                             uint64_t hash)
+{
+    auto filename = Filename(key, hash);
+    if (filename.empty())
+        return nullptr;
+
+    std::ifstream file(filename, std::ios::binary);
+    if (not file)
+        return nullptr;
+
+    FileHeader header;
+    if (not file.read(reinterpret_cast<char*>(&header), sizeof(header))
+        or memcmp(header.magic, Detail::factorizationCacheMagic, sizeof(header.magic))
+        or header.version != Detail::factorizationCacheVersion
+        or header.kind != static_cast<uint32_t>(key.kind) or header.algorithm != key.algorithm
+        or header.size != key.size
+        or header.scalarSize != sizeof(T) or header.inputCount != key.inputs.size())
+        return nullptr;
+
+    // The inputs are stored as well, to rule out a collision of hashes
+    Triangle inputs(header.inputCount);
+    if (not file.read(reinterpret_cast<char*>(inputs.data()), inputs.size() * sizeof(T))
+        or memcmp(inputs.data(), key.inputs.data(), inputs.size() * sizeof(T)))
+        return nullptr;
+
+    auto factorization = std::make_shared<Factorization>();
+    factorization->L.resize(header.lCount);
+    factorization->B.resize(header.bCount);
+    factorization->shrink = static_cast<T>(header.shrink);
+    factorization->npsd = (header.npsd != 0);
+    if (not file.read(reinterpret_cast<char*>(factorization->L.data()), header.lCount * sizeof(T))
+        or not file.read(reinterpret_cast<char*>(factorization->B.data()),
+                         header.bCount * sizeof(T)))
+        return nullptr;
+    return factorization;
+}
+
+template<class T>
+void FactorizationCache<T>::Save(const Key& key,
+                                 uint64_t hash,
+                                 const Factorization& factorization)
+{
+    MatrixCache::Entry entry;
+    entry.filename = Filename(key, hash);
+    std::string temporaryFilename;
+    if (entry.filename.empty() or not MatrixCache::PrepareForWriting(entry, temporaryFilename))
+        return;
+
+    FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, Detail::factorizationCacheMagic, sizeof(header.magic));
+    header.version = Detail::factorizationCacheVersion;
+    header.kind = static_cast<uint32_t>(key.kind);
+    header.algorithm = key.algorithm;
+    header.size = key.size;
+    header.scalarSize = static_cast<uint32_t>(sizeof(T));
+    header.npsd = factorization.npsd ? 1 : 0;
+    header.shrink = static_cast<double>(factorization.shrink);
+    header.inputCount = key.inputs.size();
+    header.lCount = factorization.L.size();
+    header.bCount = factorization.B.size();
+    {
+        std::ofstream file(temporaryFilename, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(key.inputs.data()),
+                   key.inputs.size() * sizeof(T));
+        file.write(reinterpret_cast<const char*>(factorization.L.data()),
+                   factorization.L.size() * sizeof(T));
+        file.write(reinterpret_cast<const char*>(factorization.B.data()),
+                   factorization.B.size() * sizeof(T));
+        if (not file.flush())
+        {
+            file.close();
+            std::remove(temporaryFilename.c_str());
+            return;
+        }
+    }
+    // A failure only means that the next run will compute the factorization again
+    MatrixCache::Commit(entry, temporaryFilename);
+}
+
+} // namespace Solver
+} // namespace Antares
+
+#endif // __ANTARES_SOLVER_MISC_FACTORIZATION_CACHE_HXX__
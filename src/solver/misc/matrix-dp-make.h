@@ -57,12 +57,20 @@ namespace Solver
 **   seuls les termes triangulaires inferieurs (diagonale incluse)sont retournes
 ** \param[out] L matrice triangulaire inferieure telle que LtL = B
 ** \param CIsIdentity True to Consider C as an identity matrix
+** \param summation Order of the additions of the Cholesky factorizations
 ** \return valeur maximale de 0 <= r <= 1 t.q r * A +(1-r) * C definie positive
 **    1 si A est une matrice de correlation
 **   -1 si pas convergence (C n'est pas une matrice valide)
 */
 template<class T, class U1, class U2, class U3, class U4>
-T MatrixDPMake(U1& L, U2& A, U3& B, U4& C, unsigned int size, T* temp, bool CIsIdentity = false);
+T MatrixDPMake(U1& L,
+               U2& A,
+               U3& B,
+               U4& C,
+               unsigned int size,
+               T* temp,
+               bool CIsIdentity = false,
+               CholeskySummation summation = CholeskySummation::sequential);
 
 } // namespace Solver
 } // namespace Antares
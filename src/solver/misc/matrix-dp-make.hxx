@@ -32,7 +32,14 @@ namespace Antares
 namespace Solver
 {
 template<class T, class U1, class U2, class U3, class U4>
-T MatrixDPMake(U1& L, U2& A, U3& B, U4& C, uint size, T* temp, bool CIsIdentity)
+T MatrixDPMake(U1& L,
+               U2& A,
+               U3& B,
+               U4& C,
+               uint size,
+               T* temp,
+               bool CIsIdentity,
+               CholeskySummation summation)
 {
     enum
     {
@@ -47,7 +54,7 @@ T MatrixDPMake(U1& L, U2& A, U3& B, U4& C, uint size, T* temp, bool CIsIdentity)
     T bot = T(0);
     T r;
 
-    if (not Cholesky<T>(L, A, size, temp))
+    if (not Cholesky<T>(L, A, size, temp, summation))
     {
         for (uint j = 0; j != size; ++j)
         {
@@ -85,7 +92,7 @@ T MatrixDPMake(U1& L, U2& A, U3& B, U4& C, uint size, T* temp, bool CIsIdentity)
                 }
             }
 
-            if (Cholesky<T>(L, B, size, temp))
+            if (Cholesky<T>(L, B, size, temp, summation))
             {
                 top = r;
             }
@@ -117,7 +124,7 @@ T MatrixDPMake(U1& L, U2& A, U3& B, U4& C, uint size, T* temp, bool CIsIdentity)
                             B[j][k] = A[j][k] * rho; // + C[j][k] * (T(1) - rho);
                     }
                 }
-                Cholesky<T>(L, B, size, temp);
+                Cholesky<T>(L, B, size, temp, summation);
             }
             return rho;
         }
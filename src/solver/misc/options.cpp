@@ -162,6 +162,13 @@ std::unique_ptr<GetOpt::Parser> CreateParser(Settings& settings,
                     "Do not import timeseries into the input folder. This option might be useful "
                     "for running old studies without upgrading them");
 
+    // --input-cache
+    parser->addFlag(options.useInputCache,
+                    ' ',
+                    "input-cache",
+                    "Keep a binary copy of the input matrices in the study (.antares-cache) to "
+                    "load them faster next time. Stale copies are rebuilt automatically");
+
     // --mps-export
     parser->addFlag(options.mpsToExport,
                     'm',
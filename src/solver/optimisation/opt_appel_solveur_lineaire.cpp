@@ -97,6 +97,41 @@ struct SimplexResult
     mpsWriterFactory mps_writer_factory;
 };
 
+// Costs, right-hand sides and bounds, which change with each week. The coefficients of the
+// matrix do not : see OPT_ResynchroniserLaMatriceOrtools
+static void OPT_MettreAJourLeProblemeOrtools(MPSolver* solver,
+                                             const PROBLEME_ANTARES_A_RESOUDRE& ProblemeAResoudre)
+{
+    ORTOOLS_ModifierLeVecteurCouts(
+      solver, ProblemeAResoudre.CoutLineaire.data(), ProblemeAResoudre.NombreDeVariables);
+    ORTOOLS_ModifierLeVecteurSecondMembre(solver,
+                                          ProblemeAResoudre.SecondMembre.data(),
+                                          ProblemeAResoudre.Sens.data(),
+                                          ProblemeAResoudre.NombreDeContraintes);
+    ORTOOLS_CorrigerLesBornes(solver,
+                              ProblemeAResoudre.Xmin.data(),
+                              ProblemeAResoudre.Xmax.data(),
+                              ProblemeAResoudre.TypeDeVariable.data(),
+                              ProblemeAResoudre.NombreDeVariables);
+}
+
+// The coefficients of the matrix are only set when the structure of the problem is built
+// (OPT_ConstruireLaStructureDuProblemeLineaire) : once, and again on the first week of the
+// simulation when the structure is exported, a week on which ReinitOptimisation is set. The
+// model kept from a previous year or from the first attempt is thus only checked against them
+// when the solver restarts from scratch, never for a regular week.
+static void OPT_ResynchroniserLaMatriceOrtools(MPSolver* solver,
+                                              const PROBLEME_ANTARES_A_RESOUDRE& ProblemeAResoudre)
+{
+    ORTOOLS_ModifierLaMatriceDesContraintes(
+      solver,
+      ProblemeAResoudre.IndicesDebutDeLigne.data(),
+      ProblemeAResoudre.NombreDeTermesDesLignes.data(),
+      ProblemeAResoudre.CoefficientsDeLaMatriceDesContraintes.data(),
+      ProblemeAResoudre.IndicesColonnes.data(),
+      ProblemeAResoudre.NombreDeContraintes);
+}
+
 static SimplexResult OPT_TryToCallSimplex(
         const OptimizationOptions& options,
         PROBLEME_HEBDO* problemeHebdo,
@@ -119,7 +154,9 @@ static SimplexResult OPT_TryToCallSimplex(
     if (!PremierPassage)
     {
         ProbSpx = nullptr;
-        solver = nullptr;
+        // The OR-Tools model of the first attempt is kept, it is restarted from scratch below
+        if (!options.useOrtools)
+            solver = nullptr;
     }
 
     if (ProbSpx == nullptr && solver == nullptr)
@@ -129,20 +166,24 @@ static SimplexResult OPT_TryToCallSimplex(
     }
     else
     {
-        if (problemeHebdo->ReinitOptimisation)
+        if (problemeHebdo->ReinitOptimisation || !PremierPassage)
         {
             if (options.useOrtools && solver != nullptr)
             {
-                ORTOOLS_LibererProbleme(solver);
+                // The structure of the problem does not change : instead of converting it
+                // again, the model is updated and the solver restarts from scratch
+                ORTOOLS_ReinitialiserLeProbleme(solver);
+                OPT_MettreAJourLeProblemeOrtools(solver, *ProblemeAResoudre);
+                OPT_ResynchroniserLaMatriceOrtools(solver, *ProblemeAResoudre);
             }
             else if (ProbSpx != nullptr)
             {
                 SPX_LibererProbleme(ProbSpx);
+                ProblemeAResoudre->ProblemesSpx[NumIntervalle] = nullptr;
+                ProbSpx = nullptr;
+                solver = nullptr;
             }
-            ProblemeAResoudre->ProblemesSpx[NumIntervalle] = nullptr;
 
-            ProbSpx = nullptr;
-            solver = nullptr;
             Probleme.Contexte = SIMPLEXE_SEUL;
             Probleme.BaseDeDepartFournie = NON_SPX;
         }
@@ -154,17 +195,7 @@ static SimplexResult OPT_TryToCallSimplex(
             TimeMeasurement measure;
             if (options.useOrtools)
             {
-                ORTOOLS_ModifierLeVecteurCouts(
-                  solver, ProblemeAResoudre->CoutLineaire.data(), ProblemeAResoudre->NombreDeVariables);
-                ORTOOLS_ModifierLeVecteurSecondMembre(solver,
-                                                      ProblemeAResoudre->SecondMembre.data(),
-                                                      ProblemeAResoudre->Sens.data(),
-                                                      ProblemeAResoudre->NombreDeContraintes);
-                ORTOOLS_CorrigerLesBornes(solver,
-                                          ProblemeAResoudre->Xmin.data(),
-                                          ProblemeAResoudre->Xmax.data(),
-                                          ProblemeAResoudre->TypeDeVariable.data(),
-                                          ProblemeAResoudre->NombreDeVariables);
+                OPT_MettreAJourLeProblemeOrtools(solver, *ProblemeAResoudre);
             }
             else
             {
@@ -264,11 +295,8 @@ static SimplexResult OPT_TryToCallSimplex(
     {
         if (ProblemeAResoudre->ExistenceDUneSolution != SPX_ERREUR_INTERNE)
         {
-            if (options.useOrtools && solver != nullptr)
-            {
-                ORTOOLS_LibererProbleme(solver);
-            }
-            else if (ProbSpx != nullptr)
+            // The OR-Tools model is kept for the second attempt
+            if (!options.useOrtools && ProbSpx != nullptr)
             {
                 SPX_LibererProbleme(ProbSpx);
             }
@@ -374,7 +402,7 @@ bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
 
         auto MPproblem = std::shared_ptr<MPSolver>(ProblemSimplexeNommeConverter(options.solverName, &Probleme).Convert());
 
-        auto analyzer = makeUnfeasiblePbAnalyzer();
+        auto analyzer = makeUnfeasiblePbAnalyzer(Probleme);
         analyzer->run(MPproblem.get());
         analyzer->printReport();
 
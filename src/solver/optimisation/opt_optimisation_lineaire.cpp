@@ -29,6 +29,7 @@
 #include "opt_fonctions.h"
 
 #include <antares/logs/logs.h>
+#include <antares/benchmarking/timer.h>
 #include "../utils/filename.h"
 
 using namespace Antares;
@@ -122,6 +123,13 @@ bool runWeeklyOptimization(const OptimizationOptions& options,
     return true;
 }
 
+bool structureOfTheProblemNeedsToBeBuilt(const PROBLEME_HEBDO* problemeHebdo)
+{
+    // The structure does not depend on the week, it is only built again for its export
+    return !problemeHebdo->ProblemeAResoudre->StructureDuProblemeConstruite
+           || (problemeHebdo->ExportStructure && problemeHebdo->firstWeekOfSimulation);
+}
+
 void runThermalHeuristic(PROBLEME_HEBDO* problemeHebdo)
 {
     if (problemeHebdo->OptimisationAvecCoutsDeDemarrage)
@@ -136,6 +144,24 @@ void runThermalHeuristic(PROBLEME_HEBDO* problemeHebdo)
 } // namespace
 
 
+void OPT_ConstruireLaStructureDuProblemeLineaire(PROBLEME_HEBDO* problemeHebdo,
+                                                 Solver::IResultWriter& writer)
+{
+    Benchmarking::Timer timer;
+
+    OPT_ConstruireLaListeDesVariablesOptimiseesDuProblemeLineaire(problemeHebdo);
+
+    OPT_ConstruireLaMatriceDesContraintesDuProblemeLineaire(problemeHebdo, writer);
+
+    const auto& ProblemeAResoudre = problemeHebdo->ProblemeAResoudre;
+    ProblemeAResoudre->StructureDuProblemeConstruite = true;
+    ProblemeAResoudre->NomDesVariables.setWeekOfTheTimeSteps(problemeHebdo->weekInTheYear);
+    ProblemeAResoudre->NomDesContraintes.setWeekOfTheTimeSteps(problemeHebdo->weekInTheYear);
+
+    timer.stop();
+    problemeHebdo->optimizationStatistics[0].addBuildTime(timer.get_duration());
+}
+
 bool OPT_OptimisationLineaire(const OptimizationOptions& options,
                               PROBLEME_HEBDO* problemeHebdo,
                               const AdqPatchParams& adqPatchParams,
@@ -157,9 +183,12 @@ bool OPT_OptimisationLineaire(const OptimizationOptions& options,
 
     OPT_RestaurerLesDonnees(problemeHebdo);
 
-    OPT_ConstruireLaListeDesVariablesOptimiseesDuProblemeLineaire(problemeHebdo);
+    if (structureOfTheProblemNeedsToBeBuilt(problemeHebdo))
+        OPT_ConstruireLaStructureDuProblemeLineaire(problemeHebdo, writer);
 
-    OPT_ConstruireLaMatriceDesContraintesDuProblemeLineaire(problemeHebdo, writer);
+    const auto& ProblemeAResoudre = problemeHebdo->ProblemeAResoudre;
+    ProblemeAResoudre->NomDesVariables.setWeek(problemeHebdo->weekInTheYear);
+    ProblemeAResoudre->NomDesContraintes.setWeek(problemeHebdo->weekInTheYear);
 
     bool ret = runWeeklyOptimization(
       options, problemeHebdo, adqPatchParams, writer, PREMIERE_OPTIMISATION);
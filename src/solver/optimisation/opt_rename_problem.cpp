@@ -1,71 +1,70 @@
 #include "opt_rename_problem.h"
-#include <sstream>
 
-const std::string HOUR("hour");
-const std::string DAY("day");
-const std::string WEEK("week");
-const std::map<std::string, std::string> BindingConstraintTimeGranularity
-  = {{HOUR, "hourly"}, {DAY, "daily"}, {WEEK, "weekly"}};
-const std::string LINK("link");
-const std::string AREA("area");
+using Antares::Optimization::LpName;
+using Antares::Optimization::TimeStepType;
 
-std::string BuildName(const std::string& name,
-                      const std::string& location,
-                      const std::string& timeIdentifier)
+namespace
 {
-    std::string result = name + SEPARATOR + location + SEPARATOR + timeIdentifier;
-    std::replace(result.begin(), result.end(), ' ', '*');
-    return result;
+const char* BindingConstraintTimeGranularity(TimeStepType type)
+{
+    switch (type)
+    {
+    case TimeStepType::hour:
+        return "hourly";
+    case TimeStepType::day:
+        return "daily";
+    case TimeStepType::week:
+        return "weekly";
+    }
+    return "";
 }
+} // namespace
 
-void Namer::SetLinkElementName(unsigned int element, const std::string& elementType)
+void Namer::SetLinkElementName(unsigned int element, const char* elementType)
 {
-    const auto location = origin_ + AREA_SEP + destination_;
-    targetUpdater_.UpdateTargetAtIndex(
-      BuildName(elementType, LocationIdentifier(location, LINK), TimeIdentifier(timeStep_, HOUR)),
-      element);
+    const auto* location
+      = targetUpdater_.Intern({"link<", origin_, AREA_SEP, destination_, ">"});
+    targetUpdater_.UpdateTargetAtIndex({elementType, location, TimeStepType::hour, timeStep_},
+                                       element);
 }
 
-void Namer::SetAreaElementNameHour(unsigned int element, const std::string& elementType)
+void Namer::SetAreaElementNameHour(unsigned int element, const char* elementType)
 {
-    SetAreaElementName(element, elementType, HOUR);
+    SetAreaElementName(element, elementType, TimeStepType::hour);
 }
 
-void Namer::SetAreaElementNameWeek(unsigned int element, const std::string& elementType)
+void Namer::SetAreaElementNameWeek(unsigned int element, const char* elementType)
 {
-    SetAreaElementName(element, elementType, WEEK);
+    SetAreaElementName(element, elementType, TimeStepType::week);
 }
 
 void Namer::SetAreaElementName(unsigned int element,
-                               const std::string& elementType,
-                               const std::string& timeStepType)
+                               const char* elementType,
+                               TimeStepType timeStepType)
 {
-    targetUpdater_.UpdateTargetAtIndex(
-      BuildName(
-        elementType, LocationIdentifier(area_, AREA), TimeIdentifier(timeStep_, timeStepType)),
-      element);
+    const auto* location = targetUpdater_.Intern({"area<", area_, ">"});
+    targetUpdater_.UpdateTargetAtIndex({elementType, location, timeStepType, timeStep_}, element);
 }
 
 void VariableNamer::SetAreaVariableName(unsigned int variable,
-                                        const std::string& variableType,
+                                        const char* variableType,
                                         int layerIndex)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName(variableType,
-                                                 LocationIdentifier(area_, AREA) + SEPARATOR
-                                                   + "Layer<" + std::to_string(layerIndex) + ">",
-                                                 TimeIdentifier(timeStep_, HOUR)),
+    const auto layer = std::to_string(layerIndex);
+    const auto* location
+      = targetUpdater_.Intern({"area<", area_, ">", SEPARATOR, "Layer<", layer, ">"});
+    targetUpdater_.UpdateTargetAtIndex({variableType, location, TimeStepType::hour, timeStep_},
                                        variable);
 }
 
 void Namer::SetThermalClusterElementName(unsigned int variable,
-                                         const std::string& elementType,
+                                         const char* elementType,
                                          const std::string& clusterName)
 {
-    const auto location
-      = LocationIdentifier(area_, AREA) + SEPARATOR + "ThermalCluster" + "<" + clusterName + ">";
-
-    targetUpdater_.UpdateTargetAtIndex(
-      BuildName(elementType, location, TimeIdentifier(timeStep_, HOUR)), variable);
+    const auto* location = targetUpdater_.Intern(
+      {"area<", area_, ">", SEPARATOR, "ThermalCluster<", clusterName, ">"});
+    targetUpdater_.UpdateTargetAtIndex({elementType, location, TimeStepType::hour, timeStep_},
+                                       variable);
 }
 
 void VariableNamer::DispatchableProduction(unsigned int variable, const std::string& clusterName)
@@ -124,13 +123,13 @@ void VariableNamer::IntercoIndirectCost(unsigned int variable,
 }
 
 void VariableNamer::SetShortTermStorageVariableName(unsigned int variable,
-                                                    const std::string& variableType,
+                                                    const char* variableType,
                                                     const std::string& shortTermStorageName)
 {
-    const auto location = LocationIdentifier(area_, AREA) + SEPARATOR + "ShortTermStorage" + "<"
-                          + shortTermStorageName + ">";
-    targetUpdater_.UpdateTargetAtIndex(
-      BuildName(variableType, location, TimeIdentifier(timeStep_, HOUR)), variable);
+    const auto* location = targetUpdater_.Intern(
+      {"area<", area_, ">", SEPARATOR, "ShortTermStorage<", shortTermStorageName, ">"});
+    targetUpdater_.UpdateTargetAtIndex({variableType, location, TimeStepType::hour, timeStep_},
+                                       variable);
 }
 
 void VariableNamer::ShortTermStorageInjection(unsigned int variable,
@@ -223,6 +222,7 @@ void ConstraintNamer::AreaBalance(unsigned int constraint)
 void ConstraintNamer::FictiveLoads(unsigned int constraint)
 {
     SetAreaElementNameHour(constraint, "FictiveLoads");
+    targetUpdater_.SetRelaxable(constraint);
 }
 
 void ConstraintNamer::HydroPower(unsigned int constraint)
@@ -263,6 +263,7 @@ void ConstraintNamer::MaxPumping(unsigned int constraint)
 void ConstraintNamer::AreaHydroLevel(unsigned int constraint)
 {
     SetAreaElementNameHour(constraint, "AreaHydroLevel");
+    targetUpdater_.SetRelaxable(constraint);
 }
 
 void ConstraintNamer::FinalStockEquivalent(unsigned int constraint)
@@ -277,11 +278,14 @@ void ConstraintNamer::FinalStockExpression(unsigned int constraint)
 
 void ConstraintNamer::nameWithTimeGranularity(unsigned int constraint,
                                               const std::string& name,
-                                              const std::string& type)
+                                              TimeStepType type)
 {
-    targetUpdater_.UpdateTargetAtIndex(
-      BuildName(name, BindingConstraintTimeGranularity.at(type), TimeIdentifier(timeStep_, type)),
-      constraint);
+    // The name of the binding constraint is the type of the element
+    const auto* elementType = targetUpdater_.Intern({name});
+    const auto* location = targetUpdater_.Intern({BindingConstraintTimeGranularity(type)});
+    targetUpdater_.UpdateTargetAtIndex({elementType->c_str(), location, type, timeStep_},
+                                       constraint);
+    targetUpdater_.SetRelaxable(constraint);
 }
 
 void ConstraintNamer::NbUnitsOutageLessThanNbUnitsStop(unsigned int constraint,
@@ -320,24 +324,23 @@ void ConstraintNamer::ConsistenceNODU(unsigned int constraint, const std::string
 
 void ConstraintNamer::ShortTermStorageLevel(unsigned int constraint, const std::string& name)
 {
-    targetUpdater_.UpdateTargetAtIndex(
-      BuildName("Level",
-                LocationIdentifier(area_, AREA) + SEPARATOR + "ShortTermStorage" + "<" + name + ">",
-                TimeIdentifier(timeStep_, HOUR)),
-      constraint);
+    const auto* location
+      = targetUpdater_.Intern({"area<", area_, ">", SEPARATOR, "ShortTermStorage<", name, ">"});
+    targetUpdater_.UpdateTargetAtIndex({"Level", location, TimeStepType::hour, timeStep_},
+                                       constraint);
 }
 
 void ConstraintNamer::BindingConstraintHour(unsigned int constraint, const std::string& name)
 {
-    nameWithTimeGranularity(constraint, name, HOUR);
+    nameWithTimeGranularity(constraint, name, TimeStepType::hour);
 }
 
 void ConstraintNamer::BindingConstraintDay(unsigned int constraint, const std::string& name)
 {
-    nameWithTimeGranularity(constraint, name, DAY);
+    nameWithTimeGranularity(constraint, name, TimeStepType::day);
 }
 
 void ConstraintNamer::BindingConstraintWeek(unsigned int constraint, const std::string& name)
 {
-    nameWithTimeGranularity(constraint, name, WEEK);
+    nameWithTimeGranularity(constraint, name, TimeStepType::week);
 }
@@ -8,23 +8,33 @@ const std::string AREA_SEP = "$$";
 class TargetVectorUpdater
 {
 public:
-    explicit TargetVectorUpdater(std::vector<std::string>& target) : target_(target)
+    explicit TargetVectorUpdater(Antares::Optimization::LpNames& target) : target_(target)
     {
     }
 
-    void UpdateTargetAtIndex(const std::string& full_name, unsigned int index)
+    void UpdateTargetAtIndex(const Antares::Optimization::LpName& name, unsigned int index)
     {
-        target_[index] = full_name;
+        target_.set(index, name);
+    }
+
+    void SetRelaxable(unsigned int index)
+    {
+        target_.setRelaxable(index);
+    }
+
+    const std::string* Intern(std::initializer_list<std::string_view> parts)
+    {
+        return target_.intern(parts);
     }
 
 private:
-    std::vector<std::string>& target_;
+    Antares::Optimization::LpNames& target_;
 };
 
 class Namer
 {
 public:
-    explicit Namer(std::vector<std::string>& target) : targetUpdater_(target)
+    explicit Namer(Antares::Optimization::LpNames& target) : targetUpdater_(target)
     {
     }
 
@@ -37,14 +47,14 @@ public:
     {
         area_ = area;
     }
-    void SetLinkElementName(unsigned int variable, const std::string& variableType);
-    void SetAreaElementNameHour(unsigned int variable, const std::string& variableType);
-    void SetAreaElementNameWeek(unsigned int variable, const std::string& variableType);
+    void SetLinkElementName(unsigned int variable, const char* variableType);
+    void SetAreaElementNameHour(unsigned int variable, const char* variableType);
+    void SetAreaElementNameWeek(unsigned int variable, const char* variableType);
     void SetAreaElementName(unsigned int variable,
-                            const std::string& variableType,
-                            const std::string& timeStepType);
+                            const char* variableType,
+                            Antares::Optimization::TimeStepType timeStepType);
     void SetThermalClusterElementName(unsigned int variable,
-                                      const std::string& variableType,
+                                      const char* variableType,
                                       const std::string& clusterName);
 
     unsigned int timeStep_ = 0;
@@ -88,11 +98,9 @@ public:
     void AreaBalance(unsigned int variable);
 
 private:
-    void SetAreaVariableName(unsigned int variable,
-                             const std::string& variableType,
-                             int layerIndex);
+    void SetAreaVariableName(unsigned int variable, const char* variableType, int layerIndex);
     void SetShortTermStorageVariableName(unsigned int variable,
-                                         const std::string& variableType,
+                                         const char* variableType,
                                          const std::string& shortTermStorageName);
 };
 
@@ -130,15 +138,5 @@ public:
 private:
     void nameWithTimeGranularity(unsigned int constraint,
                                  const std::string& name,
-                                 const std::string& type);
+                                 Antares::Optimization::TimeStepType type);
 };
-
-inline std::string TimeIdentifier(unsigned int timeStep, const std::string& timeStepType)
-{
-    return timeStepType + "<" + std::to_string(timeStep) + ">";
-}
-
-inline std::string LocationIdentifier(const std::string& location, const std::string& locationType)
-{
-    return locationType + "<" + location + ">";
-}
@@ -30,6 +30,7 @@
 #include <vector>
 #include <string>
 #include "opt_constants.h"
+#include "../utils/lp_names.h"
 
 /*--------------------------------------------------------------------------------------*/
 
@@ -111,9 +112,14 @@ struct PROBLEME_ANTARES_A_RESOUDRE
     std::vector<double> Pi;
     std::vector<int> Colonne;
 
-    /* Nommage des variables & contraintes */
-    std::vector<std::string> NomDesVariables;
-    std::vector<std::string> NomDesContraintes;
+    /* Nommage des variables & contraintes (les noms ne sont construits qu'a la demande) */
+    Antares::Optimization::LpNames NomDesVariables;
+    Antares::Optimization::LpNames NomDesContraintes;
+
+    /* La structure du probleme (variables et matrice des contraintes) ne depend pas de la
+       semaine : elle n'est construite qu'une fois puis reutilisee. Les pas de temps des noms
+       sont decales vers la semaine courante quand les noms sont construits */
+    bool StructureDuProblemeConstruite = false;
 
     std::vector<bool> VariablesEntieres; // true = int, false = continuous
 
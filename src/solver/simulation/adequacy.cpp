@@ -333,6 +333,7 @@ bool Adequacy::year(Progression::Task& progression,
         }
 
         state.hourInTheYear = previousHourInTheYear;
+        variables.weekForEachAreaBatch(state, numSpace);
         variables.weekForEachArea(state, numSpace);
         variables.weekEnd(state);
 
@@ -377,12 +378,12 @@ static std::vector<AvgExchangeResults*> retrieveBalance(
     return balance;
 }
 
-void Adequacy::simulationEnd()
+void Adequacy::simulationEnd(std::shared_ptr<Yuni::Job::QueueService> queueService)
 {
     if (!preproOnly && study.runtime->interconnectionsCount() > 0)
     {
         auto balance = retrieveBalance(study, variables);
-        ComputeFlowQuad(study, pProblemesHebdo[0], balance, pNbWeeks);
+        ComputeFlowQuad(study, pProblemesHebdo, balance, pNbWeeks, queueService);
     }
 }
 
@@ -87,7 +87,7 @@ protected:
 
     void incrementProgression(Progression::Task& progression);
 
-    void simulationEnd();
+    void simulationEnd(std::shared_ptr<Yuni::Job::QueueService> queueService);
 
     /*!
     ** \brief Prepare clusters in 'must-run' mode
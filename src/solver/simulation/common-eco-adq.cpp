@@ -30,9 +30,12 @@
 #include <antares/study/study.h>
 #include <antares/study/area/scratchpad.h>
 #include <antares/exception/UnfeasibleProblemError.hpp>
+#include <antares/concurrency/concurrency.h>
 
 #include "common-eco-adq.h"
 #include <antares/logs/logs.h>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <map>
 #include "simulation.h"
@@ -41,9 +44,50 @@ using namespace Yuni;
 
 namespace Antares::Solver::Simulation
 {
-static void RecalculDesEchangesMoyens(Data::Study& study,
+namespace
+{
+//! Weighted average NTC of the links, in both directions
+struct AverageNTC
+{
+    std::vector<std::vector<double>> direct;
+    std::vector<std::vector<double>> indirect;
+    //! False when the average of the link could not be retrieved : its NTC are left as is
+    std::vector<bool> valid;
+};
+
+AverageNTC retrieveAverageNTCOfTheLinks(const Data::Study& study)
+{
+    const uint nbLinks = study.runtime->interconnectionsCount();
+    AverageNTC ntc;
+    ntc.direct.resize(nbLinks);
+    ntc.indirect.resize(nbLinks);
+    ntc.valid.resize(nbLinks, true);
+    for (uint j = 0; j < nbLinks; ++j)
+    {
+        auto* link = study.runtime->areaLink[j];
+        int ret = retrieveAverageNTC(
+          study, link->directCapacities.timeSeries, link->timeseriesNumbers, ntc.direct[j]);
+
+        ret = retrieveAverageNTC(study,
+                                 link->indirectCapacities.timeSeries,
+                                 link->timeseriesNumbers,
+                                 ntc.indirect[j])
+              && ret;
+        if (ret)
+        {
+            assert(false && "invalid NTC");
+            ntc.valid[j] = false;
+        }
+    }
+    return ntc;
+}
+} // namespace
+
+static bool RecalculDesEchangesMoyens(Data::Study& study,
                                       PROBLEME_HEBDO& problem,
                                       const std::vector<AvgExchangeResults*>& balance,
+                                      const AverageNTC& averageNTC,
+                                      const OptimizationOptions& options,
                                       int PasDeTempsDebut)
 {
     for (uint i = 0; i < (uint)problem.NombreDePasDeTemps; i++)
@@ -66,40 +110,31 @@ static void RecalculDesEchangesMoyens(Data::Study& study,
             }
         }
 
-        std::vector<double> avgDirect;
-        std::vector<double> avgIndirect;
         for (uint j = 0; j < study.runtime->interconnectionsCount(); ++j)
         {
-            auto* link = study.runtime->areaLink[j];
-            int ret = retrieveAverageNTC(
-              study, link->directCapacities.timeSeries, link->timeseriesNumbers, avgDirect);
-
-            ret = retrieveAverageNTC(
-                    study, link->indirectCapacities.timeSeries, link->timeseriesNumbers, avgIndirect)
-                  && ret;
-            if (!ret)
+            if (averageNTC.valid[j])
             {
-                ntcValues.ValeurDeNTCOrigineVersExtremite[j] = avgDirect[decalPasDeTemps];
-                ntcValues.ValeurDeNTCExtremiteVersOrigine[j] = avgIndirect[decalPasDeTemps];
-            }
-            else
-            {
-                assert(false && "invalid NTC");
+                ntcValues.ValeurDeNTCOrigineVersExtremite[j]
+                  = averageNTC.direct[j][decalPasDeTemps];
+                ntcValues.ValeurDeNTCExtremiteVersOrigine[j]
+                  = averageNTC.indirect[j][decalPasDeTemps];
             }
 
-            auto& mtxParamaters = link->parameters;
+            auto& mtxParamaters = study.runtime->areaLink[j]->parameters;
             ntcValues.ResistanceApparente[j] = mtxParamaters[Data::fhlImpedances][decalPasDeTemps];
         }
     }
 
+    bool hasFailed = false;
     try
     {
         NullResultWriter resultWriter;
-        OPT_OptimisationHebdomadaire(createOptimizationOptions(study), &problem, study.parameters.adqPatchParams, resultWriter);
+        OPT_OptimisationHebdomadaire(
+          options, &problem, study.parameters.adqPatchParams, resultWriter);
     }
     catch (Data::UnfeasibleProblemError&)
     {
-        study.runtime->quadraticOptimizationHasFailed = true;
+        hasFailed = true;
     }
 
     for (uint i = 0; i < (uint)problem.NombreDePasDeTemps; ++i)
@@ -114,6 +149,7 @@ static void RecalculDesEchangesMoyens(Data::Study& study,
               = ntcValues.ValeurDuFlux[j];
         }
     }
+    return !hasFailed;
 }
 
 void PrepareDataFromClustersInMustrunMode(Data::Study& study, uint numSpace, uint year)
@@ -195,23 +231,66 @@ bool ShouldUseQuadraticOptimisation(const Data::Study& study)
 }
 
 void ComputeFlowQuad(Data::Study& study,
-                     PROBLEME_HEBDO& problem,
+                     std::vector<PROBLEME_HEBDO>& problems,
                      const std::vector<AvgExchangeResults*>& balance,
-                     uint nbWeeks)
+                     uint nbWeeks,
+                     std::shared_ptr<Yuni::Job::QueueService> queueService)
 {
     uint startTime = study.calendar.days[study.parameters.simulationDays.first].hours.first;
+    const uint nbTimeSteps = problems.front().NombreDePasDeTemps;
 
     if (ShouldUseQuadraticOptimisation(study))
     {
         logs.info() << "Post-processing... (quadratic optimisation)";
 
-        problem.TypeDOptimisation = OPTIMISATION_QUADRATIQUE;
-        problem.LeProblemeADejaEteInstancie = false;
-        for (uint w = 0; w != nbWeeks; ++w)
+        const AverageNTC averageNTC = retrieveAverageNTCOfTheLinks(study);
+        const OptimizationOptions options = createOptimizationOptions(study);
+
+        // The weeks are independent from each other, each weekly problem left by the
+        // MC years solves the weeks it picks, and writes into its own slice of the results
+        const bool parallel = queueService && queueService->started()
+                              && queueService->maximumThreadCount() > 1 && problems.size() > 1
+                              && nbWeeks > 1;
+        const size_t nbTasks
+          = parallel ? std::min<size_t>({queueService->maximumThreadCount(), problems.size(),
+                                         nbWeeks})
+                     : 1;
+
+        std::atomic<uint> nextWeek = 0;
+        std::vector<char> hasFailed(nbTasks, false);
+        auto solveWeeks = [&](size_t t) {
+            auto& problem = problems[t];
+            problem.TypeDOptimisation = OPTIMISATION_QUADRATIQUE;
+            problem.LeProblemeADejaEteInstancie = false;
+            for (uint w = nextWeek++; w < nbWeeks; w = nextWeek++)
+            {
+                int PasDeTempsDebut = startTime + (w * nbTimeSteps);
+                if (!RecalculDesEchangesMoyens(
+                      study, problem, balance, averageNTC, options, PasDeTempsDebut))
+                    hasFailed[t] = true;
+            }
+        };
+
+        if (!parallel)
+            solveWeeks(0);
+        else
         {
-            int PasDeTempsDebut = startTime + (w * problem.NombreDePasDeTemps);
-            RecalculDesEchangesMoyens(study, problem, balance, PasDeTempsDebut);
+            std::vector<Concurrency::TaskFuture> tasks;
+            tasks.reserve(nbTasks);
+            for (size_t t = 0; t != nbTasks; ++t)
+                tasks.push_back(Concurrency::AddTask(*queueService, [&solveWeeks, t]() {
+                    solveWeeks(t);
+                }));
+
+            // Every task must be over before leaving, since they all refer to local data
+            for (auto& task : tasks)
+                task.wait();
+            for (auto& task : tasks)
+                task.get();
         }
+
+        if (std::any_of(hasFailed.begin(), hasFailed.end(), [](char failed) { return failed; }))
+            study.runtime->quadraticOptimizationHasFailed = true;
     }
     else
     {
@@ -221,8 +300,8 @@ void ComputeFlowQuad(Data::Study& study,
         {
             for (uint w = 0; w != nbWeeks; ++w)
             {
-                int PasDeTempsDebut = startTime + (w * problem.NombreDePasDeTemps);
-                for (uint i = 0; i < (uint)problem.NombreDePasDeTemps; ++i)
+                int PasDeTempsDebut = startTime + (w * nbTimeSteps);
+                for (uint i = 0; i < nbTimeSteps; ++i)
                 {
                     const uint indx = i + PasDeTempsDebut;
                     transitMoyenInterconnexionsRecalculQuadratique[j][indx] = 0;
@@ -467,6 +546,7 @@ void finalizeOptimizationStatistics(PROBLEME_HEBDO& problem,
 {
     auto& firstOptStat = problem.optimizationStatistics[0];
     state.averageOptimizationTime1 = firstOptStat.getAverageSolveTime();
+    state.problemBuildTime = firstOptStat.getTotalBuildTime();
     firstOptStat.reset();
 
     auto& secondOptStat = problem.optimizationStatistics[1];
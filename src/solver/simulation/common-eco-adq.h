@@ -85,11 +85,15 @@ bool ShouldUseQuadraticOptimisation(const Data::Study& study);
 
 /*!
 ** \brief Perform the quadratic optimization (links) (eco+adq)
+**
+** The weeks are spread over the weekly problems, solved in parallel by the jobs of the
+** queue service if any and if it is started.
 */
 void ComputeFlowQuad(Data::Study& study,
-                     PROBLEME_HEBDO& problem,
+                     std::vector<PROBLEME_HEBDO>& problems,
                      const std::vector<AvgExchangeResults*>& balance,
-                     unsigned int nbWeeks);
+                     unsigned int nbWeeks,
+                     std::shared_ptr<Yuni::Job::QueueService> queueService = nullptr);
 
 /*!
 ** \brief Hydro Remix
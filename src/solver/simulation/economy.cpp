@@ -179,6 +179,7 @@ bool Economy::year(Progression::Task& progression,
             }
 
             state.hourInTheYear = previousHourInTheYear;
+            variables.weekForEachAreaBatch(state, numSpace);
             variables.weekForEachArea(state, numSpace);
             variables.weekEnd(state);
 
@@ -255,12 +256,12 @@ static std::vector<AvgExchangeResults*> retrieveBalance(
     return balance;
 }
 
-void Economy::simulationEnd()
+void Economy::simulationEnd(std::shared_ptr<Yuni::Job::QueueService> queueService)
 {
     if (!preproOnly && study.runtime->interconnectionsCount() > 0)
     {
         auto balance = retrieveBalance(study, variables);
-        ComputeFlowQuad(study, pProblemesHebdo[0], balance, pNbWeeks);
+        ComputeFlowQuad(study, pProblemesHebdo, balance, pNbWeeks, queueService);
     }
 }
 
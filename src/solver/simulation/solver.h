@@ -121,24 +121,36 @@ private:
     **
     ** \param	randomForYears	Storage for random numbers for years in the list
     ** \param	years			List of years
+    ** \param	previousSetsHavePerformedYears	True if a previous set of parallel years has performed years
     */
     void computeRandomNumbers(randomNumbers& randomForYears,
                               std::vector<uint>& years,
                               std::map<unsigned int, bool>& isYearPerformed,
-                              MersenneTwister& randomHydro);
+                              MersenneTwister& randomHydro,
+                              bool previousSetsHavePerformedYears);
 
     /*!
     ** \brief Computes statistics on annual (system and solution) costs, to be printed in output
     *into separate files
     **
-    ** Adds the contributions of each performed year contained in the current set to annual system
+    ** Adds the contribution of a performed year to annual system
     *and solution costs averages over all years.
     ** These average costs are meant to be printed in output into separate files.
     ** Same thing for min and max costs over all years.
     ** Storing these costs to compute std deviation later.
     */
-    void computeAnnualCostsStatistics(std::vector<Variable::State>& state,
-                                      std::vector<setOfParallelYears>::iterator& set_it);
+    void computeAnnualCostsStatistics(const Variable::State& state);
+
+    /*!
+    ** \brief Merge the results of a performed year into the summary
+    **
+    ** Years must be merged in increasing order, so that the results do not depend on the
+    ** order in which the years are completed.
+    **
+    ** \param y        The MC year
+    ** \param numSpace The space the year was run into
+    */
+    void mergeYearIntoSummary(uint y, uint numSpace, std::vector<Variable::State>& state);
 
     /*!
     ** \brief Iterate through all MC years
@@ -148,6 +160,9 @@ private:
     */
     void loopThroughYears(uint firstYear, uint endYear, std::vector<Variable::State>& state);
 
+    //! Wait for the auxiliary queue service, if any, and release it
+    void stopAuxiliaryQueueService();
+
 
 private:
     //! Some temporary to avoid performing useless complex checks
@@ -156,12 +171,12 @@ private:
     uint pNbYearsReallyPerformed;
     //! Max number of years performed in parallel
     uint pNbMaxPerformedYearsInParallel;
+    //! Number of threads running the MC years, at most one per logical core
+    uint pNbWorkers;
     //! Year by year output results
     bool pYearByYear;
     //! Hydro hot start
     bool pHydroHotStart;
-    //! The first set of parallel year(s) with a performed year was already run ?
-    bool pFirstSetParallelWithAPerformedYearWasRun;
 
     //! Statistics about annual (system and solution) costs
     annualCostsStatistics pAnnualCostsStatistics;
@@ -170,8 +185,11 @@ private:
     Benchmarking::IDurationCollector& pDurationCollector;
 
 public:
-    //! The queue service that runs every set of parallel years
+    //! The queue service that runs every MC year
     std::shared_ptr<Yuni::Job::QueueService> pQueueService = nullptr;
+    //! The queue service of the cores which are not running a MC year : it helps with the
+    //! hydro ventilation of the areas and with the merge of the parts of the summary (optional)
+    std::shared_ptr<Yuni::Job::QueueService> pAuxiliaryQueueService = nullptr;
     //! Result writer
     Antares::Solver::IResultWriter& pResultWriter;
 
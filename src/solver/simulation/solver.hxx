@@ -41,11 +41,16 @@
 #include "opt_time_writer.h"
 #include "../hydro/management.h" // Added for use of randomReservoirLevel(...)
 
+#include <yuni/core/system/cpu.h>
 #include <yuni/core/system/suspend.h>
 #include <yuni/job/job.h>
 
 #include "antares/concurrency/concurrency.h"
 
+#include <algorithm>
+#include <deque>
+#include <memory>
+
 namespace Antares::Solver::Simulation
 {
 
@@ -83,7 +88,8 @@ public:
                     study.parameters,
                     study.calendar,
                     study.maxNbYearsInParallel,
-                    resultWriter)
+                    resultWriter,
+                    simulation->pAuxiliaryQueueService)
     {
         hydroHotStart = (study.parameters.initialReservoirLevels.iniLevels == Data::irlHotStart);
     }
@@ -200,6 +206,8 @@ public:
             // Log failing weeks
             logFailedWeek(y, study, failedWeekList);
 
+            pDurationCollector.addDuration("lp_structure_build", state[numSpace].problemBuildTime);
+
             simulation_->variables.yearEndBuild(state[numSpace], y, numSpace);
 
             // 7 - End of the year, this is the last stade where the variables can retrieve
@@ -248,8 +256,8 @@ inline ISimulation<Impl>::ISimulation(Data::Study& study,
     settings(settings),
     pNbYearsReallyPerformed(0),
     pNbMaxPerformedYearsInParallel(0),
+    pNbWorkers(1),
     pYearByYear(study.parameters.yearByYear),
-    pFirstSetParallelWithAPerformedYearWasRun(false),
     pDurationCollector(duration_collector),
     pQueueService(study.pQueueService),
     pResultWriter(resultWriter)
@@ -287,6 +295,8 @@ template<class Impl>
 void ISimulation<Impl>::run()
 {
     pNbMaxPerformedYearsInParallel = study.maxNbYearsInParallel;
+    pNbWorkers
+      = std::max(1u, std::min(pNbMaxPerformedYearsInParallel, Yuni::System::CPU::Count()));
 
     // Initialize all data
     ImplementationType::variables.initializeFromStudy(study);
@@ -319,8 +329,20 @@ void ISimulation<Impl>::run()
         // in general data of the study.
         logs.info() << " Only the preprocessors are enabled.";
 
+        if (pQueueService)
+        {
+            pQueueService->maximumThreadCount(pNbWorkers);
+            pQueueService->start();
+        }
+
         regenerateTimeSeries(0);
 
+        if (pQueueService)
+        {
+            pQueueService->wait(Yuni::qseIdle);
+            pQueueService->stop();
+        }
+
         // Destroy the TS Generators if any
         // It will export the time-series into the output in the same time
         Solver::TSGenerator::DestroyAll(study);
@@ -375,7 +397,21 @@ void ISimulation<Impl>::run()
         // Post operations
         {
             Benchmarking::Timer timer;
-            ImplementationType::simulationEnd();
+            // No MC year is running anymore, their queue is used by the post-processing
+            pQueueService->maximumThreadCount(pNbWorkers);
+            pQueueService->start();
+            try
+            {
+                ImplementationType::simulationEnd(pQueueService);
+            }
+            catch (...)
+            {
+                pQueueService->wait(Yuni::qseIdle);
+                pQueueService->stop();
+                throw;
+            }
+            pQueueService->wait(Yuni::qseIdle);
+            pQueueService->stop();
             timer.stop();
             pDurationCollector.addDuration("post_processing", timer.get_duration());
         }
@@ -450,11 +486,12 @@ void ISimulation<Impl>::regenerateTimeSeries(uint year)
     // * Both options "Preprocessor" and "Refresh" are checked in the interface
     //   _and_ the refresh must be done for the given year (always done for the first year).
     using namespace Solver::TSGenerator;
+    // No MC year is running at this point, their queue is used to generate the time-series
     // Load
     if (pData.haveToRefreshTSLoad && (year % pData.refreshIntervalLoad == 0))
     {
         Benchmarking::Timer timer;
-        GenerateTimeSeries<Data::timeSeriesLoad>(study, year, pResultWriter);
+        GenerateTimeSeries<Data::timeSeriesLoad>(study, year, pResultWriter, pQueueService);
         timer.stop();
         pDurationCollector.addDuration("tsgen_load", timer.get_duration());
     }
@@ -462,7 +499,7 @@ void ISimulation<Impl>::regenerateTimeSeries(uint year)
     if (pData.haveToRefreshTSSolar && (year % pData.refreshIntervalSolar == 0))
     {
         Benchmarking::Timer timer;
-        GenerateTimeSeries<Data::timeSeriesSolar>(study, year, pResultWriter);
+        GenerateTimeSeries<Data::timeSeriesSolar>(study, year, pResultWriter, pQueueService);
         timer.stop();
         pDurationCollector.addDuration("tsgen_solar", timer.get_duration());
     }
@@ -470,7 +507,7 @@ void ISimulation<Impl>::regenerateTimeSeries(uint year)
     if (pData.haveToRefreshTSWind && (year % pData.refreshIntervalWind == 0))
     {
         Benchmarking::Timer timer;
-        GenerateTimeSeries<Data::timeSeriesWind>(study, year, pResultWriter);
+        GenerateTimeSeries<Data::timeSeriesWind>(study, year, pResultWriter, pQueueService);
         timer.stop();
         pDurationCollector.addDuration("tsgen_wind", timer.get_duration());
     }
@@ -486,8 +523,12 @@ void ISimulation<Impl>::regenerateTimeSeries(uint year)
     const bool refreshTSonCurrentYear = (year % pData.refreshIntervalThermal == 0);
     {
         Benchmarking::Timer timer;
-        GenerateThermalTimeSeries(
-          study, year, pData.haveToRefreshTSThermal, refreshTSonCurrentYear, pResultWriter);
+        GenerateThermalTimeSeries(study,
+                                  year,
+                                  pData.haveToRefreshTSThermal,
+                                  refreshTSonCurrentYear,
+                                  pResultWriter,
+                                  pQueueService);
         timer.stop();
         pDurationCollector.addDuration("tsgen_thermal", timer.get_duration());
     }
@@ -552,6 +593,7 @@ uint ISimulation<Impl>::buildSetsOfParallelYears(
             set->nbYears = 0;
             set->regenerateTS = false;
             set->yearForTSgeneration = 999999;
+            set->previousSetsHavePerformedYears = (pNbYearsReallyPerformed != 0);
 
             // In case we have to regenerate times series before run the current set of parallel
             // years
@@ -668,7 +710,8 @@ template<class Impl>
 void ISimulation<Impl>::computeRandomNumbers(randomNumbers& randomForYears,
                                              std::vector<uint>& years,
                                              std::map<unsigned int, bool>& isYearPerformed,
-                                             MersenneTwister& randomHydroGenerator)
+                                             MersenneTwister& randomHydroGenerator,
+                                             bool previousSetsHavePerformedYears)
 {
     auto& runtime = *study.runtime;
 
@@ -743,7 +786,7 @@ void ISimulation<Impl>::computeRandomNumbers(randomNumbers& randomForYears,
                     return; // Skipping the current area
                 }
 
-                if (!pFirstSetParallelWithAPerformedYearWasRun)
+                if (!previousSetsHavePerformedYears)
                     randomForYears.pYears[indexYear].pReservoirLevels[areaIndex] = randomLevel;
                 // Else : means the start levels (multiple areas are affected) of a year are
                 // retrieved from a previous year and
@@ -880,29 +923,46 @@ void ISimulation<Impl>::computeRandomNumbers(randomNumbers& randomForYears,
 } // End function
 
 template<class Impl>
-void ISimulation<Impl>::computeAnnualCostsStatistics(
-  std::vector<Variable::State>& state,
-  std::vector<setOfParallelYears>::iterator& set_it)
+void ISimulation<Impl>::computeAnnualCostsStatistics(const Variable::State& state)
+{
+    pAnnualCostsStatistics.systemCost.addCost(state.annualSystemCost);
+    pAnnualCostsStatistics.criterionCost1.addCost(state.optimalSolutionCost1);
+    pAnnualCostsStatistics.criterionCost2.addCost(state.optimalSolutionCost2);
+    pAnnualCostsStatistics.optimizationTime1.addCost(state.averageOptimizationTime1);
+    pAnnualCostsStatistics.optimizationTime2.addCost(state.averageOptimizationTime2);
+}
+
+template<class Impl>
+void ISimulation<Impl>::mergeYearIntoSummary(uint y,
+                                             uint numSpace,
+                                             std::vector<Variable::State>& state)
 {
-    // Loop over years contained in the set
-    std::vector<unsigned int>::iterator year_it;
-    for (year_it = set_it->yearsIndices.begin(); year_it != set_it->yearsIndices.end(); ++year_it)
+    std::map<unsigned int, unsigned int> numSpaceToYear = {{numSpace, y}};
+    auto& variables = ImplementationType::variables;
+
+    const uint partCount = variables.summaryPartCount();
+    if (!pAuxiliaryQueueService || partCount < 2)
     {
-        // Get the index of the year
-        unsigned int y = *year_it;
-        if (set_it->isYearPerformed[y])
-        {
-            // Get space number associated to the performed year
-            uint numSpace = set_it->performedYearToSpace[y];
-            pAnnualCostsStatistics.systemCost.addCost(state[numSpace].annualSystemCost);
-            pAnnualCostsStatistics.criterionCost1.addCost(state[numSpace].optimalSolutionCost1);
-            pAnnualCostsStatistics.criterionCost2.addCost(state[numSpace].optimalSolutionCost2);
-            pAnnualCostsStatistics.optimizationTime1.addCost(
-              state[numSpace].averageOptimizationTime1);
-            pAnnualCostsStatistics.optimizationTime2.addCost(
-              state[numSpace].averageOptimizationTime2);
-        }
+        // Computing the summary : adding the contribution of the MC year
+        variables.computeSummary(numSpaceToYear);
+
+        // Computing summary of spatial aggregations
+        variables.computeSpatialAggregatesSummary(variables, numSpaceToYear);
     }
+    else
+    {
+        // The areas, sets of areas and binding constraints are merged concurrently.
+        // The parts are distributed on demand, since their sizes are very different.
+        Concurrency::ForEachIndex(*pAuxiliaryQueueService,
+                                  partCount,
+                                  [&variables, &numSpaceToYear](uint part) {
+                                      variables.computeSummaryPart(part, numSpaceToYear);
+                                  });
+    }
+
+    // Computes statistics on annual (system and solution) costs, to be printed in output into
+    // separate files
+    computeAnnualCostsStatistics(state[numSpace]);
 }
 
 static inline void logPerformedYearsInAset(setOfParallelYears& set)
@@ -919,6 +979,17 @@ static inline void logPerformedYearsInAset(setOfParallelYears& set)
     logs.info() << "Year(s) " << performedYearsToLog;
 }
 
+template<class Impl>
+void ISimulation<Impl>::stopAuxiliaryQueueService()
+{
+    if (!pAuxiliaryQueueService)
+        return;
+
+    pAuxiliaryQueueService->wait(Yuni::qseIdle);
+    pAuxiliaryQueueService->stop();
+    pAuxiliaryQueueService = nullptr;
+}
+
 template<class Impl>
 void ISimulation<Impl>::loopThroughYears(uint firstYear,
                                          uint endYear,
@@ -942,109 +1013,187 @@ void ISimulation<Impl>::loopThroughYears(uint firstYear,
     // Related to annual costs statistics (printed in output into separate files)
     pAnnualCostsStatistics.setNbPerformedYears(pNbYearsReallyPerformed);
 
-    // Container for random numbers of parallel years (to be executed or not)
-    randomNumbers randomForParallelYears(maxNbYearsPerformedInAset,
-                                         study.parameters.power.fluctuations);
+    // Containers for random numbers of parallel years (to be executed or not).
+    // Two of them are used in turn, so that the random numbers of the next set of
+    // parallel years can be drawn while the years of the current set are still running.
+    std::vector<std::unique_ptr<randomNumbers>> randomForParallelYears;
+    for (uint i = 0; i != 2; ++i)
+    {
+        randomForParallelYears.push_back(std::make_unique<randomNumbers>(
+          maxNbYearsPerformedInAset, study.parameters.power.fluctuations));
+        // Allocating memory to store random numbers of all parallel years
+        allocateMemoryForRandomNumbers(*randomForParallelYears.back());
+    }
 
-    // Allocating memory to store random numbers of all parallel years
-    allocateMemoryForRandomNumbers(randomForParallelYears);
+    // Number of threads to perform the jobs waiting in the queue.
+    // A year keeps its space (numSpace) until it is merged into the summary, and the years are
+    // merged in their natural order : a slow year holds the spaces of all the years finished
+    // after it. When there are more spaces than logical cores (--force-parallel), the extra
+    // spaces are not given threads of their own, they let the next years start on the threads
+    // released in the meantime.
+    pQueueService->maximumThreadCount(pNbWorkers);
+    if (pNbWorkers < pNbMaxPerformedYearsInParallel)
+    {
+        logs.info() << "  " << pNbMaxPerformedYearsInParallel << " parallel years for "
+                    << pNbWorkers << " threads";
+    }
 
-    // Number of threads to perform the jobs waiting in the queue
-    pQueueService->maximumThreadCount(pNbMaxPerformedYearsInParallel);
+    // The cores of the simulation cores level which are not running a year help with the
+    // hydro ventilation of the areas and with the merge of the years into the summary, done
+    // while the next years are running. They have their own queue, so that a year waiting for
+    // its areas never waits for another year. The threads waiting for this work process it
+    // too, so that they are never slower than alone when these threads are busy.
+    const uint nbCores = std::min(study.nbYearsParallelRaw, Yuni::System::CPU::Count());
+    if (nbCores > pNbWorkers
+        && (study.areas.size() > 1 || ImplementationType::variables.summaryPartCount() > 1))
+    {
+        pAuxiliaryQueueService = std::make_shared<Yuni::Job::QueueService>();
+        pAuxiliaryQueueService->maximumThreadCount(nbCores - pNbWorkers);
+        pAuxiliaryQueueService->start();
+        logs.info() << "  " << (nbCores - pNbWorkers)
+                    << " threads for the hydro ventilation and the summary";
+    }
 
-    // Loop over sets of parallel years
-    std::vector<setOfParallelYears>::iterator set_it;
-    for (set_it = setsOfParallelYears.begin(); set_it != setsOfParallelYears.end(); ++set_it)
+    // The years are not run set after set anymore : a year is sent to the queue as soon as
+    // the space (numSpace) it is given was released by the previous year using it.
+    // The years are merged into the summary in their natural order, which gives the same
+    // results than waiting for the completion of each set of parallel years.
+    const auto nbSets = static_cast<uint>(setsOfParallelYears.size());
+    // Number of sets whose time-series and random numbers are ready
+    uint nbPreparedSets = 0;
+    // Next year to be sent to the queue (index of the set, index of the year in the set)
+    uint dispatchSet = 0;
+    uint dispatchIndex = 0;
+    // Next year to be merged into the summary
+    uint mergeSet = 0;
+    uint mergeIndex = 0;
+    // Spaces currently used by a year
+    std::vector<bool> spaceInUse(pNbMaxPerformedYearsInParallel, false);
+    // Years sent to the queue and not merged yet, in increasing order
+    std::deque<Concurrency::TaskFuture> pendingYears;
+
+    pQueueService->start();
+
+    try
     {
-        // 1 - We may want to regenerate the time-series this year.
-        // This is the case when the preprocessors are enabled from the
-        // interface and/or the refresh is enabled.
-        if (set_it->regenerateTS)
-            regenerateTimeSeries(set_it->yearForTSgeneration);
+        while (mergeSet != nbSets)
+        {
+            // 1 - Preparing the next sets of parallel years. The random numbers of a set
+            // can be drawn as soon as the container it uses is released. Time-series can only
+            // be regenerated once all previous years are over : they are generated in place,
+            // into the matrices of the study read by the running years. Generating them ahead
+            // would need a second copy of all the time-series of the study, usually its
+            // largest part, while the generation itself already uses all the threads.
+            while (nbPreparedSets != nbSets && nbPreparedSets <= mergeSet + 1)
+            {
+                auto& set = setsOfParallelYears[nbPreparedSets];
+                if (set.regenerateTS)
+                {
+                    if (mergeSet != nbPreparedSets)
+                        break;
+                    regenerateTimeSeries(set.yearForTSgeneration);
+                }
 
-        computeRandomNumbers(randomForParallelYears, set_it->yearsIndices, set_it->isYearPerformed,
-                             randomHydroGenerator);
+                computeRandomNumbers(*randomForParallelYears[nbPreparedSets % 2],
+                                     set.yearsIndices,
+                                     set.isYearPerformed,
+                                     randomHydroGenerator,
+                                     set.previousSetsHavePerformedYears);
+                ++nbPreparedSets;
+            }
 
-        std::vector<unsigned int>::iterator year_it;
+            // 2 - Sending years to the queue, as long as their space is free
+            while (dispatchSet != nbPreparedSets)
+            {
+                auto& set = setsOfParallelYears[dispatchSet];
+                unsigned int y = set.yearsIndices[dispatchIndex];
 
-        bool yearPerformed = false;
-        Concurrency::FutureSet results;
-        for (year_it = set_it->yearsIndices.begin(); year_it != set_it->yearsIndices.end();
-             ++year_it)
-        {
-            // Get the index of the year
-            unsigned int y = *year_it;
+                bool performCalculations = set.isYearPerformed[y];
+                unsigned int numSpace = 999999;
+                if (performCalculations)
+                {
+                    numSpace = set.performedYearToSpace[y];
+                    if (spaceInUse[numSpace])
+                        break;
+                    spaceInUse[numSpace] = true;
+                }
 
-            bool performCalculations = set_it->isYearPerformed[y];
-            unsigned int numSpace = 999999;
-            if (performCalculations)
-            {
-                yearPerformed = true;
-                numSpace = set_it->performedYearToSpace[y];
+                if (dispatchIndex == 0)
+                    logPerformedYearsInAset(set);
+
+                auto task = std::make_shared<yearJob<ImplementationType>>(
+                  this,
+                  y,
+                  set.yearFailed,
+                  set.isFirstPerformedYearOfASet,
+                  set.previousSetsHavePerformedYears,
+                  numSpace,
+                  *randomForParallelYears[dispatchSet % 2],
+                  performCalculations,
+                  study,
+                  state,
+                  pYearByYear,
+                  pDurationCollector,
+                  pResultWriter);
+                pendingYears.push_back(Concurrency::AddTask(*pQueueService, task));
+
+                if (++dispatchIndex == set.nbYears)
+                {
+                    ++dispatchSet;
+                    dispatchIndex = 0;
+                }
             }
 
-            // If the year has not to be rerun, we skip the computation of the year.
-            // Note that, when we enter for the first time in the "for" loop, all years of the set
-            // have to be rerun (meaning : they must be run once). if(!set_it->yearFailed[y])
-            // continue;
-
-            auto task = std::make_shared<yearJob<ImplementationType>>(this,
-                                                                 y,
-                                                                 set_it->yearFailed,
-                                                                 set_it->isFirstPerformedYearOfASet,
-                                                                 pFirstSetParallelWithAPerformedYearWasRun,
-                                                                 numSpace,
-                                                                 randomForParallelYears,
-                                                                 performCalculations,
-                                                                 study,
-                                                                 state,
-                                                                 pYearByYear,
-                                                                 pDurationCollector,
-                                                                 pResultWriter);
-            results.add(Concurrency::AddTask(*pQueueService, task));
-        } // End loop over years of the current set of parallel years
-
-        logPerformedYearsInAset(*set_it);
-
-        pQueueService->start();
-
-        pQueueService->wait(Yuni::qseIdle);
-        pQueueService->stop();
-        results.join();
-        pResultWriter.flush();
+            // 3 - Waiting for the oldest running year, and merging it into the summary
+            assert(!pendingYears.empty());
+            auto future = std::move(pendingYears.front());
+            pendingYears.pop_front();
+            future.get();
 
-        // At this point, the first set of parallel year(s) was run with at least one year performed
-        if (!pFirstSetParallelWithAPerformedYearWasRun && yearPerformed)
-            pFirstSetParallelWithAPerformedYearWasRun = true;
+            auto& set = setsOfParallelYears[mergeSet];
+            unsigned int y = set.yearsIndices[mergeIndex];
 
-        // On regarde si au moins une année du lot n'a pas trouvé de solution
-        for (auto& [year, failed] : set_it->yearFailed)
-        {
-            // Si une année du lot d'années n'a pas trouvé de solution, on arrête tout
-            if (failed)
+            // Si une année n'a pas trouvé de solution, on arrête tout
+            if (set.yearFailed[y])
             {
                 std::ostringstream msg;
-                msg << "Year " << year + 1 << " has failed in the previous set of parallel year.";
+                msg << "Year " << y + 1 << " has failed in the previous set of parallel year.";
                 throw FatalError(msg.str());
             }
-        }
-        // Computing the summary : adding the contribution of MC years
-        // previously computed in parallel
-        ImplementationType::variables.computeSummary(set_it->spaceToPerformedYear,
-                                                     set_it->nbPerformedYears);
 
-        // Computing summary of spatial aggregations
-        ImplementationType::variables.computeSpatialAggregatesSummary(
-          ImplementationType::variables, set_it->spaceToPerformedYear, set_it->nbPerformedYears);
+            if (set.isYearPerformed[y])
+            {
+                uint numSpace = set.performedYearToSpace[y];
+                mergeYearIntoSummary(y, numSpace, state);
+                spaceInUse[numSpace] = false;
+            }
+
+            if (++mergeIndex == set.nbYears)
+            {
+                pResultWriter.flush();
 
-        // Computes statistics on annual (system and solution) costs, to be printed in output into
-        // separate files
-        computeAnnualCostsStatistics(state, set_it);
+                // Set to zero the random numbers of all parallel years
+                randomForParallelYears[mergeSet % 2]->reset();
 
-        // Set to zero the random numbers of all parallel years
-        randomForParallelYears.reset();
+                ++mergeSet;
+                mergeIndex = 0;
+            }
+        }
+    }
+    catch (...)
+    {
+        // The years still running use data owned by this function
+        for (auto& future : pendingYears)
+            future.wait();
+        pQueueService->wait(Yuni::qseIdle);
+        pQueueService->stop();
+        stopAuxiliaryQueueService();
+        throw;
+    }
 
-    } // End loop over sets of parallel years
+    pQueueService->wait(Yuni::qseIdle);
+    pQueueService->stop();
+    stopAuxiliaryQueueService();
 
     // Writing annual costs statistics
     pAnnualCostsStatistics.endStandardDeviations();
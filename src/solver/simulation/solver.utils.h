@@ -77,6 +77,10 @@ public:
 
     // Annee a passer a la fonction "regenerateTimeSeries<false>(y)" (si regenerateTS is "true")
     unsigned int yearForTSgeneration;
+
+    // Au moins une année a-t-elle été jouée dans un lot précédent ?
+    // (utile au démarrage à chaud de l'hydraulique)
+    bool previousSetsHavePerformedYears;
 };
 
 class costStatistics
@@ -27,7 +27,9 @@
 #ifndef __ANTARES_SOLVER_timeSeries_GENERATOR_H__
 #define __ANTARES_SOLVER_timeSeries_GENERATOR_H__
 
+#include <memory>
 #include <yuni/yuni.h>
+#include <yuni/job/queue/service.h>
 #include <antares/study/fwd.h>
 #include <antares/study/parameters.h>
 #include <antares/study/parts/thermal/cluster.h>
@@ -42,15 +44,29 @@ namespace TSGenerator
 {
 /*!
 ** \brief Regenerate the time-series
+**
+** The time-series of load, solar and wind are generated in parallel by the jobs of the queue
+** service, if any and if it is started, unless the legacy random sequence is required by the
+** parameters of the study.
 */
 template<enum Data::TimeSeriesType T>
-bool GenerateTimeSeries(Data::Study& study, uint year, IResultWriter& writer);
+bool GenerateTimeSeries(Data::Study& study,
+                        uint year,
+                        IResultWriter& writer,
+                        std::shared_ptr<Yuni::Job::QueueService> queueService = nullptr);
 
+/*!
+** \brief Regenerate the thermal time-series
+**
+** Clusters are generated in parallel by the jobs of the queue service, if any and if it is
+** started, unless the legacy random sequence is required by the parameters of the study.
+*/
 bool GenerateThermalTimeSeries(Data::Study& study,
                                uint year,
                                bool globalThermalTSgeneration,
                                bool refresh,
-                               IResultWriter& writer);
+                               IResultWriter& writer,
+                               std::shared_ptr<Yuni::Job::QueueService> queueService = nullptr);
 
 /*!
 ** \brief Destroy all TS Generators
@@ -42,14 +42,18 @@ bool GenerateHydroTimeSeries(Data::Study& study, uint year, IResultWriter& write
 template<>
 inline bool GenerateTimeSeries<Data::timeSeriesHydro>(Data::Study& study,
                                                       uint year,
-                                                      IResultWriter& writer)
+                                                      IResultWriter& writer,
+                                                      std::shared_ptr<Yuni::Job::QueueService>)
 {
     return GenerateHydroTimeSeries(study, year, writer);
 }
 
 // --- TS Generators using XCast ---
 template<enum Data::TimeSeriesType T>
-bool GenerateTimeSeries(Data::Study& study, uint year, IResultWriter& writer)
+bool GenerateTimeSeries(Data::Study& study,
+                        uint year,
+                        IResultWriter& writer,
+                        std::shared_ptr<Yuni::Job::QueueService> queueService)
 {
     auto* xcast = reinterpret_cast<XCast::XCast*>(
       study.cacheTSGenerator[Data::TimeSeriesBitPatternIntoIndex<T>::value]);
@@ -63,25 +67,30 @@ bool GenerateTimeSeries(Data::Study& study, uint year, IResultWriter& writer)
 
     // The current year
     xcast->year = year;
+    xcast->legacyRandomSequence = study.parameters.legacyXCastTSRandomSequence;
+    xcast->queueService = queueService;
 
+    uint seedIndex;
     switch (T)
     {
     case Data::timeSeriesLoad:
-        xcast->random = &(study.runtime->random[Data::seedTsGenLoad]);
+        seedIndex = Data::seedTsGenLoad;
         break;
     case Data::timeSeriesSolar:
-        xcast->random = &(study.runtime->random[Data::seedTsGenSolar]);
+        seedIndex = Data::seedTsGenSolar;
         break;
     case Data::timeSeriesWind:
-        xcast->random = &(study.runtime->random[Data::seedTsGenWind]);
+        seedIndex = Data::seedTsGenWind;
         break;
     case Data::timeSeriesHydro:
-        xcast->random = &(study.runtime->random[Data::seedTsGenHydro]);
+        seedIndex = Data::seedTsGenHydro;
         break;
     default:
-        xcast->random = nullptr;
+        seedIndex = Data::seedTsGenLoad;
         assert(false and "invalid ts type");
     }
+    xcast->random = &(study.runtime->random[seedIndex]);
+    xcast->seed = study.parameters.seed[seedIndex];
 
     // Run the generation of the time-series
     bool r = xcast->run();
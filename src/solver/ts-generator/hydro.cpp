@@ -32,6 +32,7 @@
 #include <antares/writer/i_writer.h>
 #include "../misc/cholesky.h"
 #include "../misc/matrix-dp-make.h"
+#include "../misc/factorization-cache.h"
 
 using namespace Antares;
 using namespace Yuni;
@@ -130,18 +131,37 @@ bool GenerateHydroTimeSeries(Data::Study& study, uint currentYear, IResultWriter
         }
     }
 
+    // The factorization only depends on the correlations, thus it is the same at each refresh
+    using Cache = FactorizationCache<double>;
+    Cache::Key key(FactorizationKind::matrixDPMakeWithIdentity,
+                   CholeskyAlgorithm(CholeskySummation::sequential),
+                   DIM,
+                   CORRE.entry);
+    auto factorization = Cache::Find(key);
+    if (not factorization)
     {
         double r = MatrixDPMake<double>(
           CHSKY.entry, CORRE.entry, B.entry, nullmatrx, DIM, QCHOLTemp, true);
-        if (r < 1.)
+        if (r < 0.)
         {
             logs.warning() << " TS Generator: Hydro correlation matrix was shrinked by " << r;
-            if (r < 0.)
-                throw FatalError("TS Generator: r must be positive");
+            throw FatalError("TS Generator: r must be positive");
         }
+
+        Cholesky<double>(CHSKY.entry, B.entry, DIM, QCHOLTemp);
+
+        Cache::Factorization result;
+        Cache::CopyTriangle(result.L, CHSKY.entry, DIM);
+        result.shrink = r;
+        result.npsd = (r < 1.);
+        factorization = Cache::Store(key, std::move(result));
     }
+    else
+        Cache::RestoreTriangle(CHSKY.entry, factorization->L, DIM);
 
-    Cholesky<double>(CHSKY.entry, B.entry, DIM, QCHOLTemp);
+    if (factorization->npsd)
+        logs.warning() << " TS Generator: Hydro correlation matrix was shrinked by "
+                       << factorization->shrink;
 
     B.clear();
     CORRE.clear();
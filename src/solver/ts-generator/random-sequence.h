@@ -0,0 +1,63 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_SOLVER_TS_GENERATOR_RANDOM_SEQUENCE_H__
+#define __ANTARES_SOLVER_TS_GENERATOR_RANDOM_SEQUENCE_H__
+
+#include <yuni/yuni.h>
+#include <cstdint>
+
+namespace Antares::Solver::TSGenerator
+{
+namespace Detail
+{
+inline uint64_t splitMix64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+} // namespace Detail
+
+/*!
+** \brief Seed of an independent random sequence
+**
+** It only depends on the seed of the ts-generator, the year of the generation and the index
+** of what is generated (a cluster, a time-series...), so that the time-series don't depend on
+** the number of threads, nor on the order of the generation.
+*/
+inline uint RandomSequenceSeed(uint seed, uint year, uint index)
+{
+    uint64_t x = Detail::splitMix64(seed);
+    x = Detail::splitMix64(x ^ year);
+    x = Detail::splitMix64(x ^ index);
+    return static_cast<uint>(x >> 32);
+}
+
+} // namespace Antares::Solver::TSGenerator
+
+#endif // __ANTARES_SOLVER_TS_GENERATOR_RANDOM_SEQUENCE_H__
@@ -25,7 +25,12 @@
 ** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
 */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <yuni/yuni.h>
 #include <yuni/core/math.h>
@@ -34,11 +39,13 @@
 #include <antares/study/study.h>
 #include <antares/logs/logs.h>
 #include <antares/writer/i_writer.h>
+#include <antares/concurrency/concurrency.h>
 
 #include "../simulation/simulation.h"
 #include "../simulation/sim_structure_donnees.h"
 #include "../simulation/sim_structure_probleme_economique.h"
 #include "../simulation/sim_extern_variables_globales.h"
+#include "random-sequence.h"
 
 using namespace Yuni;
 
@@ -59,10 +66,14 @@ class GeneratorTempData final
 public:
     GeneratorTempData(Data::Study& study,
                       Solver::Progression::Task& progr,
-                      IResultWriter& writer);
+                      IResultWriter& writer,
+                      bool legacyRandomSequence);
 
     void prepareOutputFoldersForAllAreas(uint year);
 
+    //! Start the random sequence of a cluster (not used with the legacy random sequence)
+    void resetRandomSequence(uint seed);
+
     void operator()(Data::Area& area, Data::ThermalCluster& cluster);
 
 public:
@@ -92,6 +103,9 @@ private:
     const uint nbHoursPerYear = HOURS_PER_YEAR;
     const uint daysPerYear = DAYS_PER_YEAR;
 
+    //! Random sequence of the current cluster
+    MersenneTwister pClusterRndGenerator;
+    //! Either the random sequence of the cluster, or the one shared by all clusters (legacy)
     MersenneTwister& rndgenerator;
 
     double AVP[366];
@@ -120,9 +134,11 @@ private:
 
 GeneratorTempData::GeneratorTempData(Data::Study& study,
                                      Solver::Progression::Task& progr,
-                                     IResultWriter& writer) :
+                                     IResultWriter& writer,
+                                     bool legacyRandomSequence) :
     study(study),
-    rndgenerator(study.runtime->random[Data::seedTsGenThermal]),
+    rndgenerator(legacyRandomSequence ? study.runtime->random[Data::seedTsGenThermal]
+                                      : pClusterRndGenerator),
     pProgression(progr),
     pWriter(writer)
 {
@@ -135,6 +151,11 @@ GeneratorTempData::GeneratorTempData(Data::Study& study,
     derated = parameters.derated;
 }
 
+void GeneratorTempData::resetRandomSequence(uint seed)
+{
+    pClusterRndGenerator.reset(seed);
+}
+
 void GeneratorTempData::writeResultsToDisk(const Data::Area& area,
                                            const Data::ThermalCluster& cluster)
 {
@@ -608,38 +629,87 @@ void GeneratorTempData::operator()(Data::Area& area, Data::ThermalCluster& clust
 
     cluster.calculationOfSpinning();
 }
+
+struct ClusterToGenerate
+{
+    Data::Area* area;
+    Data::ThermalCluster* cluster;
+    //! Index of the cluster among all thermal clusters of the study
+    uint index;
+};
 } // namespace
 
 bool GenerateThermalTimeSeries(Data::Study& study,
                                uint year,
                                bool globalThermalTSgeneration,
                                bool refreshTSonCurrentYear,
-                               Antares::Solver::IResultWriter& writer)
+                               Antares::Solver::IResultWriter& writer,
+                               std::shared_ptr<Yuni::Job::QueueService> queueService)
 {
     logs.info();
     logs.info() << "Generating the thermal time-series";
     Solver::Progression::Task progression(study, year, Solver::Progression::sectTSGThermal);
 
-    auto* generator = new GeneratorTempData(study, progression, writer);
-
-    generator->currentYear = year;
+    const bool legacyRandomSequence = study.parameters.legacyThermalTSRandomSequence;
+    const uint seed = study.parameters.seed[Data::seedTsGenThermal];
 
+    std::vector<ClusterToGenerate> clusters;
+    uint clusterIndex = 0;
     study.areas.each([&](Data::Area& area) {
         auto end = area.thermal.list.mapping.end();
-        for (auto it = area.thermal.list.mapping.begin(); it != end; ++it)
+        for (auto it = area.thermal.list.mapping.begin(); it != end; ++it, ++clusterIndex)
         {
             auto& cluster = *(it->second);
 
             if (cluster.doWeGenerateTS(globalThermalTSgeneration) && refreshTSonCurrentYear)
-            {
-                (*generator)(area, cluster);
-            }
-
-            ++progression;
+                clusters.push_back({&area, &cluster, clusterIndex});
+            else
+                ++progression;
         }
     });
 
-    delete generator;
+    auto generate = [&](GeneratorTempData& generator, const ClusterToGenerate& toGenerate) {
+        if (not legacyRandomSequence)
+            generator.resetRandomSequence(RandomSequenceSeed(seed, year, toGenerate.index));
+        generator(*toGenerate.area, *toGenerate.cluster);
+        ++progression;
+    };
+
+    // The legacy random sequence is shared by all clusters, they are generated one after another
+    const bool parallel = not legacyRandomSequence && queueService && queueService->started()
+                          && queueService->maximumThreadCount() > 1 && clusters.size() > 1;
+    if (not parallel)
+    {
+        auto generator
+          = std::make_unique<GeneratorTempData>(study, progression, writer, legacyRandomSequence);
+        generator->currentYear = year;
+        for (const auto& toGenerate : clusters)
+            generate(*generator, toGenerate);
+        return true;
+    }
+
+    // One task per thread, each one with its own temporary data. The clusters are
+    // distributed on demand, since they don't take the same time to be generated.
+    const auto nbTasks
+      = std::min<size_t>(queueService->maximumThreadCount(), clusters.size());
+    std::atomic<size_t> nextCluster = 0;
+    std::vector<Concurrency::TaskFuture> tasks;
+    tasks.reserve(nbTasks);
+    for (size_t t = 0; t != nbTasks; ++t)
+    {
+        tasks.push_back(Concurrency::AddTask(*queueService, [&]() {
+            auto generator = std::make_unique<GeneratorTempData>(study, progression, writer, false);
+            generator->currentYear = year;
+            for (size_t i = nextCluster++; i < clusters.size(); i = nextCluster++)
+                generate(*generator, clusters[i]);
+        }));
+    }
+
+    // Every task must be over before leaving, since they all refer to local data
+    for (auto& task : tasks)
+        task.wait();
+    for (auto& task : tasks)
+        task.get();
 
     return true;
 }
@@ -32,6 +32,7 @@
 #include "constants.h"
 #include "../../misc/cholesky.h"
 #include "../../misc/matrix-dp-make.h"
+#include "../../misc/factorization-cache.h"
 #include "math.hxx"
 
 using namespace Yuni;
@@ -44,237 +45,376 @@ namespace TSGenerator
 {
 namespace XCast
 {
-bool XCast::generateValuesForTheCurrentDay()
+bool XCast::initializeFromParameters(const MonthlyData& monthly)
 {
-    enum
+    const auto& A = monthly.A;
+    const auto& B = monthly.B;
+    const auto& G = monthly.G;
+    const auto& D = monthly.D;
+    const auto& L = monthly.L;
+    const auto& T = monthly.T;
+
+    // The number of processes
+    uint processCount = (uint)pData.localareas.size();
+
+    for (uint s = 0; s != processCount; ++s)
     {
-        nbHoursADay = 24,
-    };
+        if (!verification(A[s], B[s], G[s], D[s], L[s], T[s]))
+        {
+            logs.error() << "TS " << pTSName << " generator: invalid local parameters ("
+                         << (s + 1) << ')';
+            return false;
+        }
+    }
+    // if all processes involve normal law and "accuracy" is high, special simplications will be
+    // made further on
+    All_normal = false;
+    if (pAccuracyOnCorrelation)
+    {
+        All_normal = true;
+        for (uint s = 0; s != processCount; ++s)
+        {
+            if (L[s] != 3)
+                All_normal = false; // s is not a Normal process
+        }
+    }
+    if (All_normal)
+        pAccuracyOnCorrelation = false; // standard accuracy is high accuracy
+    return true;
+}
+
+CholeskySummation XCast::choleskySummation() const
+{
+    return legacyRandomSequence ? CholeskySummation::sequential : CholeskySummation::byPanels;
+}
+
+bool XCast::prepareMonth(MonthlyData& monthly)
+{
+    const auto& A = monthly.A;
+    const auto& B = monthly.B;
+    const auto& G = monthly.G;
+    const auto& D = monthly.D;
+    const auto& L = monthly.L;
+    const auto& T = monthly.T;
+    auto& MAXI = monthly.MAXI;
+    auto& MINI = monthly.MINI;
+    auto& ESPE = monthly.ESPE;
+    auto& STDE = monthly.STDE;
+    auto& Presque_maxi = monthly.Presque_maxi;
+    auto& Presque_mini = monthly.Presque_mini;
+    auto& D_COPIE = monthly.D_COPIE;
+    auto& ALPH = monthly.ALPH;
+    auto& BETA = monthly.BETA;
+    auto& BASI = monthly.BASI;
+    auto& STEP = monthly.STEP;
+    auto* pCorrMonth = monthly.correlation;
+    auto& Triangle_reference = monthly.Triangle_reference.entry;
+    auto& CORR = pCORR.entry;
 
     // The number of processes
     uint processCount = (uint)pData.localareas.size();
-    // shrink
-    float shrink;
 
     // temporary variables
     float x;
 
-    // NDP
-    uint Compteur_ndp = 0;
+    using Cache = FactorizationCache<float>;
 
-    // si le code est appele pour la premiere fois, on initialise tous les
-    // processus par l'esperance des lois marginales
-    if (pNeverInitialized)
+    // The factorizations only depend on the parameters of the month : they are kept from
+    // one refresh of the time-series to the next
+    const uint32_t algorithm = CholeskyAlgorithm(choleskySummation());
+    Cache::Key checkKey(
+      FactorizationKind::positiveDefinitenessCheck, algorithm, processCount, pCorrMonth->entry);
+    auto check = Cache::Find(checkKey);
+    if (not check)
     {
-        pNeverInitialized = false;
-        pNewMonth = true;
-        for (uint s = 0; s != processCount; ++s)
+        Cache::Factorization result;
+        result.npsd = Cholesky<float>(Triangle_reference,
+                                      pCorrMonth->entry,
+                                      processCount,
+                                      pQCHOLTotal.data(),
+                                      choleskySummation());
+        check = Cache::Store(checkKey, std::move(result));
+    }
+
+    if (check->npsd)
+    {
+        // C n'est pas sdp, mais peut-etre proche de sdp
+        // on tente un abattement de 0.999
+        for (uint i = 0; i != processCount; ++i)
         {
-            if (!verification(A[s], B[s], G[s], D[s], L[s], T[s]))
-            {
-                logs.error() << "TS " << pTSName << " generator: invalid local parameters ("
-                             << (s + 1) << ')';
-                return false;
-            }
-            // Il s'agit d'une position relative par rapport a l'esperance
-            POSI[s] = 0.f;
+            // on ne traite qu'en dessous de la diagonale et celle-ci n'a pas change (=1
+            // partout)
+            for (uint j = 0; j < i; ++j)
+                pCorrMonth->entry[i][j] *= 0.999f;
         }
-        // if all processes involve normal law and "accuracy" is high, special simplications will be
-        // made further on
-        All_normal = false;
-        if (pAccuracyOnCorrelation)
+
+        Cache::Key shrinkedKey(FactorizationKind::positiveDefinitenessCheck,
+                               algorithm,
+                               processCount,
+                               pCorrMonth->entry);
+        auto shrinked = Cache::Find(shrinkedKey);
+        if (not shrinked)
         {
-            All_normal = true;
-            for (uint s = 0; s != processCount; ++s)
-            {
-                if (L[s] != 3)
-                    All_normal = false; // s is not a Normal process
-            }
+            Cache::Factorization result;
+            result.npsd = Cholesky<float>(Triangle_reference,
+                                          pCorrMonth->entry,
+                                          processCount,
+                                          pQCHOLTotal.data(),
+                                          choleskySummation());
+            shrinked = Cache::Store(shrinkedKey, std::move(result));
+        }
+        if (shrinked->npsd)
+        {
+            // la matrice C n'est pas admissible, on abandonne
+            logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
+            return false;
         }
-        if (All_normal)
-            pAccuracyOnCorrelation = false; // standard accuracy is high accuracy
     }
 
-    // si les parametres ont change on reinitialise certaines variables intermediaires
-    if (pNewMonth)
+    for (uint s = 0; s != processCount; ++s)
     {
-        if (Cholesky<float>(Triangle_courant, pCorrMonth->entry, processCount, pQCHOLTotal))
-        {
-            // C n'est pas sdp, mais peut-etre proche de sdp
-            // on tente un abattement de 0.999
-            for (uint i = 0; i != processCount; ++i)
-            {
-                // on ne traite qu'en dessous de la diagonale et celle-ci n'a pas change (=1
-                // partout)
-                for (uint j = 0; j < i; ++j)
-                    pCorrMonth->entry[i][j] *= 0.999f;
-            }
+        MAXI[s] = maximum(A[s], B[s], G[s], D[s], L[s]);
+        MINI[s] = 0.f; // minimum(   A[s], B[s], G[s], D[s], L[s]);
+        ESPE[s] = esperance(A[s], B[s], G[s], D[s], L[s]);
+        STDE[s] = standard(A[s], B[s], G[s], D[s], L[s]);
 
-            if (Cholesky<float>(Triangle_courant, pCorrMonth->entry, processCount, pQCHOLTotal))
-            {
-                // la matrice C n'est pas admissible, on abandonne
-                logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
-                return false;
-            }
-        }
+        Presque_maxi[s] = ESPE[s] + (1.f - EPSIBOR) * (MAXI[s] - ESPE[s]);
+        Presque_mini[s] = ESPE[s] + (1.f - EPSIBOR) * (MINI[s] - ESPE[s]);
 
-        for (uint s = 0; s != processCount; ++s)
+        if (Presque_mini[s] > Presque_maxi[s])
         {
-            MAXI[s] = maximum(A[s], B[s], G[s], D[s], L[s]);
-            MINI[s] = 0.f; // minimum(   A[s], B[s], G[s], D[s], L[s]);
-            ESPE[s] = esperance(A[s], B[s], G[s], D[s], L[s]);
-            STDE[s] = standard(A[s], B[s], G[s], D[s], L[s]);
-
-            Presque_maxi[s] = ESPE[s] + (1.f - EPSIBOR) * (MAXI[s] - ESPE[s]);
-            Presque_mini[s] = ESPE[s] + (1.f - EPSIBOR) * (MINI[s] - ESPE[s]);
-
-            if (Presque_mini[s] > Presque_maxi[s])
-            {
-                // les bornes d'ecretement du processus n'encadrent pas l'esperance
-                // de sa loi marginale
-                logs.error() << "TS " << pTSName << " generator: invalid local parameters";
-                return false;
-            }
-            D_COPIE[s] = diffusion(A[s], B[s], G[s], D[s], L[s], T[s], ESPE[s]);
+            // les bornes d'ecretement du processus n'encadrent pas l'esperance
+            // de sa loi marginale
+            logs.error() << "TS " << pTSName << " generator: invalid local parameters";
+            return false;
         }
+        D_COPIE[s] = diffusion(A[s], B[s], G[s], D[s], L[s], T[s], ESPE[s]);
+    }
 
-        if (All_normal) // special initialization
+    if (All_normal) // special initialization
+    {
+        for (uint s = 0; s != processCount; ++s)
         {
-            for (uint s = 0; s != processCount; ++s)
-            {
-                ALPH[s] = float(exp(-T[s]));
-                BETA[s] = float(sqrt(1 - ALPH[s] * ALPH[s]));
-                BASI[s] = (1.f - ALPH[s]) * ESPE[s];
-            }
+            ALPH[s] = float(exp(-T[s]));
+            BETA[s] = float(sqrt(1 - ALPH[s] * ALPH[s]));
+            BASI[s] = (1.f - ALPH[s]) * ESPE[s];
         }
-        if (All_normal)
+    }
+    if (All_normal)
+    {
+        // assessement of a correlation matrix suitable for the month
+        for (uint s = 0; s != processCount; ++s)
         {
-            // assessement of a correlation matrix suitable for the month
-            for (uint s = 0; s != processCount; ++s)
+            for (uint t = 0; t < s; ++t)
             {
-                for (uint t = 0; t < s; ++t)
+                x = T[s] * T[t] * STDE[s] * STDE[t];
+                if (Math::Zero(x))
+                    CORR[s][t] = 0.f;
+                else
                 {
-                    x = T[s] * T[t] * STDE[s] * STDE[t];
-                    if (Math::Zero(x))
-                        CORR[s][t] = 0.f;
+                    x = 1.f - ALPH[s] * ALPH[t];
+                    x /= BETA[s];
+                    x /= BETA[t];
+                    CORR[s][t] = (*pCorrMonth)[s][t] * x;
+                    if (CORR[s][t] > 1.f)
+                    {
+                        CORR[s][t] = 1.f;
+                        ++pLevellingCount;
+                    }
                     else
                     {
-                        x = 1.f - ALPH[s] * ALPH[t];
-                        x /= BETA[s];
-                        x /= BETA[t];
-                        CORR[s][t] = (*pCorrMonth)[s][t] * x;
-                        if (CORR[s][t] > 1.f)
+                        if (CORR[s][t] < -1.f)
                         {
-                            CORR[s][t] = 1.f;
+                            CORR[s][t] = -1.f;
                             ++pLevellingCount;
                         }
-                        else
-                        {
-                            if (CORR[s][t] < -1.f)
-                            {
-                                CORR[s][t] = -1.f;
-                                ++pLevellingCount;
-                            }
-                        }
                     }
                 }
-
-                // plus loin Mtrx_dp_make  a besoin de savoir que la diagonale vaut 1
-                CORR[s][s] = 1.f;
             }
+
+            // plus loin Mtrx_dp_make  a besoin de savoir que la diagonale vaut 1
+            CORR[s][s] = 1.f;
         }
-        else
+    }
+    else
+    {
+        // on calcule une ebauche de matrice utilisable pour tout le mois dans le cas ou
+        // accuracy =0
+        for (uint s = 0; s != processCount; ++s)
         {
-            // on calcule une ebauche de matrice utilisable pour tout le mois dans le cas ou
-            // accuracy =0
-            for (uint s = 0; s != processCount; ++s)
+            for (uint t = 0; t < s; ++t)
             {
-                for (uint t = 0; t < s; ++t)
+                x = T[s] * T[t] * STDE[s] * STDE[t];
+                float z = D_COPIE[t] * STDE[s];
+                if (Math::Zero(x))
+                    CORR[s][t] = 0.f;
+                else
                 {
-                    x = T[s] * T[t] * STDE[s] * STDE[t];
-                    float z = D_COPIE[t] * STDE[s];
-                    if (Math::Zero(x))
-                        CORR[s][t] = 0.f;
+                    x = D_COPIE[s] * STDE[t] / z;
+                    CORR[s][t] = (*pCorrMonth)[s][t] * (x + 1.f / x) / 2.f;
+                    if (CORR[s][t] > 1.f)
+                    {
+                        CORR[s][t] = 1.f;
+                        ++pLevellingCount;
+                    }
                     else
                     {
-                        x = D_COPIE[s] * STDE[t] / z;
-                        CORR[s][t] = (*pCorrMonth)[s][t] * (x + 1.f / x) / 2.f;
-                        if (CORR[s][t] > 1.f)
+                        if (CORR[s][t] < -1.f)
                         {
-                            CORR[s][t] = 1.f;
+                            CORR[s][t] = -1.f;
                             ++pLevellingCount;
                         }
-                        else
-                        {
-                            if (CORR[s][t] < -1.f)
-                            {
-                                CORR[s][t] = -1.f;
-                                ++pLevellingCount;
-                            }
-                        }
                     }
                 }
-
-                // plus loin Mtrx_dp_make  a besoin de savoir que la diagonale vaut 1
-                CORR[s][s] = 1.f;
             }
+
+            // plus loin Mtrx_dp_make  a besoin de savoir que la diagonale vaut 1
+            CORR[s][s] = 1.f;
         }
+    }
 
-        // calcul et factorisation de la matrice  du mois
-        shrink = MatrixDPMake<float>(
-          Triangle_courant, CORR, Carre_reference, pCorrMonth->entry, processCount, pQCHOLTotal);
+    // calcul et factorisation de la matrice  du mois
+    Cache::Key key(
+      FactorizationKind::matrixDPMake, algorithm, processCount, CORR, pCorrMonth->entry);
+    auto factorization = Cache::Find(key);
+    if (not factorization)
+    {
+        float shrink = MatrixDPMake<float>(Triangle_reference,
+                                           CORR,
+                                           monthly.Carre_reference.entry,
+                                           pCorrMonth->entry,
+                                           processCount,
+                                           pQCHOLTotal.data(),
+                                           false,
+                                           choleskySummation());
         if (shrink == -1.f)
         {
             // sortie impossible  car on a v�rifi� que C est d.p
             logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
             return false;
         }
-        // sert pour le decompte final des matrices ndp quand accuracy=0
-        Compteur_ndp = (shrink < 1.f) ? 100 : 0;
 
-        // calcul du pas de temps
-        STEP = 1.f;
-        if (!All_normal)
+        Cache::Factorization result;
+        Cache::CopyTriangle(result.L, Triangle_reference, processCount);
+        Cache::CopyTriangle(result.B, monthly.Carre_reference.entry, processCount);
+        result.shrink = shrink;
+        result.npsd = (shrink < 1.f);
+        factorization = Cache::Store(key, std::move(result));
+    }
+    else
+    {
+        Cache::RestoreTriangle(Triangle_reference, factorization->L, processCount);
+        Cache::RestoreTriangle(monthly.Carre_reference.entry, factorization->B, processCount);
+    }
+    // sert pour le decompte final des matrices ndp quand accuracy=0
+    monthly.ndp = factorization->npsd;
+
+    // calcul du pas de temps
+    STEP = 1.f;
+    if (!All_normal)
+    {
+        for (uint s = 0; s != processCount; ++s)
         {
-            for (uint s = 0; s != processCount; ++s)
+            x = 1.f;
+            if (T[s] > PETIT)
+                x = PETIT / T[s];
+            if (x < STEP)
+            {
+                // plafonne le terme lineaire de retour � la moyenne a PETIT *(ecart � la
+                // moyenne)
+                STEP = x;
+            }
+
+            x = maxiDiffusion(A[s], B[s], G[s], D[s], L[s], T[s]);
+            if (x > 0.f)
             {
-                x = 1.f;
-                if (T[s] > PETIT)
-                    x = PETIT / T[s];
+                x = STDE[s] / x;
+                x *= x;
+                // plafonne l'amplitude de la diffusion � 2*sqrt(PETIT)*STDE (pour brown=1)
+                x *= 4.f * PETIT;
                 if (x < STEP)
-                {
-                    // plafonne le terme lineaire de retour � la moyenne a PETIT *(ecart � la
-                    // moyenne)
                     STEP = x;
-                }
-
-                x = maxiDiffusion(A[s], B[s], G[s], D[s], L[s], T[s]);
-                if (x > 0.f)
-                {
-                    x = STDE[s] / x;
-                    x *= x;
-                    // plafonne l'amplitude de la diffusion � 2*sqrt(PETIT)*STDE (pour brown=1)
-                    x *= 4.f * PETIT;
-                    if (x < STEP)
-                        STEP = x;
-                }
             }
         }
-        if (STEP < float(1e-2))
-        {
-            // on borne pour prevenir l'overflow
-            STEP = float(1e-2);
-            Nombre_points_intermediaire = 100;
-        }
-        else
-        {
-            // 1e-2 <= STEP <= 1.
-            Nombre_points_intermediaire = (uint)(1.f / STEP);
-            STEP = 1.f / float(Nombre_points_intermediaire);
-        }
+    }
+    if (STEP < float(1e-2))
+    {
+        // on borne pour prevenir l'overflow
+        STEP = float(1e-2);
+        monthly.Nombre_points_intermediaire = 100;
+    }
+    else
+    {
+        // 1e-2 <= STEP <= 1.
+        monthly.Nombre_points_intermediaire = (uint)(1.f / STEP);
+        STEP = 1.f / float(monthly.Nombre_points_intermediaire);
+    }
+
+    monthly.SQST = sqrt(STEP);
+    return true;
+}
+
+bool XCast::generateValuesForTheCurrentDay(const MonthlyData& monthly,
+                                           GenerationData& data,
+                                           bool newMonth)
+{
+    enum
+    {
+        nbHoursADay = 24,
+    };
+
+    // Parameters of the month, shared by all time-series
+    const auto& A = monthly.A;
+    const auto& B = monthly.B;
+    const auto& G = monthly.G;
+    const auto& D = monthly.D;
+    const auto& M = monthly.M;
+    const auto& T = monthly.T;
+    const auto& L = monthly.L;
+    const auto& BO = monthly.BO;
+    const auto& MA = monthly.MA;
+    const auto& MI = monthly.MI;
+    const auto& FO = monthly.FO.entry;
+    const auto& MAXI = monthly.MAXI;
+    const auto& MINI = monthly.MINI;
+    const auto& Presque_maxi = monthly.Presque_maxi;
+    const auto& Presque_mini = monthly.Presque_mini;
+    const auto& ESPE = monthly.ESPE;
+    const auto& STDE = monthly.STDE;
+    const auto& ALPH = monthly.ALPH;
+    const auto& BETA = monthly.BETA;
+    const auto& BASI = monthly.BASI;
+    const auto& Carre_reference = monthly.Carre_reference.entry;
+    const float STEP = monthly.STEP;
+    const float SQST = monthly.SQST;
+    const auto* pCorrMonth = monthly.correlation;
+
+    // State of the processes of the time-series
+    auto& POSI = data.POSI;
+    auto& DIFF = data.DIFF;
+    auto& TREN = data.TREN;
+    auto& WIEN = data.WIEN;
+    auto& BROW = data.BROW;
+    auto& LISS = data.LISS.entry;
+    auto& DATL = data.DATL.entry;
+    auto& DATA = data.DATA.entry;
+    auto& CORR = data.CORR.entry;
+    auto& Carre_courant = data.Carre_courant.entry;
+    // The Cholesky factor of the month, unless a matrix is computed for each point
+    float** Triangle_courant = pAccuracyOnCorrelation ? data.Triangle_courant.entry
+                                                      : monthly.Triangle_reference.entry;
+
+    // The number of processes
+    uint processCount = (uint)pData.localareas.size();
+    // shrink
+    float shrink;
 
-        SQST = sqrt(STEP);
+    // temporary variables
+    float x;
 
+    // si les parametres ont change on reinitialise certaines variables intermediaires
+    if (newMonth)
+    {
         // traduction en position absolue (MINI,MAXI) des positions relatives (-1,+1)
         // des processus issues du dernier appel (ou de l'initialisation si premier
         // appel) en fonction des donnees du mois courant
@@ -321,17 +461,12 @@ bool XCast::generateValuesForTheCurrentDay()
         }
     }
 
-    // debut du calcul de la serie de points
-    // pComputedPointCount = 0;
-    // pNDPMatrixCount     = 0;
-    // pLevellingCount     = 0;
-
     for (uint i = 0; i != nbHoursADay; ++i)
     {
         // recherche du prochain point horaire
-        for (uint l = 0; l != Nombre_points_intermediaire; ++l)
+        for (uint l = 0; l != monthly.Nombre_points_intermediaire; ++l)
         {
-            ++pComputedPointCount;
+            ++data.computedPointCount;
             if (All_normal) // special simple case
             {
                 // draw independent Nomal Variables
@@ -339,7 +474,7 @@ bool XCast::generateValuesForTheCurrentDay()
                 if ((processCount - 2 * (processCount / 2)) != 0)
                     ++j;
                 for (uint k = 0; k < j; ++k)
-                    normal(WIEN[k], WIEN[j - (1 + k)]);
+                    normal(*data.random, WIEN[k], WIEN[j - (1 + k)]);
 
                 // correlated brownian motions
                 for (uint s = 0; s != processCount; ++s)
@@ -392,14 +527,14 @@ bool XCast::generateValuesForTheCurrentDay()
                                 if (c > 1.f)
                                 {
                                     c = 1.f;
-                                    ++pLevellingCount;
+                                    ++data.levellingCount;
                                 }
                                 else
                                 {
                                     if (c < -1.f)
                                     {
                                         c = -1.f;
-                                        ++pLevellingCount;
+                                        ++data.levellingCount;
                                     }
                                 }
                                 corr_s[t] = c;
@@ -414,7 +549,9 @@ bool XCast::generateValuesForTheCurrentDay()
                                                  Carre_courant,
                                                  Carre_reference,
                                                  processCount,
-                                                 pQCHOLTotal);
+                                                 data.QCHOL.data(),
+                                                 false,
+                                                 choleskySummation());
                     if (shrink <= 1.f)
                     {
                         if (shrink == -1.f)
@@ -425,7 +562,7 @@ bool XCast::generateValuesForTheCurrentDay()
                             return false;
                         }
                         if (shrink < 1.f)
-                            ++pNDPMatrixCount;
+                            ++data.NDPMatrixCount;
                     }
                 } // accuracy
 
@@ -434,7 +571,7 @@ bool XCast::generateValuesForTheCurrentDay()
                 if ((processCount - 2 * (processCount / 2)) != 0)
                     ++j;
                 for (uint k = 0; k < j; ++k)
-                    normal(WIEN[k], WIEN[j - (1 + k)]);
+                    normal(*data.random, WIEN[k], WIEN[j - (1 + k)]);
 
                 // calcul des mouvements browniens correles
                 for (uint s = 0; s != processCount; ++s)
@@ -548,8 +685,8 @@ bool XCast::generateValuesForTheCurrentDay()
     }
 
     // fin de la serie
-    if (!pAccuracyOnCorrelation && Compteur_ndp == 100)
-        ++pNDPMatrixCount;
+    if (!pAccuracyOnCorrelation && newMonth && monthly.ndp)
+        ++data.NDPMatrixCount;
 
     return true;
 }
@@ -36,6 +36,11 @@
 #include <limits>
 #include <yuni/io/directory.h>
 #include <antares/study/area/constants.h>
+#include <antares/concurrency/concurrency.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include "../random-sequence.h"
 
 using namespace Yuni;
 
@@ -68,9 +73,63 @@ XCast::XCast(Data::Study& study, Data::TimeSeriesType ts, IResultWriter& writer)
 {
 }
 
-XCast::~XCast()
+XCast::~XCast() = default;
+
+void XCast::MonthlyData::resize(uint processCount)
+{
+    uint p = processCount;
+    A.resize(p);
+    B.resize(p);
+    G.resize(p);
+    D.resize(p);
+    M.resize(p);
+    T.resize(p);
+    L.resize(p);
+    BO.resize(p);
+    MA.resize(p);
+    MI.resize(p);
+    FO.resize(p, 24);
+
+    MAXI.resize(p);
+    MINI.resize(p);
+    Presque_maxi.resize(p);
+    Presque_mini.resize(p);
+    ESPE.resize(p);
+    STDE.resize(p);
+    D_COPIE.resize(p);
+
+    BASI.resize(p);
+    ALPH.resize(p);
+    BETA.resize(p);
+
+    Triangle_reference.resize(p, p);
+    Carre_reference.resize(p, p);
+}
+
+XCast::GenerationData::GenerationData(uint processCount)
+{
+    uint p = processCount;
+    POSI.assign(p, 0.f);
+    DIFF.resize(p);
+    TREN.resize(p);
+    WIEN.resize(p + 1);
+    BROW.resize(p);
+    LISS.resize(p, 24);
+    DATL.resize(p, 24);
+    DATA.resize(p, 24);
+
+    CORR.resize(p, p);
+    Triangle_courant.resize(p, p);
+    Carre_courant.resize(p, p);
+    QCHOL.resize(p);
+}
+
+void XCast::GenerationData::reset(uint seed)
 {
-    destroyTemporaryData();
+    ownRandom.reset(seed);
+    random = &ownRandom;
+    // Il s'agit d'une position relative par rapport a l'esperance
+    std::fill(POSI.begin(), POSI.end(), 0.f);
 }
 
 template<class PredicateT>
@@ -106,7 +165,7 @@ void XCast::exportTimeSeriesToTheOutput(Progression::Task& progression, Predicat
 }
 
 template<class PredicateT>
-void XCast::applyTransferFunction(PredicateT& predicate)
+void XCast::applyTransferFunction(PredicateT& predicate, GenerationData& data)
 {
     enum
     {
@@ -133,9 +192,7 @@ void XCast::applyTransferFunction(PredicateT& predicate)
     {
         if (pUseConversion[s])
         {
-            auto& data = predicate.xcastData(*(pData.localareas[s]));
-
-            auto& tf = data.conversion;
+            auto& tf = predicate.xcastData(*(pData.localareas[s])).conversion;
 
             uint last_i = 0;
 
@@ -156,7 +213,7 @@ void XCast::applyTransferFunction(PredicateT& predicate)
                 b[i] = (p0[y] * p1[x] - p1[y] * p0[x]) / (p1[x] - p0[x]);
             }
 
-            dailyResults = DATA[s];
+            dailyResults = data.DATA.entry[s];
             for (h = 0; h != nbHoursADay; ++h)
             {
                 for (i = 0; i != tf.width; ++i)
@@ -211,171 +268,192 @@ void XCast::updateMissingCoefficients(PredicateT& predicate)
     }
 }
 
-namespace
-{
-template<int DebugT>
-class Allocator
+template<class PredicateT>
+void XCast::loadMonthlyParameters(PredicateT& predicate, uint month, MonthlyData& monthly)
 {
-public:
-    Allocator() : allocated(0)
-    {
-    }
-    ~Allocator()
-    {
-        logs.debug() << "  allocated " << (allocated / 1024) << "Ko";
-    }
-    template<class T>
-    inline T* allocate(const size_t s)
+    enum
     {
-        allocated += sizeof(T) * s;
-        return new T[s];
-    }
+        nbHoursADay = 24,
+    };
 
-public:
-    size_t allocated;
-};
+    uint realmonth = study.calendar.months[month].realmonth;
 
-template<>
-class Allocator<0>
-{
-public:
-    template<class T>
-    inline T* allocate(const size_t s) const
-    {
-        return new T[s];
-    }
-};
+    monthly.correlation = pData.correlation[realmonth];
 
-} // namespace
+    auto& A = monthly.A;
+    auto& B = monthly.B;
+    auto& G = monthly.G;
+    auto& D = monthly.D;
+    auto& M = monthly.M;
+    auto& T = monthly.T;
+    auto& L = monthly.L;
+    auto& BO = monthly.BO;
+    auto& MA = monthly.MA;
+    auto& MI = monthly.MI;
+    auto& FO = monthly.FO.entry;
 
-void XCast::allocateTemporaryData()
-{
-    uint p = (uint)pData.localareas.size();
-
-    Allocator<Yuni::Logs::Verbosity::Debug::enabled> m;
-
-    A = m.allocate<float>(p);
-    B = m.allocate<float>(p);
-    G = m.allocate<float>(p);
-    D = m.allocate<float>(p);
-    M = m.allocate<int>(p);
-    T = m.allocate<float>(p);
-    BO = m.allocate<bool>(p);
-    MA = m.allocate<float>(p);
-    MI = m.allocate<float>(p);
-    L = m.allocate<Data::XCast::Distribution>(p);
-    POSI = m.allocate<float>(p);
-    MAXI = m.allocate<float>(p);
-    MINI = m.allocate<float>(p);
-    ESPE = m.allocate<float>(p);
-    STDE = m.allocate<float>(p);
-    DIFF = m.allocate<float>(p);
-    TREN = m.allocate<float>(p);
-    WIEN = m.allocate<float>(p + 1);
-    BROW = m.allocate<float>(p);
-
-    BASI = m.allocate<float>(p);
-    ALPH = m.allocate<float>(p);
-    BETA = m.allocate<float>(p);
-
-    D_COPIE = m.allocate<float>(p);
-
-    pUseConversion = m.allocate<bool>(p);
-
-    Presque_maxi = m.allocate<float>(p);
-    Presque_mini = m.allocate<float>(p);
-    pQCHOLTotal = m.allocate<float>(p);
-
-    CORR = m.allocate<float*>(p);
-    Triangle_reference = m.allocate<float*>(p);
-    Triangle_courant = m.allocate<float*>(p);
-    FO = m.allocate<float*>(p);
-    LISS = m.allocate<float*>(p);
-    DATL = m.allocate<float*>(p);
-    DATA = m.allocate<float*>(p);
-    Carre_courant = m.allocate<float*>(p);
-    Carre_reference = m.allocate<float*>(p);
-
-    for (uint i = 0; i != p; ++i)
+    for (uint s = 0; s != pData.localareas.size(); ++s)
     {
-        Triangle_reference[i] = m.allocate<float>(p);
-        Triangle_courant[i] = m.allocate<float>(p);
-        Carre_courant[i] = m.allocate<float>(p);
-        Carre_reference[i] = m.allocate<float>(p);
-
-        CORR[i] = m.allocate<float>(p);
-        FO[i] = m.allocate<float>(24);
-        LISS[i] = m.allocate<float>(24);
-        DATL[i] = m.allocate<float>(24);
-        DATA[i] = m.allocate<float>(24);
+        auto& xcastdata = predicate.xcastData(*(pData.localareas[s]));
+        A[s] = xcastdata.data[alpha][realmonth];
+        B[s] = xcastdata.data[beta][realmonth];
+        G[s] = xcastdata.data[gamma][realmonth];
+        D[s] = xcastdata.data[delta][realmonth];
+        M[s] = (int)xcastdata.data[mu][realmonth];
+        T[s] = xcastdata.data[theta][realmonth];
+        L[s] = xcastdata.distribution;
+
+        switch (xcastdata.distribution)
+        {
+        case Data::XCast::dtUniform:
+        {
+            BO[s] = true;
+            MI[s] = G[s];
+            MA[s] = D[s];
+            break;
+        }
+        case Data::XCast::dtBeta:
+        {
+            BO[s] = true;
+            MI[s] = G[s];
+            MA[s] = D[s];
+            break;
+        }
+        case Data::XCast::dtNormal:
+        {
+            BO[s] = false;
+            MI[s] = -std::numeric_limits<float>::max();
+            MA[s] = +std::numeric_limits<float>::max();
+            break;
+        }
+        default:
+        {
+            BO[s] = false;
+            MI[s] = G[s];
+            MA[s] = +std::numeric_limits<float>::max();
+        }
+        }
+        memcpy(FO[s], xcastdata.K[realmonth], sizeof(float) * nbHoursADay);
     }
 }
 
-void XCast::destroyTemporaryData()
+template<class PredicateT>
+void XCast::generateTimeSeries(PredicateT& predicate,
+                               GenerationData& data,
+                               uint tsIndex,
+                               Progression::Task& progression)
 {
-    if (!pNeverInitialized)
+    enum
     {
-        uint p = (uint)pData.localareas.size();
-        for (uint i = 0; i != p; ++i)
+        nbHoursADay = 24,
+    };
+
+    const uint processCount = (uint)pData.localareas.size();
+    auto& DATA = data.DATA.entry;
+
+    uint hourInTheYear = 0;
+
+    for (uint month = 0; month != 12; ++month)
+    {
+        const auto& monthly = pMonthly[month];
+
+        uint nbDaysPerMonth = study.calendar.months[month].days;
+        for (uint j = 0; j != nbDaysPerMonth; ++j)
         {
-            delete[] CORR[i];
-            delete[] FO[i];
-            delete[] LISS[i];
-            delete[] DATL[i];
-            delete[] Triangle_reference[i];
-            delete[] Triangle_courant[i];
-            delete[] DATA[i];
-            delete[] Carre_courant[i];
-            delete[] Carre_reference[i];
+            if (not generateValuesForTheCurrentDay(monthly, data, j == 0))
+                throw FatalError("xcast: Failed to generate values.");
+
+#ifndef NDEBUG
+
+            for (uint s = 0; s != processCount; ++s)
+            {
+                float* dailyResults = DATA[s];
+
+                for (uint h = 0; h != nbHoursADay; ++h)
+                {
+                    assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
+                }
+            }
+#endif
+
+            for (uint s = 0; s != processCount; ++s)
+            {
+                assert(s < pData.localareas.size() && "Bound checking");
+                auto& currentArea = *pData.localareas[s];
+
+                auto& srcData = predicate.xcastData(currentArea);
+                if (srcData.useTranslation != Data::XCast::tsTranslationBeforeConversion)
+                    continue;
+
+                auto& column = srcData.translation[0];
+                float* dailyResults = DATA[s];
+                assert(hourInTheYear + nbHoursADay <= srcData.translation.height
+                       && "Bound checking");
+
+                for (uint h = 0; h != nbHoursADay; ++h)
+                {
+                    assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
+                    dailyResults[h] += (float)column[hourInTheYear + h];
+                }
+            }
+
+            applyTransferFunction(predicate, data);
+
+#ifndef NDEBUG
+
+            for (uint s = 0; s != processCount; ++s)
+            {
+                float* dailyResults = DATA[s];
+
+                for (uint h = 0; h != nbHoursADay; ++h)
+                {
+                    assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
+                }
+            }
+#endif
+
+            for (uint s = 0; s != processCount; ++s)
+            {
+                assert(s < pData.localareas.size() && "Bound checking");
+                auto& currentArea = *pData.localareas[s];
+
+                auto& srcData = predicate.xcastData(currentArea);
+
+                auto& series = predicate.matrix(currentArea);
+                assert(tsIndex < series.width);
+                auto& column = series.column(tsIndex);
+                float* dailyResults = DATA[s];
+
+                for (uint h = 0; h != nbHoursADay; ++h)
+                {
+                    assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
+                    dailyResults[h] *= (float)srcData.capacity;
+                }
+
+                if (srcData.useTranslation == Data::XCast::tsTranslationAfterConversion)
+                {
+                    assert(hourInTheYear + nbHoursADay <= srcData.translation.height
+                           && "Bound checking");
+                    auto& tsavg = srcData.translation[0];
+                    for (uint h = 0; h != nbHoursADay; ++h)
+                        dailyResults[h] += (float)tsavg[hourInTheYear + h];
+                }
+
+                assert(hourInTheYear + nbHoursADay <= series.height && "Bound checking");
+                for (uint h = 0; h != nbHoursADay; ++h)
+                    column[hourInTheYear + h] = Math::Round(dailyResults[h]);
+
+                ++progression;
+            }
+
+            hourInTheYear += nbHoursADay;
         }
-        delete[] Carre_courant;
-        delete[] Carre_reference;
-        delete[] D_COPIE;
-        delete[] DATA;
-        delete[] Triangle_reference;
-        delete[] Triangle_courant;
-        delete[] LISS;
-        delete[] DATL;
-        delete[] CORR;
-        delete[] FO;
-        delete[] A;
-        delete[] B;
-        delete[] G;
-        delete[] D;
-        delete[] M;
-        delete[] T;
-        delete[] L;
-        delete[] BO;
-        delete[] MA;
-        delete[] MI;
-        delete[] POSI;
-        delete[] MAXI;
-        delete[] MINI;
-        delete[] Presque_maxi;
-        delete[] Presque_mini;
-        delete[] ESPE;
-        delete[] STDE;
-        delete[] DIFF;
-        delete[] TREN;
-        delete[] WIEN;
-        delete[] BROW;
-        delete[] BASI;
-        delete[] ALPH;
-        delete[] BETA;
-        delete[] pQCHOLTotal;
-        delete[] pUseConversion;
     }
 }
 
 template<class PredicateT>
 bool XCast::runWithPredicate(PredicateT& predicate, Progression::Task& progression)
 {
-    enum
-    {
-
-        nbHoursADay = 24,
-    };
-
     pTSName = predicate.timeSeriesName();
 
     {
@@ -399,8 +477,7 @@ bool XCast::runWithPredicate(PredicateT& predicate, Progression::Task& progressi
 
         loadFromStudy(predicate.correlation(study), predicate);
 
-        allocateTemporaryData();
-
+        pUseConversion.resize(pData.localareas.size());
         for (uint s = 0; s != pData.localareas.size(); ++s)
         {
             auto& area = *(pData.localareas[s]);
@@ -430,168 +507,99 @@ bool XCast::runWithPredicate(PredicateT& predicate, Progression::Task& progressi
 
     updateMissingCoefficients(predicate);
 
-    pComputedPointCount = 0;
-    pNDPMatrixCount = 0;
-    pLevellingCount = 0;
-
-    for (uint tsIndex = 0; tsIndex != nbTimeseries; ++tsIndex)
+    // The parameters of the months, and the factorization of their correlation matrices,
+    // are shared by all time-series
+    pCORR.resize(processCount, processCount);
+    pQCHOLTotal.resize(processCount);
+    for (uint month = 0; month != 12; ++month)
     {
-        uint hourInTheYear = 0;
+        pMonthly[month].resize(processCount);
+        loadMonthlyParameters(predicate, month, pMonthly[month]);
 
-        for (uint month = 0; month != 12; ++month)
+        // si le code est appele pour la premiere fois, on verifie les parametres des
+        // processus, qui seront initialises par l'esperance des lois marginales
+        if (pNeverInitialized)
         {
-            uint realmonth = study.calendar.months[month].realmonth;
-
-            pNewMonth = true;
-
-            pCorrMonth = pData.correlation[realmonth];
-
-            for (uint s = 0; s != processCount; ++s)
-            {
-                assert(s < pData.localareas.size() && "Bound checking");
-                auto& xcastdata = predicate.xcastData(*(pData.localareas[s]));
-                A[s] = xcastdata.data[alpha][realmonth];
-                B[s] = xcastdata.data[beta][realmonth];
-                G[s] = xcastdata.data[gamma][realmonth];
-                D[s] = xcastdata.data[delta][realmonth];
-                M[s] = (int)xcastdata.data[mu][realmonth];
-                T[s] = xcastdata.data[theta][realmonth];
-                L[s] = xcastdata.distribution;
-
-                switch (xcastdata.distribution)
-                {
-                case Data::XCast::dtUniform:
-                {
-                    BO[s] = true;
-                    MI[s] = G[s];
-                    MA[s] = D[s];
-                    break;
-                }
-                case Data::XCast::dtBeta:
-                {
-                    BO[s] = true;
-                    MI[s] = G[s];
-                    MA[s] = D[s];
-                    break;
-                }
-                case Data::XCast::dtNormal:
-                {
-                    BO[s] = false;
-                    MI[s] = -std::numeric_limits<float>::max();
-                    MA[s] = +std::numeric_limits<float>::max();
-                    break;
-                }
-                default:
-                {
-                    BO[s] = false;
-                    MI[s] = G[s];
-                    MA[s] = +std::numeric_limits<float>::max();
-                }
-                }
-                memcpy(FO[s], xcastdata.K[realmonth], sizeof(float) * nbHoursADay);
-            }
-
-            uint nbDaysPerMonth = study.calendar.months[month].days;
-            for (uint j = 0; j != nbDaysPerMonth; ++j)
-            {
-                if (not generateValuesForTheCurrentDay())
-                    throw FatalError("xcast: Failed to generate values.");
-
-#ifndef NDEBUG
-
-                for (uint s = 0; s != processCount; ++s)
-                {
-                    float* dailyResults = DATA[s];
-
-                    for (uint h = 0; h != nbHoursADay; ++h)
-                    {
-                        assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
-                    }
-                }
-#endif
-
-                for (uint s = 0; s != processCount; ++s)
-                {
-                    assert(s < pData.localareas.size() && "Bound checking");
-                    auto& currentArea = *pData.localareas[s];
-
-                    auto& srcData = predicate.xcastData(currentArea);
-                    if (srcData.useTranslation != Data::XCast::tsTranslationBeforeConversion)
-                        continue;
-
-                    auto& column = srcData.translation[0];
-                    float* dailyResults = DATA[s];
-                    assert(hourInTheYear + nbHoursADay <= srcData.translation.height
-                           && "Bound checking");
-
-                    for (uint h = 0; h != nbHoursADay; ++h)
-                    {
-                        assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
-                        dailyResults[h] += (float)column[hourInTheYear + h];
-                    }
-                }
-
-                applyTransferFunction(predicate);
-
-#ifndef NDEBUG
+            if (not initializeFromParameters(pMonthly[month]))
+                throw FatalError("xcast: Failed to generate values.");
+            pNeverInitialized = false;
+            pLegacyData = std::make_unique<GenerationData>(processCount);
+        }
 
-                for (uint s = 0; s != processCount; ++s)
-                {
-                    float* dailyResults = DATA[s];
+        if (not prepareMonth(pMonthly[month]))
+            throw FatalError("xcast: Failed to generate values.");
+    }
 
-                    for (uint h = 0; h != nbHoursADay; ++h)
-                    {
-                        assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
-                    }
-                }
-#endif
+    uint computedPointCount = 0;
+    uint NDPMatrixCount = 0;
+    auto addStatistics = [&](const GenerationData& data) {
+        computedPointCount += data.computedPointCount;
+        NDPMatrixCount += data.NDPMatrixCount;
+        pLevellingCount += data.levellingCount;
+    };
 
-                for (uint s = 0; s != processCount; ++s)
+    // The legacy random sequence is shared by all time-series, and the processes go on
+    // from a time-series to the next one : they are generated one after another
+    const bool parallel = not legacyRandomSequence && queueService && queueService->started()
+                          && queueService->maximumThreadCount() > 1 && nbTimeseries > 1;
+    if (legacyRandomSequence)
+    {
+        auto& data = *pLegacyData;
+        data.random = random;
+        data.computedPointCount = 0;
+        data.NDPMatrixCount = 0;
+        data.levellingCount = 0;
+        for (uint tsIndex = 0; tsIndex != nbTimeseries; ++tsIndex)
+            generateTimeSeries(predicate, data, tsIndex, progression);
+        addStatistics(data);
+    }
+    else if (not parallel)
+    {
+        GenerationData data(processCount);
+        for (uint tsIndex = 0; tsIndex != nbTimeseries; ++tsIndex)
+        {
+            data.reset(RandomSequenceSeed(seed, year, tsIndex));
+            generateTimeSeries(predicate, data, tsIndex, progression);
+        }
+        addStatistics(data);
+    }
+    else
+    {
+        // One task per thread, each one with its own state of the processes. Each time-series
+        // has its own random sequence, so that they don't depend on the number of threads.
+        const auto nbTasks
+          = std::min<size_t>(queueService->maximumThreadCount(), nbTimeseries);
+        std::atomic<uint> nextTimeSeries = 0;
+        std::mutex statisticsMutex;
+        std::vector<Concurrency::TaskFuture> tasks;
+        tasks.reserve(nbTasks);
+        for (size_t t = 0; t != nbTasks; ++t)
+        {
+            tasks.push_back(Concurrency::AddTask(*queueService, [&]() {
+                GenerationData data(processCount);
+                for (uint tsIndex = nextTimeSeries++; tsIndex < nbTimeseries;
+                     tsIndex = nextTimeSeries++)
                 {
-                    assert(s < pData.localareas.size() && "Bound checking");
-                    auto& currentArea = *pData.localareas[s];
-
-                    auto& srcData = predicate.xcastData(currentArea);
-
-                    auto& series = predicate.matrix(currentArea);
-                    assert(tsIndex < series.width);
-                    auto& column = series.column(tsIndex);
-                    float* dailyResults = DATA[s];
-
-                    for (uint h = 0; h != nbHoursADay; ++h)
-                    {
-                        assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
-                        dailyResults[h] *= (float)srcData.capacity;
-                    }
-
-                    if (srcData.useTranslation == Data::XCast::tsTranslationAfterConversion)
-                    {
-                        assert(hourInTheYear + nbHoursADay <= srcData.translation.height
-                               && "Bound checking");
-                        auto& tsavg = srcData.translation[0];
-                        for (uint h = 0; h != nbHoursADay; ++h)
-                            dailyResults[h] += (float)tsavg[hourInTheYear + h];
-                    }
-
-                    assert(hourInTheYear + nbHoursADay <= series.height && "Bound checking");
-                    for (uint h = 0; h != nbHoursADay; ++h)
-                        column[hourInTheYear + h] = Math::Round(dailyResults[h]);
-
-                    ++progression;
+                    data.reset(RandomSequenceSeed(seed, year, tsIndex));
+                    generateTimeSeries(predicate, data, tsIndex, progression);
                 }
-
-                hourInTheYear += nbHoursADay;
-
-                pNewMonth = false;
-            }
+                std::lock_guard lock(statisticsMutex);
+                addStatistics(data);
+            }));
         }
+
+        // Every task must be over before leaving, since they all refer to local data
+        for (auto& task : tasks)
+            task.wait();
+        for (auto& task : tasks)
+            task.get();
     }
 
     {
-        uint y = ((pAccuracyOnCorrelation) ? pComputedPointCount : (nbTimeseries * 365));
-        uint z = pNDPMatrixCount;
+        uint y = ((pAccuracyOnCorrelation) ? computedPointCount : (nbTimeseries * 365));
+        uint z = NDPMatrixCount;
 
-        logs.info() << "  " << pComputedPointCount << " points calculated, using " << y
+        logs.info() << "  " << computedPointCount << " points calculated, using " << y
                     << " correlation matrices, out of which " << z << " were npsd and transformed";
     }
 
@@ -32,7 +32,11 @@
 #include <antares/mersenne-twister/mersenne-twister.h>
 #include <antares/writer/i_writer.h>
 #include "studydata.h"
+#include "../../misc/cholesky.h"
 #include <yuni/core/noncopyable.h>
+#include <yuni/job/queue/service.h>
+#include <memory>
+#include <vector>
 
 namespace Antares
 {
@@ -106,18 +110,142 @@ public:
     //! The time-series type
     const Data::TimeSeriesType timeSeriesType;
 
-    //! The random generator to use
+    //! The random generator to use (legacy random sequence)
     MersenneTwister* random;
+    //! Seed of the random sequences of the time-series
+    uint seed = 0;
+    //! Generate all time-series one after another, from the single random sequence
+    bool legacyRandomSequence = true;
+    //! The queue service to generate the time-series in parallel, if any and if it is started
+    std::shared_ptr<Yuni::Job::QueueService> queueService;
 
 private:
-    void allocateTemporaryData();
-    void destroyTemporaryData();
+    /*!
+    ** \brief Parameters of the processes for a month
+    **
+    ** They don't depend on the time-series being generated, they are computed once and
+    ** shared by all time-series.
+    */
+    struct MonthlyData
+    {
+        void resize(uint processCount);
+
+        //! The correlation matrix of the month
+        const Matrix<float>* correlation = nullptr;
+
+        std::vector<float> A;
+        std::vector<float> B;
+        std::vector<float> G;
+        std::vector<float> D;
+        std::vector<int> M;
+        std::vector<float> T;
+        std::vector<Data::XCast::Distribution> L;
+        std::vector<bool> BO;
+        std::vector<float> MA;
+        std::vector<float> MI;
+        Matrix<float> FO; // contrainte : FO >=0
+
+        std::vector<float> MAXI;
+        std::vector<float> MINI;
+        std::vector<float> Presque_maxi;
+        std::vector<float> Presque_mini;
+        std::vector<float> ESPE;
+        std::vector<float> STDE;
+        std::vector<float> D_COPIE;
+
+        std::vector<float> BASI; // used only if all processes are Normal
+        std::vector<float> ALPH; // used only if all processes are Normal
+        std::vector<float> BETA; // used only if all processes are Normal
+
+        //! Cholesky factor of the correlations of the month
+        Matrix<float> Triangle_reference;
+        Matrix<float> Carre_reference;
+
+        float STEP = 1.f;
+        float SQST = 1.f;
+        uint Nombre_points_intermediaire = 1;
+        //! True if the correlation matrix of the month is not positive definite
+        bool ndp = false;
+    };
+
+    /*!
+    ** \brief State of the processes while generating a time-series
+    **
+    ** Each thread has its own one.
+    */
+    struct GenerationData
+    {
+        explicit GenerationData(uint processCount);
+
+        //! Restart the processes from their expectations, with a new random sequence
+        void reset(uint seed);
+
+        //! Random sequence of the time-series
+        MersenneTwister ownRandom;
+        //! The random generator to use
+        MersenneTwister* random = &ownRandom;
+
+        std::vector<float> POSI;
+        std::vector<float> DIFF;
+        std::vector<float> TREN;
+        std::vector<float> WIEN;
+        std::vector<float> BROW;
+        Matrix<float> LISS;
+        Matrix<float> DATL;
+        Matrix<float> DATA;
+
+        // Matrices computed for each point, when the accuracy on correlations is required
+        Matrix<float> CORR;
+        Matrix<float> Triangle_courant;
+        Matrix<float> Carre_courant;
+        // cholesky temporary data
+        std::vector<float> QCHOL;
+
+        // Statistics
+        //! The number of computed points
+        uint computedPointCount = 0;
+        uint NDPMatrixCount = 0;
+        uint levellingCount = 0;
+    };
 
     template<class PredicateT>
     void updateMissingCoefficients(PredicateT& predicate);
     template<class PredicateT>
     bool runWithPredicate(PredicateT& predicate, Progression::Task& progression);
 
+    /*!
+    ** \brief Load the parameters of the processes for a month
+    */
+    template<class PredicateT>
+    void loadMonthlyParameters(PredicateT& predicate, uint month, MonthlyData& monthly);
+
+    /*!
+    ** \brief Check the parameters of the processes, the first time the generator is used
+    */
+    bool initializeFromParameters(const MonthlyData& monthly);
+
+    /*!
+    ** \brief Compute the data of a month shared by all time-series (Cholesky factor...)
+    */
+    bool prepareMonth(MonthlyData& monthly);
+
+    /*!
+    ** \brief Order of the additions of the Cholesky factorizations
+    **
+    ** The legacy random sequence keeps the order of the previous versions, so that its
+    ** time-series are unchanged.
+    */
+    CholeskySummation choleskySummation() const;
+
+    /*!
+    ** \brief Generate a time-series for all processes
+    */
+    template<class PredicateT>
+    void generateTimeSeries(PredicateT& predicate,
+                            GenerationData& data,
+                            uint tsIndex,
+                            Progression::Task& progression);
+
     /*!
     ** \brief Export all time-series for each process into the output folder
     */
@@ -168,84 +296,40 @@ private:
     *Gamma de forme a, d'échelle b et définie pour x>g
     ** \endcode
     */
-    bool generateValuesForTheCurrentDay();
+    bool generateValuesForTheCurrentDay(const MonthlyData& monthly,
+                                        GenerationData& data,
+                                        bool newMonth);
 
     template<class PredicateT>
-    void applyTransferFunction(PredicateT& predicate);
+    void applyTransferFunction(PredicateT& predicate, GenerationData& data);
 
     //! Tirage de deux variables normales centrees et reduites
-    void normal(float& x, float& y);
+    static void normal(MersenneTwister& random, float& x, float& y);
 
 private:
     //! Some data after transformation
     StudyData pData;
 
-    //! The correlation matrix for the current month
-    const Matrix<float>* pCorrMonth;
-
     bool pNeverInitialized;
-    uint Nombre_points_intermediaire;
 
-    //! True when starting a new month (some data may have to be reinitialized)
-    bool pNewMonth;
+    //! Parameters of the processes, for each month of the simulation
+    MonthlyData pMonthly[12];
+    //! State of the processes of the legacy random sequence, kept from a time-series to the next
+    std::unique_ptr<GenerationData> pLegacyData;
 
     // Statistics
-    //! The number of computed points a day
-    uint pComputedPointCount;
-    uint pNDPMatrixCount;
-    uint pLevellingCount;
+    uint pLevellingCount = 0;
 
     bool pAccuracyOnCorrelation;
     bool All_normal; // all processes are Normal
 
-    float* A; // les variables de A à CO sont des vues de ALPH à CORR pour un mois particulier
-    float* B;
-    float* G;
-    float* D;
-    int* M;
-    float* T;
-    Data::XCast::Distribution* L;
-    bool* BO;
-    float* MA;
-    float* MI;
-    float** FO; // contrainte : FO >=0
-
-    float STEP;
-    float SQST;
-    float* POSI;
-    float** CORR;
-    float* MAXI;
-    float* MINI;
-    float* Presque_maxi;
-    float* Presque_mini;
-    float* ESPE;
-    float* STDE;
-    float** LISS;
-    float** DATL;
-
-    float* DIFF;
-    float* TREN;
-    float* WIEN;
-    float* BROW;
-
-    float* BASI; // used only if all processes are Normal
-    float* ALPH; // used only if all processes are Normal
-    float* BETA; // used only if all processes are Normal
-
-    float** Triangle_reference;
-    float** Triangle_courant;
-    float** Carre_reference;
-    float** Carre_courant;
-
-    float* D_COPIE;
-
-    float** DATA;
-
+    //! Pseudo-correlation matrix of the month, temporary
+    Matrix<float> pCORR;
     // cholesky temporary data
-    float* pQCHOLTotal;
+    std::vector<float> pQCHOLTotal;
 
     //!
-    bool* pUseConversion;
+    std::vector<bool> pUseConversion;
 
     //! Name of the current timeseries
     Yuni::CString<32, false> pTSName;
@@ -0,0 +1,57 @@
+#include "lp_names.h"
+#include <algorithm>
+
+namespace Antares::Optimization
+{
+namespace
+{
+const char* const timeStepTypes[] = {"hour", "day", "week"};
+} // namespace
+
+std::string LpNames::operator[](unsigned int index) const
+{
+    const LpName& name = names_[index];
+    if (!name.elementType)
+        return std::string();
+
+    long long timeStep = name.timeStep;
+    const long long weeks = (long long)week_ - (long long)weekOfTheTimeSteps_;
+    switch (name.timeStepType)
+    {
+    case TimeStepType::hour:
+        timeStep += 168 * weeks;
+        break;
+    case TimeStepType::week:
+        timeStep += weeks;
+        break;
+    case TimeStepType::day: // Days are numbered within the week
+        break;
+    }
+
+    std::string result;
+    result.reserve(64);
+    result += name.elementType;
+    result += "::";
+    if (name.location)
+        result += *name.location;
+    result += "::";
+    result += timeStepTypes[(int)name.timeStepType];
+    result += '<';
+    result += std::to_string(timeStep);
+    result += '>';
+    std::replace(result.begin(), result.end(), ' ', '*');
+    return result;
+}
+
+const std::string* LpNames::intern(std::initializer_list<std::string_view> parts)
+{
+    buffer_.clear();
+    for (auto part : parts)
+        buffer_.append(part.data(), part.size());
+
+    auto it = strings_.find(buffer_);
+    if (it == strings_.end())
+        it = strings_.insert(buffer_).first;
+    return &(*it);
+}
+} // namespace Antares::Optimization
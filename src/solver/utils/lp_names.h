@@ -0,0 +1,111 @@
+#pragma once
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace Antares
+{
+namespace Optimization
+{
+enum class TimeStepType : unsigned char
+{
+    hour,
+    day,
+    week
+};
+
+/*!
+** \brief Compact description of the name of a variable or of a constraint
+**
+** The name itself, "<elementType>::<location>::<timeStepType><<timeStep>>" with blanks
+** replaced by '*', is only built when it is asked for (named problems, MPS export,
+** infeasibility analysis).
+*/
+struct LpName
+{
+    //! Type of the element, e.g. "NODU", or name of the binding constraint (static or interned)
+    const char* elementType = nullptr;
+    //! Location of the element, e.g. "area<fr>::ThermalCluster<base>" (interned)
+    const std::string* location = nullptr;
+    TimeStepType timeStepType = TimeStepType::hour;
+    //! Time step, relative to the beginning of the year
+    unsigned int timeStep = 0;
+    //! Constraint relaxed by the infeasibility analysis (binding constraints, fictive loads and
+    //! hydro levels)
+    bool relaxable = false;
+};
+
+/*!
+** \brief Names of the variables (or of the constraints) of a LP
+**
+** The structure of the weekly problems is built once and reused for every week, so are the
+** names : the hourly and weekly time steps are shifted to the current week when a name is
+** built.
+*/
+class LpNames
+{
+public:
+    void resize(size_t size)
+    {
+        names_.resize(size);
+    }
+
+    size_t size() const
+    {
+        return names_.size();
+    }
+
+    void set(unsigned int index, const LpName& name)
+    {
+        names_[index] = name;
+    }
+
+    //! True if the element has no name
+    bool empty(unsigned int index) const
+    {
+        return names_[index].elementType == nullptr;
+    }
+
+    void setRelaxable(unsigned int index)
+    {
+        names_[index].relaxable = true;
+    }
+
+    bool relaxable(unsigned int index) const
+    {
+        return names_[index].relaxable;
+    }
+
+    //! The full name of an element, empty if it has none
+    std::string operator[](unsigned int index) const;
+
+    //! Intern a string made of several parts, it remains valid as long as the names
+    const std::string* intern(std::initializer_list<std::string_view> parts);
+
+    //! The time steps of the names were given for the week `week`
+    void setWeekOfTheTimeSteps(unsigned int week)
+    {
+        weekOfTheTimeSteps_ = week;
+        week_ = week;
+    }
+
+    //! Names are built for the week `week`
+    void setWeek(unsigned int week)
+    {
+        week_ = week;
+    }
+
+private:
+    std::vector<LpName> names_;
+    //! Interned strings (locations and names of the binding constraints)
+    std::unordered_set<std::string> strings_;
+    //! Temporary used for the lookups
+    std::string buffer_;
+    unsigned int weekOfTheTimeSteps_ = 0;
+    unsigned int week_ = 0;
+};
+} // namespace Optimization
+} // namespace Antares
@@ -0,0 +1,216 @@
+#include "mps_serializer.h"
+
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+extern "C"
+{
+#include "spx_constantes_externes.h"
+}
+
+namespace Antares::Optimization
+{
+namespace
+{
+const char* const objectiveName = "OBJECTIVE";
+
+void appendNumber(std::string& output, double value)
+{
+    char buffer[32];
+#if defined(__cpp_lib_to_chars)
+    // Shortest representation that is read back as the same value
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    output.append(buffer, result.ptr);
+#else
+    int size = snprintf(buffer, sizeof(buffer), "%.15g", value);
+    if (strtod(buffer, nullptr) != value)
+        size = snprintf(buffer, sizeof(buffer), "%.17g", value);
+    output.append(buffer, size);
+#endif
+}
+
+std::string elementName(const LpNames& names, bool named, char prefix, unsigned int index)
+{
+    if (named && !names.empty(index))
+        return names[index];
+    return prefix + std::to_string(index);
+}
+
+void appendEntry(std::string& output,
+                 const std::string& column,
+                 const std::string& row,
+                 double value)
+{
+    output += "    ";
+    output += column;
+    output += "  ";
+    output += row;
+    output += "  ";
+    appendNumber(output, value);
+    output += '\n';
+}
+
+void appendBound(std::string& output, const char* type, const std::string& column)
+{
+    output += ' ';
+    output += type;
+    output += " BOUNDS  ";
+    output += column;
+    output += '\n';
+}
+
+void appendBound(std::string& output, const char* type, const std::string& column, double value)
+{
+    output += ' ';
+    output += type;
+    output += " BOUNDS  ";
+    output += column;
+    output += "  ";
+    appendNumber(output, value);
+    output += '\n';
+}
+
+void appendMarker(std::string& output, const char* marker)
+{
+    output += "    MARKER  'MARKER'  '";
+    output += marker;
+    output += "'\n";
+}
+} // namespace
+
+void SerializeToMPS(const PROBLEME_SIMPLEXE_NOMME& problem, std::string& output)
+{
+    const int nbVariables = problem.NombreDeVariables;
+    const int nbConstraints = problem.NombreDeContraintes;
+    const bool named = problem.UseNamedProblems();
+
+    // The MPS format is column-wise, while the matrix is stored by rows
+    std::vector<int> columnStart(nbVariables + 1, 0);
+    for (int row = 0; row < nbConstraints; ++row)
+    {
+        const int begin = problem.IndicesDebutDeLigne[row];
+        const int end = begin + problem.NombreDeTermesDesLignes[row];
+        for (int k = begin; k < end; ++k)
+            ++columnStart[problem.IndicesColonnes[k] + 1];
+    }
+    for (int column = 0; column < nbVariables; ++column)
+        columnStart[column + 1] += columnStart[column];
+
+    std::vector<int> rows(columnStart[nbVariables]);
+    std::vector<double> coefficients(columnStart[nbVariables]);
+    {
+        std::vector<int> cursor(columnStart.begin(), columnStart.end() - 1);
+        for (int row = 0; row < nbConstraints; ++row)
+        {
+            const int begin = problem.IndicesDebutDeLigne[row];
+            const int end = begin + problem.NombreDeTermesDesLignes[row];
+            for (int k = begin; k < end; ++k)
+            {
+                const int position = cursor[problem.IndicesColonnes[k]]++;
+                rows[position] = row;
+                coefficients[position] = problem.CoefficientsDeLaMatriceDesContraintes[k];
+            }
+        }
+    }
+
+    // Rows are named once, since they appear in every column
+    std::vector<std::string> rowNames(nbConstraints);
+    for (int row = 0; row < nbConstraints; ++row)
+        rowNames[row] = elementName(problem.ConstraintNames(), named, 'c', row);
+
+    output.reserve(output.size() + 48 * ((size_t)rows.size() + nbVariables + nbConstraints));
+
+    output += "NAME          Antares\nROWS\n N  ";
+    output += objectiveName;
+    output += '\n';
+    for (int row = 0; row < nbConstraints; ++row)
+    {
+        switch (problem.Sens[row])
+        {
+        case '=':
+            output += " E  ";
+            break;
+        case '<':
+            output += " L  ";
+            break;
+        default:
+            output += " G  ";
+            break;
+        }
+        output += rowNames[row];
+        output += '\n';
+    }
+
+    output += "COLUMNS\n";
+    const std::string objective(objectiveName);
+    bool integerColumns = false;
+    for (int column = 0; column < nbVariables; ++column)
+    {
+        const bool isInteger = problem.IntegerVariable(column);
+        if (isInteger != integerColumns)
+        {
+            appendMarker(output, isInteger ? "INTORG" : "INTEND");
+            integerColumns = isInteger;
+        }
+
+        const auto name = elementName(problem.VariableNames(), named, 'x', column);
+        const double cost = problem.CoutLineaire[column];
+        // A column must appear at least once
+        if (cost != 0. || columnStart[column] == columnStart[column + 1])
+            appendEntry(output, name, objective, cost);
+        for (int k = columnStart[column]; k < columnStart[column + 1]; ++k)
+            appendEntry(output, name, rowNames[rows[k]], coefficients[k]);
+    }
+    if (integerColumns)
+        appendMarker(output, "INTEND");
+
+    output += "RHS\n";
+    for (int row = 0; row < nbConstraints; ++row)
+    {
+        if (problem.SecondMembre[row] != 0.)
+        {
+            output += "    RHS  ";
+            output += rowNames[row];
+            output += "  ";
+            appendNumber(output, problem.SecondMembre[row]);
+            output += '\n';
+        }
+    }
+
+    output += "BOUNDS\n";
+    for (int column = 0; column < nbVariables; ++column)
+    {
+        const auto name = elementName(problem.VariableNames(), named, 'x', column);
+        const double xmin = problem.Xmin[column];
+        const double xmax = problem.Xmax[column];
+        switch (problem.TypeDeVariable[column])
+        {
+        case VARIABLE_FIXE:
+            appendBound(output, "FX", name, xmin);
+            break;
+        case VARIABLE_BORNEE_DES_DEUX_COTES:
+            if (xmin != 0.)
+                appendBound(output, "LO", name, xmin);
+            appendBound(output, "UP", name, xmax);
+            break;
+        case VARIABLE_BORNEE_INFERIEUREMENT:
+            if (xmin != 0.)
+                appendBound(output, "LO", name, xmin);
+            // The default upper bound of the integer variables may be 1 for some readers
+            if (problem.IntegerVariable(column))
+                appendBound(output, "PL", name);
+            break;
+        case VARIABLE_BORNEE_SUPERIEUREMENT:
+            appendBound(output, "MI", name);
+            appendBound(output, "UP", name, xmax);
+            break;
+        default:
+            appendBound(output, "FR", name);
+            break;
+        }
+    }
+    output += "ENDATA\n";
+}
+} // namespace Antares::Optimization
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include "named_problem.h"
+
+namespace Antares
+{
+namespace Optimization
+{
+/*!
+** \brief Write a problem in free MPS format into a buffer
+**
+** The problem is read from its sparse rows, the names of the variables and of the constraints
+** are only built when the problem is named ("x<index>" and "c<index>" otherwise, as in the
+** OR-Tools models).
+**
+** \param problem The problem
+** \param output  The buffer, the MPS is appended to it
+*/
+void SerializeToMPS(const PROBLEME_SIMPLEXE_NOMME& problem, std::string& output);
+} // namespace Optimization
+} // namespace Antares
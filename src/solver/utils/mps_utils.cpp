@@ -49,74 +49,23 @@ constexpr size_t OPT_APPEL_SOLVEUR_BUFFER_SIZE = 256;
 #include <algorithm>
 #include "filename.h"
 #include "../optimisation/opt_constants.h"
-#include "name_translator.h"
+#include "mps_serializer.h"
 
 using namespace Yuni;
 
 #define SEP IO::Separator
 
-class ProblemConverter
-{
-public:
-    void copyProbSimplexeToProbMps(PROBLEME_MPS* dest, PROBLEME_SIMPLEXE_NOMME* src, NameTranslator& nameTranslator)
-    {
-        // Variables
-        dest->NbVar = src->NombreDeVariables;
-
-        mVariableType.resize(src->NombreDeVariables);
-        for (int var = 0; var < src->NombreDeVariables; var++)
-            mVariableType[var] = src->VariablesEntieres[var] ? SRS_INTEGER_VAR : SRS_CONTINUOUS_VAR;
-
-        dest->TypeDeVariable = mVariableType.data();
-        dest->TypeDeBorneDeLaVariable = src->TypeDeVariable; // VARIABLE_BORNEE_DES_DEUX_COTES,
-                                                             // VARIABLE_BORNEE_INFERIEUREMENT, etc.
-
-        dest->Umax = src->Xmax;
-        dest->Umin = src->Xmin;
-
-        // Objective function
-        dest->L = src->CoutLineaire;
-
-        // Constraints (sparse)
-        dest->NbCnt = src->NombreDeContraintes;
-        dest->Mdeb = src->IndicesDebutDeLigne;
-        dest->A = src->CoefficientsDeLaMatriceDesContraintes;
-        dest->Nuvar = src->IndicesColonnes;
-        dest->NbTerm = src->NombreDeTermesDesLignes;
-        dest->B = src->SecondMembre;
-        dest->SensDeLaContrainte = src->Sens;
-
-        // Names
-        dest->LabelDeLaVariable = nameTranslator.translate(src->VariableNames(), mVariableNames);
-        dest->LabelDeLaContrainte = nameTranslator.translate(src->ConstraintNames(), mConstraintNames);
-    }
-
-private:
-    std::vector<int> mVariableType;
-    std::vector<char*> mVariableNames;
-    std::vector<char*> mConstraintNames;
-};
-
 void OPT_EcrireJeuDeDonneesLineaireAuFormatMPS(PROBLEME_SIMPLEXE_NOMME* Prob,
                                                Solver::IResultWriter& writer,
                                                const std::string& filename)
 {
     logs.info() << "Solver MPS File: `" << filename << "'";
 
-    const auto tmpPath = generateTempPath(filename);
-
-    auto mps = std::make_shared<PROBLEME_MPS>();
-    {
-        auto translator = NameTranslator::create(Prob->UseNamedProblems());
-        ProblemConverter
-          converter; // This object must not be destroyed until SRSwritempsprob has been run
-        converter.copyProbSimplexeToProbMps(mps.get(), Prob, *translator);
-        SRSwritempsprob(mps.get(), tmpPath.c_str());
-    }
-
-    writer.addEntryFromFile(filename, tmpPath);
-
-    removeTemporaryFile(tmpPath);
+    // The MPS is written in memory, then moved to the writer, that writes (or compresses) it
+    // in the background
+    std::string content;
+    SerializeToMPS(*Prob, content);
+    writer.addEntryFromBuffer(filename, content);
 }
 
 // --------------------
@@ -4,8 +4,6 @@ extern "C"
 {
 #include "spx_definition_arguments.h"
 #include "spx_fonctions.h"
-
-#include "srs_api.h"
 }
 
 #include "named_problem.h"
@@ -4,8 +4,8 @@
 namespace Antares::Optimization
 {
 
-PROBLEME_SIMPLEXE_NOMME::PROBLEME_SIMPLEXE_NOMME(const std::vector<std::string>& NomDesVariables,
-                                                 const std::vector<std::string>& NomDesContraintes,
+PROBLEME_SIMPLEXE_NOMME::PROBLEME_SIMPLEXE_NOMME(const LpNames& NomDesVariables,
+                                                 const LpNames& NomDesContraintes,
                                                  const std::vector<bool>& VariablesEntieres,
                                                  std::vector<int>& StatutDesVariables,
                                                  std::vector<int>& StatutDesContraintes,
@@ -2,6 +2,7 @@
 
 #include "spx_definition_arguments.h"
 #include "spx_fonctions.h"
+#include "lp_names.h"
 
 #include <vector>
 #include <string>
@@ -15,8 +16,8 @@ namespace Optimization
 struct PROBLEME_SIMPLEXE_NOMME : public PROBLEME_SIMPLEXE
 {
 public:
-    PROBLEME_SIMPLEXE_NOMME(const std::vector<std::string>& NomDesVariables,
-                            const std::vector<std::string>& NomDesContraintes,
+    PROBLEME_SIMPLEXE_NOMME(const LpNames& NomDesVariables,
+                            const LpNames& NomDesContraintes,
                             const std::vector<bool>& VariablesEntieres,
                             std::vector<int>& StatutDesVariables,
                             std::vector<int>& StatutDesContraintes,
@@ -24,8 +25,8 @@ public:
                             bool SolverLogs);
 
 private:
-    const std::vector<std::string>& NomDesVariables;
-    const std::vector<std::string>& NomDesContraintes;
+    const LpNames& NomDesVariables;
+    const LpNames& NomDesContraintes;
     bool useNamedProblems_;
     bool solverLogs_;
 
@@ -47,12 +48,12 @@ public:
         useNamedProblems_ = useNamedProblems;
     }
 
-    const std::vector<std::string>& VariableNames() const
+    const LpNames& VariableNames() const
     {
         return NomDesVariables;
     }
 
-    const std::vector<std::string>& ConstraintNames() const
+    const LpNames& ConstraintNames() const
     {
         return NomDesContraintes;
     }
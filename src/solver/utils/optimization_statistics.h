@@ -14,6 +14,9 @@ private:
     std::atomic<long long> totalUpdateTime;
     std::atomic<unsigned int> nbUpdate;
 
+    std::atomic<long long> totalBuildTime;
+    std::atomic<unsigned int> nbBuild;
+
 public:
     void reset()
     {
@@ -21,6 +24,8 @@ public:
         nbSolve = 0;
         totalUpdateTime = 0;
         nbUpdate = 0;
+        totalBuildTime = 0;
+        nbBuild = 0;
     }
 
     OptimizationStatistics()
@@ -33,7 +38,9 @@ public:
         totalSolveTime(rhs.totalSolveTime.load()),
         nbSolve(rhs.nbSolve.load()),
         totalUpdateTime(rhs.totalUpdateTime.load()),
-        nbUpdate(rhs.nbUpdate.load())
+        nbUpdate(rhs.nbUpdate.load()),
+        totalBuildTime(rhs.totalBuildTime.load()),
+        nbBuild(rhs.nbBuild.load())
     {}
 
     OptimizationStatistics(const OptimizationStatistics&) = delete;
@@ -46,6 +53,8 @@ public:
         totalUpdateTime += other.totalUpdateTime;
         nbSolve += other.nbSolve;
         nbUpdate += other.nbUpdate;
+        totalBuildTime += other.totalBuildTime;
+        nbBuild += other.nbBuild;
     }
 
     void addUpdateTime(long long updateTime)
@@ -54,6 +63,12 @@ public:
         nbUpdate++;
     }
 
+    void addBuildTime(long long buildTime)
+    {
+        totalBuildTime += buildTime;
+        nbBuild++;
+    }
+
     void addSolveTime(long long solveTime)
     {
         totalSolveTime += solveTime;
@@ -75,6 +90,16 @@ public:
         return totalUpdateTime;
     }
 
+    unsigned int getNbBuild() const
+    {
+        return nbBuild;
+    }
+
+    long long getTotalBuildTime() const
+    {
+        return totalBuildTime;
+    }
+
     double getAverageUpdateTime() const
     {
         if (nbUpdate == 0)
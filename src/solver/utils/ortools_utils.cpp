@@ -3,7 +3,6 @@
 #include <antares/logs/logs.h>
 #include <antares/exception/AssertionError.hpp>
 #include <antares/Enum.hpp>
-#include <filesystem>
 
 using namespace operations_research;
 
@@ -54,7 +53,6 @@ MPSolver* ProblemSimplexeNommeConverter::Convert()
     // Create constraints and set coefs
     CopyRows(solver);
 
-    CopyMatrix(solver);
     if (problemeSimplexe_->SolverLogs())
     {
         solver->EnableOutput();
@@ -80,22 +78,16 @@ void ProblemSimplexeNommeConverter::TuneSolverSpecificOptions(MPSolver* solver)
     }
 }
 
-void ProblemSimplexeNommeConverter::CopyMatrix(const MPSolver* solver)
+void ProblemSimplexeNommeConverter::CopyMatrixRow(unsigned idxRow,
+                                                  MPConstraint* const ct,
+                                                  const std::vector<MPVariable*>& variables)
 {
-    auto variables = solver->variables();
-    auto constraints = solver->constraints();
-
-    for (int idxRow = 0; idxRow < problemeSimplexe_->NombreDeContraintes; ++idxRow)
+    const int debutLigne = problemeSimplexe_->IndicesDebutDeLigne[idxRow];
+    const int finLigne = debutLigne + problemeSimplexe_->NombreDeTermesDesLignes[idxRow];
+    for (int pos = debutLigne; pos < finLigne; ++pos)
     {
-        MPConstraint* const ct = constraints[idxRow];
-        int debutLigne = problemeSimplexe_->IndicesDebutDeLigne[idxRow];
-        for (int idxCoef = 0; idxCoef < problemeSimplexe_->NombreDeTermesDesLignes[idxRow];
-             ++idxCoef)
-        {
-            int pos = debutLigne + idxCoef;
-            ct->SetCoefficient(variables[problemeSimplexe_->IndicesColonnes[pos]],
-                               problemeSimplexe_->CoefficientsDeLaMatriceDesContraintes[pos]);
-        }
+        ct->SetCoefficient(variables[problemeSimplexe_->IndicesColonnes[pos]],
+                           problemeSimplexe_->CoefficientsDeLaMatriceDesContraintes[pos]);
     }
 }
 
@@ -120,7 +112,7 @@ void ProblemSimplexeNommeConverter::CopyVariables(MPSolver* solver)
     }
 }
 
-void ProblemSimplexeNommeConverter::UpdateContraints(unsigned idxRow, MPSolver* solver)
+MPConstraint* ProblemSimplexeNommeConverter::UpdateContraints(unsigned idxRow, MPSolver* solver)
 {
     double bMin = -MPSolver::infinity(), bMax = MPSolver::infinity();
     if (problemeSimplexe_->Sens[idxRow] == '=')
@@ -136,14 +128,17 @@ void ProblemSimplexeNommeConverter::UpdateContraints(unsigned idxRow, MPSolver*
         bMin = problemeSimplexe_->SecondMembre[idxRow];
     }
 
-    solver->MakeRowConstraint(bMin, bMax, constraintNameManager_.GetName(idxRow));
+    return solver->MakeRowConstraint(bMin, bMax, constraintNameManager_.GetName(idxRow));
 }
 
 void ProblemSimplexeNommeConverter::CopyRows(MPSolver* solver)
 {
+    // Rows are filled as soon as they are created, in a single pass over the CSR matrix
+    const auto& variables = solver->variables();
     for (int idxRow = 0; idxRow < problemeSimplexe_->NombreDeContraintes; ++idxRow)
     {
-        UpdateContraints(idxRow, solver);
+        MPConstraint* const ct = UpdateContraints(idxRow, solver);
+        CopyMatrixRow(idxRow, ct, variables);
     }
 }
 
@@ -212,50 +207,20 @@ static void extract_from_MPSolver(MPSolver* solver,
     }
 }
 
-std::string generateTempPath(const std::string& filename)
-{
-    namespace fs = std::filesystem;
-    std::ostringstream tmpPath;
-    tmpPath << fs::temp_directory_path().string() << Yuni::IO::SeparatorAsString << filename;
-    return tmpPath.str();
-}
-
-void removeTemporaryFile(const std::string& tmpPath)
-{
-    namespace fs = std::filesystem;
-    bool ret = false;
-    try
-    {
-        ret = fs::remove(tmpPath);
-    }
-    catch (fs::filesystem_error& e)
-    {
-        Antares::logs.error() << e.what();
-    }
-    if (!ret)
-    {
-        Antares::logs.warning() << "Could not remove temporary file " << tmpPath;
-    }
-}
-
 void ORTOOLS_EcrireJeuDeDonneesLineaireAuFormatMPS(MPSolver* solver,
                                                    Antares::Solver::IResultWriter& writer,
                                                    const std::string& filename)
 {
-    // 0. Logging file name
     Antares::logs.info() << "Solver OR-Tools MPS File: `" << filename << "'";
 
-    // 1. Determine filename
-    const auto tmpPath = generateTempPath(filename);
-
-    // 2. Write MPS to temporary file
-    solver->Write(tmpPath);
-
-    // 3. Copy to real output using generic writer
-    writer.addEntryFromFile(filename, tmpPath);
-
-    // 4. Remove tmp file
-    removeTemporaryFile(tmpPath);
+    // The MPS is exported in memory, then moved to the writer
+    std::string content;
+    if (!solver->ExportModelAsMpsFormat(/*fixed_format=*/false, /*obfuscated=*/false, &content))
+    {
+        Antares::logs.error() << "Could not export the MPS file " << filename;
+        return;
+    }
+    writer.addEntryFromBuffer(filename, content);
 }
 
 bool solveAndManageStatus(MPSolver* solver, int& resultStatus, const MPSolverParameters& params)
@@ -365,6 +330,38 @@ void ORTOOLS_CorrigerLesBornes(MPSolver* solver,
     }
 }
 
+void ORTOOLS_ModifierLaMatriceDesContraintes(MPSolver* solver,
+                                             const int* indicesDebutDeLigne,
+                                             const int* nombreDeTermesDesLignes,
+                                             const double* coefficients,
+                                             const int* indicesColonnes,
+                                             int nbRow)
+{
+    const auto& variables = solver->variables();
+    const auto& constraints = solver->constraints();
+    for (int idxRow = 0; idxRow < nbRow; ++idxRow)
+    {
+        MPConstraint* const ct = constraints[idxRow];
+        const int debutLigne = indicesDebutDeLigne[idxRow];
+        const int finLigne = debutLigne + nombreDeTermesDesLignes[idxRow];
+        for (int pos = debutLigne; pos < finLigne; ++pos)
+        {
+            const MPVariable* var = variables[indicesColonnes[pos]];
+            // Only send the coefficients that actually changed, so that the solver
+            // does not consider the whole matrix as modified. Each term is looked up : this is
+            // meant to be called when the model is restarted (new year, retry), not every week
+            if (ct->GetCoefficient(var) != coefficients[pos])
+                ct->SetCoefficient(var, coefficients[pos]);
+        }
+    }
+}
+
+void ORTOOLS_ReinitialiserLeProbleme(MPSolver* solver)
+{
+    // Keep the model, but make sure the next resolution starts from scratch
+    solver->Reset();
+}
+
 void ORTOOLS_LibererProbleme(MPSolver* solver)
 {
     delete solver;
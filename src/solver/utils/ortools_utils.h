@@ -30,9 +30,6 @@ std::list<std::string> getAvailableOrtoolsSolverName();
 MPSolver* MPSolverFactory(const Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* probleme,
                           const std::string& solverName);
 
-std::string generateTempPath(const std::string& filename);
-void removeTemporaryFile(const std::string& tmpPath);
-
 class OrtoolsUtils
 {
 public:
@@ -57,22 +54,22 @@ public:
     {
     }
 
-    void SetTarget(const std::vector<std::string>& target)
+    void SetTarget(const LpNames& target)
     {
         target_ = &target;
     }
 
     std::string GetName(unsigned index) const
     {
-        if (target_ == nullptr || target_->at(index).empty())
+        if (target_ == nullptr || target_->empty(index))
         {
             return prefix_ + std::to_string(index);
         }
-        return target_->at(index);
+        return (*target_)[index];
     }
 
 private:
-    const std::vector<std::string>* target_ = nullptr;
+    const LpNames* target_ = nullptr;
     char prefix_;
 };
 
@@ -93,10 +90,12 @@ private:
 
     void CreateVariable(unsigned idxVar, MPSolver* solver, MPObjective* const objective);
     void CopyVariables(MPSolver* solver);
-    void UpdateContraints(unsigned idxRow, MPSolver* solver);
+    MPConstraint* UpdateContraints(unsigned idxRow, MPSolver* solver);
     void CopyRows(MPSolver* solver);
     void TuneSolverSpecificOptions(MPSolver* solver) const;
-    void CopyMatrix(const MPSolver* solver);
+    void CopyMatrixRow(unsigned idxRow,
+                       MPConstraint* const ct,
+                       const std::vector<MPVariable*>& variables);
 };
 } // namespace Optimization
 } // namespace Antares
@@ -24,6 +24,13 @@ void ORTOOLS_CorrigerLesBornes(MPSolver* ProbSpx,
                                const double* bMax,
                                const int* typeVar,
                                int nbVar);
+void ORTOOLS_ModifierLaMatriceDesContraintes(MPSolver* ProbSpx,
+                                             const int* indicesDebutDeLigne,
+                                             const int* nombreDeTermesDesLignes,
+                                             const double* coefficients,
+                                             const int* indicesColonnes,
+                                             int nbRow);
+void ORTOOLS_ReinitialiserLeProbleme(MPSolver* ProbSpx);
 void ORTOOLS_LibererProbleme(MPSolver* ProbSpx);
 
 #endif
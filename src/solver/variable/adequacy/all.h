@@ -28,6 +28,7 @@
 #define __SOLVER_VARIABLE_ADEQUACY_ALL_H__
 
 #include "../variable.h"
+#include "../trimmable.h"
 #include "../area.h"
 #include "../setofareas.h"
 #include "../bindConstraints.h"
@@ -101,70 +102,69 @@ namespace Adequacy
 /*!
 ** \brief All variables for a single link (economy)
 */
-typedef Variable::Economy::FlowLinear            // Flow linear
-  <Variable::Economy::FlowLinearAbs              // Flow linear Abs
-   <Variable::Economy::FlowQuad                  // Flow Quad
-    <Variable::Economy::CongestionFee            // Congestion Fee
-     <Variable::Economy::CongestionFeeAbs        // Congestion Fee (Abs)
-      <Variable::Economy::MarginalCost           // Marginal Cost
-       <Variable::Economy::CongestionProbability // Congestion Probability (+/-)
-        <Variable::Economy::HurdleCosts          // Hurdle costs
-         <>>>>>>>>
-    VariablePerLink;
+typedef StaticList<Variable::Economy::FlowLinear,            // Flow linear
+                   Variable::Economy::FlowLinearAbs,         // Flow linear Abs
+                   Variable::Economy::FlowQuad,              // Flow Quad
+                   Variable::Economy::CongestionFee,         // Congestion Fee
+                   Variable::Economy::CongestionFeeAbs,      // Congestion Fee (Abs)
+                   Variable::Economy::MarginalCost,          // Marginal Cost
+                   Variable::Economy::CongestionProbability, // Congestion Probability (+/-)
+                   Variable::Economy::HurdleCosts            // Hurdle costs
+                   >::EndedBy<Container::EndOfList>
+  VariablePerLink;
 // forward declaration
 class Links;
 
 /*!
 ** \brief All variables for a single area (economy)
 */
-typedef                                              // Prices
-  Variable::Adequacy::OverallCost                    // Overall Cost (Op. Cost + Unsupplied Eng.)
-  <Variable::Economy::OperatingCost                  // Operating Cost
-   <Variable::Economy::Price                         // Marginal price
-                                                     // pollutant
-    <Variable::Economy::ThermalAirPollutantEmissions // Pollutant emissions (from all thermal
-                                                     // dispatchable clusters) Production by thermal
-                                                     // cluster
-     <Variable::Economy::ProductionByDispatchablePlant  // Energy generated by thermal dispatchable
-                                                        // clusters
-      <Variable::Economy::ProductionByRenewablePlant    // Energy generated by renewable clusters
-                                                        // (must-run)
-       <Variable::Economy::Balance                      // Nodal Energy Balance
-                                                        // Misc Gen.
-        <Variable::Economy::RowBalance                  // Misc Gen. Row balance
-         <Variable::Economy::PSP                        // PSP
-          <Variable::Economy::MiscGenMinusRowPSP        // Misc Gen. - Row Balance - PSP
-                                                        // Time series
-           <Variable::Economy::TimeSeriesValuesLoad     // Load
-            <Variable::Economy::TimeSeriesValuesHydro   // Hydro
-             <Variable::Economy::TimeSeriesValuesWind   // Wind
-              <Variable::Economy::TimeSeriesValuesSolar // Solar
-                                                        // Other
-               <Variable::Economy::DispatchableGeneration // All dispatchable generation
-                <Variable::Economy::RenewableGeneration<
-                  Variable::Economy::HydroStorage     // Hydro Storage Generation
-                  <Variable::Economy::Pumping         // Pumping generation
-                   <Variable::Economy::ReservoirLevel // Reservoir levels
-                    <Variable::Economy::Inflows       // Hydraulic inflows
-                     <Variable::Economy::Overflows    // Hydraulic overflows
-                      <Variable::Economy::WaterValue  // Water values
-                       <Variable::Economy::HydroCost  // Hydro costs
-                        <Variable::Economy::ShortTermStorageByGroup<
-                          Variable::Economy::STstorageInjectionByCluster<
-                            Variable::Economy::STstorageWithdrawalByCluster<
-                              Variable::Economy::STstorageLevelsByCluster<
-                                Variable::Economy::UnsupliedEnergy // Unsuplied Energy
-                                <Variable::Adequacy::SpilledEnergy // Spilled Energy
-                                 <Variable::Economy::LOLD          // LOLD
-                                  <Variable::Economy::LOLP         // LOLP
-                                   <Variable::Economy::AvailableDispatchGen<
-                                     Variable::Economy::DispatchableGenMargin<
-                                       Variable::Economy::Marge // OP. MRG
-                                       <Variable::Economy::ProfitByPlant
-                                        // Links
-                                        <Variable::Adequacy::Links // All links
-                                         >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    VariablesPerArea;
+typedef StaticList<
+  Variable::Adequacy::OverallCost,   // Overall Cost (Op. Cost + Unsupplied Eng.)
+  Variable::Economy::OperatingCost,  // Operating Cost
+  Variable::Economy::Price,          // Marginal price
+                                     // pollutant
+  Variable::Economy::ThermalAirPollutantEmissions, // Pollutant emissions (from all thermal
+                                                   // dispatchable clusters)
+                                                   // Production by thermal cluster
+  Variable::Economy::ProductionByDispatchablePlant, // Energy generated by thermal dispatchable
+                                                    // clusters
+  Variable::Economy::ProductionByRenewablePlant,    // Energy generated by renewable clusters
+                                                    // (must-run)
+  Variable::Economy::Balance,                       // Nodal Energy Balance
+                                                    // Misc Gen.
+  Variable::Economy::RowBalance,                    // Misc Gen. Row balance
+  Variable::Economy::PSP,                           // PSP
+  Variable::Economy::MiscGenMinusRowPSP,            // Misc Gen. - Row Balance - PSP
+                                                    // Time series
+  Variable::Economy::TimeSeriesValuesLoad,          // Load
+  Variable::Economy::TimeSeriesValuesHydro,         // Hydro
+  Variable::Economy::TimeSeriesValuesWind,          // Wind
+  Variable::Economy::TimeSeriesValuesSolar,         // Solar
+                                                    // Other
+  Variable::Economy::DispatchableGeneration,        // All dispatchable generation
+  Variable::Economy::RenewableGeneration,
+  Variable::Economy::HydroStorage,   // Hydro Storage Generation
+  Variable::Economy::Pumping,        // Pumping generation
+  Variable::Economy::ReservoirLevel, // Reservoir levels
+  Variable::Economy::Inflows,        // Hydraulic inflows
+  Variable::Economy::Overflows,      // Hydraulic overflows
+  Variable::Economy::WaterValue,     // Water values
+  Variable::Economy::HydroCost,      // Hydro costs
+  Variable::Economy::ShortTermStorageByGroup,
+  Variable::Economy::STstorageInjectionByCluster,
+  Variable::Economy::STstorageWithdrawalByCluster,
+  Variable::Economy::STstorageLevelsByCluster,
+  Variable::Economy::UnsupliedEnergy, // Unsuplied Energy
+  Variable::Adequacy::SpilledEnergy,  // Spilled Energy
+  Variable::Economy::LOLD,            // LOLD
+  Variable::Economy::LOLP,            // LOLP
+  Variable::Economy::AvailableDispatchGen,
+  Variable::Economy::DispatchableGenMargin,
+  Variable::Economy::Marge, // OP. MRG
+  Variable::Economy::ProfitByPlant
+  // Links
+  >::EndedBy<Variable::Adequacy::Links> // All links
+  VariablesPerArea;
 
 /*!
 ** \brief All variables for a single set of areas (economy)
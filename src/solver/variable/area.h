@@ -140,8 +140,19 @@ public:
 
     void yearEnd(uint year, uint numSpace);
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary);
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear);
+
+    //! One part of the summary per area (see List::computeSummaryPart())
+    uint summaryPartCount() const
+    {
+        return pAreaCount;
+    }
+
+    template<class V>
+    void computeSummaryPart(V&, uint part, std::map<unsigned int, unsigned int>& numSpaceToYear)
+    {
+        pAreas[part].computeSummary(numSpaceToYear);
+    }
 
     void hourBegin(uint hourInTheYear);
 
@@ -152,6 +163,7 @@ public:
 
     void weekBegin(State& state);
     void weekForEachArea(State& state, uint numSpace);
+    void weekForEachAreaBatch(State& state, uint numSpace);
     void weekEnd(State& state);
 
     void buildSurveyReport(SurveyResults& results,
@@ -181,7 +193,7 @@ public:
     }
 
     template<class V>
-    void computeSpatialAggregatesSummary(V&, std::map<unsigned int, unsigned int>&, unsigned int)
+    void computeSpatialAggregatesSummary(V&, std::map<unsigned int, unsigned int>&)
     {
         // do nothing
     }
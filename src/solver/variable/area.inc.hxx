@@ -88,6 +88,11 @@ void Areas<NEXTTYPE>::initializeFromStudy(Data::Study& study)
             tick = 6;
         }
 
+        // For each current area's variable, getting the print status, that is :
+        // is variable's column(s) printed in output (areas) reports ?
+        // Variables not printed at all are not allocated, hence this must be done first.
+        pAreas[i].getPrintStatusFromStudy(study);
+
         // Initialize the variables
         // From the study
         pAreas[i].initializeFromStudy(study);
@@ -97,10 +102,6 @@ void Areas<NEXTTYPE>::initializeFromStudy(Data::Study& study)
         // districts'. Note that digest gather area and district results.
         pAreas[i].broadcastNonApplicability(not currentArea->hydro.reservoirManagement);
 
-        // For each current area's variable, getting the print status, that is :
-        // is variable's column(s) printed in output (areas) reports ?
-        pAreas[i].getPrintStatusFromStudy(study);
-
         pAreas[i].supplyMaxNumberOfColumns(study);
     }
 }
@@ -180,6 +181,20 @@ void Areas<NEXTTYPE>::weekForEachArea(State& state, uint numSpace)
     }); // for each area
 }
 
+template<>
+void Areas<NEXTTYPE>::weekForEachAreaBatch(State& state, uint numSpace)
+{
+    // For each area...
+    state.study.areas.each([&](Data::Area& area) {
+        state.area = &area; // the current area
+
+        // Initializing the state for the current area
+        state.initFromAreaIndex(area.index, numSpace);
+
+        pAreas[area.index].weekForEachAreaBatch(state, numSpace);
+    }); // for each area
+}
+
 template<>
 void Areas<NEXTTYPE>::yearBegin(uint year, uint numSpace)
 {
@@ -229,13 +244,12 @@ void Areas<NEXTTYPE>::yearEnd(uint year, uint numSpace)
 }
 
 template<>
-void Areas<NEXTTYPE>::computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                                     unsigned int nbYearsForCurrentSummary)
+void Areas<NEXTTYPE>::computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
 {
     for (uint i = 0; i != pAreaCount; ++i)
     {
         // Broadcast to all areas
-        pAreas[i].computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        pAreas[i].computeSummary(numSpaceToYear);
     }
 }
 
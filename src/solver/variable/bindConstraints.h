@@ -129,8 +129,19 @@ public:
 
     void initializeFromStudy(Data::Study& study);
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary);
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear);
+
+    //! One part of the summary per binding constraint (see List::computeSummaryPart())
+    uint summaryPartCount() const
+    {
+        return pBCcount;
+    }
+
+    template<class V>
+    void computeSummaryPart(V&, uint part, std::map<unsigned int, unsigned int>& numSpaceToYear)
+    {
+        pBindConstraints[part].computeSummary(numSpaceToYear);
+    }
 
     void yearBegin(uint year, uint numSpace);
     void yearEnd(uint year, uint numSpace);
@@ -221,18 +221,17 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             // Merge all those values with the global results
-            AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/,
+            AncestorType::pResults.merge(year,
                                          pValuesForTheCurrentYear[numSpace]);
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(unsigned int hourInTheYear)
@@ -278,10 +277,10 @@ private:
     //! The attached area
     Data::Area* pArea;
     //!
-    Matrix<>::ColumnType** pFatalValues;
+    Matrix<>::ColumnType** pFatalValues = nullptr;
 
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
     unsigned int pNbYearsParallel;
 
 }; // class TimeSeriesValuesHydro
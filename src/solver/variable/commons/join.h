@@ -218,12 +218,11 @@ public:
         BindConstType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        LeftType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
-        RightType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
-        BindConstType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        LeftType::computeSummary(numSpaceToYear);
+        RightType::computeSummary(numSpaceToYear);
+        BindConstType::computeSummary(numSpaceToYear);
     }
 
     void weekBegin(State& state)
@@ -239,6 +238,12 @@ public:
         RightType::weekForEachArea(state);
     }
 
+    void weekForEachAreaBatch(State& state, unsigned int numSpace)
+    {
+        // Districts are only computed at the end of the year
+        LeftType::weekForEachAreaBatch(state, numSpace);
+    }
+
     void weekEnd(State& state)
     {
         LeftType::weekEnd(state);
@@ -329,13 +334,38 @@ public:
 
     template<class V>
     void computeSpatialAggregatesSummary(V& allVars,
-                                         std::map<unsigned int, unsigned int>& numSpaceToYear,
-                                         unsigned int nbYearsForCurrentSummary)
+                                         std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        LeftType ::template computeSpatialAggregatesSummary(
-          allVars, numSpaceToYear, nbYearsForCurrentSummary);
-        RightType::template computeSpatialAggregatesSummary(
-          allVars, numSpaceToYear, nbYearsForCurrentSummary);
+        LeftType ::template computeSpatialAggregatesSummary(allVars, numSpaceToYear);
+        RightType::template computeSpatialAggregatesSummary(allVars, numSpaceToYear);
+    }
+
+    unsigned int summaryPartCount() const
+    {
+        return LeftType::summaryPartCount() + RightType::summaryPartCount()
+               + BindConstType::summaryPartCount();
+    }
+
+    template<class V>
+    void computeSummaryPart(V& allVars,
+                            unsigned int part,
+                            std::map<unsigned int, unsigned int>& numSpaceToYear)
+    {
+        const unsigned int leftCount = LeftType::summaryPartCount();
+        if (part < leftCount)
+        {
+            LeftType::template computeSummaryPart(allVars, part, numSpaceToYear);
+            return;
+        }
+        part -= leftCount;
+
+        const unsigned int rightCount = RightType::summaryPartCount();
+        if (part < rightCount)
+        {
+            RightType::template computeSummaryPart(allVars, part, numSpaceToYear);
+            return;
+        }
+        BindConstType::template computeSummaryPart(allVars, part - rightCount, numSpaceToYear);
     }
 
     template<class V>
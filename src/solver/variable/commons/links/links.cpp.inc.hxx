@@ -64,6 +64,9 @@ void Links::initializeFromArea(Data::Study* study, Data::Area* area)
             // Instancing a new set of variables of the area
             NextType& n = pLinks[lnkIndex];
 
+            // Print status first, variables not printed at all are not allocated
+            n.getPrintStatusFromStudy(*study);
+
             // Initialize the variables
             // From the study
             n.initializeFromStudy(*study);
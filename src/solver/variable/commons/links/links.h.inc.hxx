@@ -149,12 +149,12 @@ public:
 
     void yearEnd(uint year, uint numSpace);
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary);
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear);
 
     void weekBegin(State& state);
 
     void weekForEachArea(State& state, uint numSpace);
+    void weekForEachAreaBatch(State& state, uint numSpace);
     void weekEnd(State& state);
 
     void hourBegin(uint hourInTheYear);
@@ -218,9 +218,9 @@ public:
 
 public:
     //! Area list
-    NextType* pLinks;
+    NextType* pLinks = nullptr;
     //! The total number of links
-    uint pLinkCount;
+    uint pLinkCount = 0;
 
 }; // class Links
 
@@ -115,12 +115,11 @@ inline void Links::yearEnd(uint year, uint numSpace)
     }
 }
 
-inline void Links::computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                                  unsigned int nbYearsForCurrentSummary)
+inline void Links::computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
 {
     for (uint i = 0; i != pLinkCount; ++i)
     {
-        pLinks[i].computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        pLinks[i].computeSummary(numSpaceToYear);
     }
 }
 
@@ -136,6 +135,12 @@ inline void Links::weekForEachArea(State&, uint numSpace)
     UNUSED_VARIABLE(numSpace);
 }
 
+inline void Links::weekForEachAreaBatch(State&, uint numSpace)
+{
+    // do nothing
+    UNUSED_VARIABLE(numSpace);
+}
+
 inline void Links::weekEnd(State& state)
 {
     for (uint i = 0; i != pLinkCount; ++i)
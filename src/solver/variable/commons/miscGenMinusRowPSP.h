@@ -226,15 +226,14 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
-            AncestorType::pResults.merge(numSpaceToYear[numSpace],
+        for (const auto& [numSpace, year] : numSpaceToYear)
+            AncestorType::pResults.merge(year,
                                          pValuesForTheCurrentYear[numSpace]);
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(unsigned int hourInTheYear)
@@ -276,7 +275,7 @@ public:
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
     unsigned int pNbYearsParallel;
 
 }; // class MiscGenMinusRowPSP
@@ -219,11 +219,14 @@ public:
           typename VCardType::VCardOrigin::IntermediateValuesBaseType IntermediateValuesBaseType;
         pNbYearsParallel = study.maxNbYearsInParallel;
 
-        // Intermediate values
-        VarT<Container::EndOfList>::InitializeResultsFromStudy(AncestorType::pResults, study);
-        pValuesForTheCurrentYear = new IntermediateValuesBaseType[pNbYearsParallel];
-        for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
-            VariableAccessorType::InitializeAndReset(pValuesForTheCurrentYear[numSpace], study);
+        if (AncestorType::isComputed())
+        {
+            // Intermediate values
+            VarT<Container::EndOfList>::InitializeResultsFromStudy(AncestorType::pResults, study);
+            pValuesForTheCurrentYear = new IntermediateValuesBaseType[pNbYearsParallel];
+            for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+                VariableAccessorType::InitializeAndReset(pValuesForTheCurrentYear[numSpace], study);
+        }
 
         auto& limits = study.runtime->rangeLimits;
 
@@ -316,7 +319,8 @@ public:
     template<class V, class SetT>
     void yearEndSpatialAggregates(V& allVars, uint year, const SetT& set, uint numSpace)
     {
-        if (VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateEachYear)
+        if (VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateEachYear
+            && AncestorType::isComputed())
             internalSpatialAggregateForCurrentYear(allVars, set, numSpace);
 
         // Next variable
@@ -325,21 +329,21 @@ public:
 
     template<class V>
     void computeSpatialAggregatesSummary(V& allVars,
-                                         std::map<unsigned int, unsigned int>& numSpaceToYear,
-                                         uint nbYearsForCurrentSummary)
+                                         std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        if (VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateEachYear)
-            internalSpatialAggregateForParallelYears(numSpaceToYear, nbYearsForCurrentSummary);
+        if (VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateEachYear
+            && AncestorType::isComputed())
+            internalSpatialAggregateForParallelYears(numSpaceToYear);
 
         // Next variable
-        NextType::computeSpatialAggregatesSummary(
-          allVars, numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSpatialAggregatesSummary(allVars, numSpaceToYear);
     }
 
     template<class V, class SetT>
     void simulationEndSpatialAggregates(V& allVars, const SetT& set)
     {
-        if (VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateOnce)
+        if (VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateOnce
+            && AncestorType::isComputed())
             internalSpatialAggregate(allVars, 0, set);
 
         // Next variable
@@ -367,7 +371,8 @@ public:
                                       int precision,
                                       uint numSpace) const
     {
-        if (VCardType::columnCount != 0 && (VCardType::categoryDataLevel & Category::setOfAreas))
+        if (VCardType::columnCount != 0 && (VCardType::categoryDataLevel & Category::setOfAreas)
+            && AncestorType::isComputed())
         {
             // Initializing pointer on variable non applicable and print stati arrays to beginning
             results.isPrinted = AncestorType::isPrinted;
@@ -458,20 +463,19 @@ private:
     }
 
     void internalSpatialAggregateForParallelYears(
-      std::map<unsigned int, unsigned int>& numSpaceToYear,
-      uint nbYearsForCurrentSummary)
+      std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             // Merge all those values with the global results
             VariableAccessorType::ComputeSummary(
-              pValuesForTheCurrentYear[numSpace], AncestorType::pResults, numSpaceToYear[numSpace]);
+              pValuesForTheCurrentYear[numSpace], AncestorType::pResults, year);
         }
     }
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesTypeForSpatialAg pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesTypeForSpatialAg pValuesForTheCurrentYear = nullptr;
 
     double pRatioYear;
     double pRatioDay;
@@ -129,8 +129,25 @@ public:
     */
     void yearEnd(unsigned int year, unsigned int numSpace);
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary);
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear);
+
+    /*!
+    ** \brief Get the number of independent parts of the summary
+    **
+    ** The parts are the areas (with their links), the sets of areas and the binding
+    ** constraints.
+    */
+    unsigned int summaryPartCount() const;
+
+    /*!
+    ** \brief Merge the results of the given years into the summary, for a single part
+    **
+    ** Merging all parts is the same as calling computeSummary() then
+    ** computeSpatialAggregatesSummary(). The parts share no data, they can be merged
+    ** concurrently.
+    */
+    void computeSummaryPart(unsigned int part,
+                            std::map<unsigned int, unsigned int>& numSpaceToYear);
 
     template<class V>
     void yearEndSpatialAggregates(V& allVars, unsigned int year, unsigned int numSpace);
@@ -140,8 +157,7 @@ public:
 
     template<class V>
     void computeSpatialAggregatesSummary(V& allVars,
-                                         std::map<unsigned int, unsigned int>& numSpaceToYear,
-                                         unsigned int);
+                                         std::map<unsigned int, unsigned int>& numSpaceToYear);
 
     template<class V>
     void simulationEndSpatialAggregates(V& allVars);
@@ -109,10 +109,22 @@ inline void List<NextT>::yearEnd(unsigned int year, unsigned int numSpace)
 }
 
 template<class NextT>
-inline void List<NextT>::computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                                        unsigned int nbYearsForCurrentSummary)
+inline void List<NextT>::computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
 {
-    NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+    NextType::computeSummary(numSpaceToYear);
+}
+
+template<class NextT>
+inline unsigned int List<NextT>::summaryPartCount() const
+{
+    return NextType::summaryPartCount();
+}
+
+template<class NextT>
+inline void List<NextT>::computeSummaryPart(unsigned int part,
+                                            std::map<unsigned int, unsigned int>& numSpaceToYear)
+{
+    NextType::template computeSummaryPart(*this, part, numSpaceToYear);
 }
 
 template<class NextT>
@@ -137,12 +149,10 @@ template<class NextT>
 template<class V>
 inline void List<NextT>::computeSpatialAggregatesSummary(
   V& allVars,
-  std::map<unsigned int, unsigned int>& numSpaceToYear,
-  unsigned int nbYearsForCurrentSummary)
+  std::map<unsigned int, unsigned int>& numSpaceToYear)
 {
     // Next variable
-    NextType::template computeSpatialAggregatesSummary(
-      allVars, numSpaceToYear, nbYearsForCurrentSummary);
+    NextType::template computeSpatialAggregatesSummary(allVars, numSpaceToYear);
 }
 
 template<class NextT>
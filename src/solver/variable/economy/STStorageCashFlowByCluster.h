@@ -199,21 +199,20 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             for (unsigned int clusterIndex = 0; clusterIndex < nbClusters_; ++clusterIndex)
             {
                 // Merge all those values with the global results
-                AncestorType::pResults[clusterIndex].merge(numSpaceToYear[numSpace],
+                AncestorType::pResults[clusterIndex].merge(year,
                                                 pValuesForTheCurrentYear[numSpace][clusterIndex]);
             }
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(unsigned int hourInTheYear)
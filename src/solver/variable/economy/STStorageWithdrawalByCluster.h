@@ -207,21 +207,20 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             for (unsigned int clusterIndex = 0; clusterIndex < nbClusters_; ++clusterIndex)
             {
                 // Merge all those values with the global results
-                AncestorType::pResults[clusterIndex].merge(numSpaceToYear[numSpace],
+                AncestorType::pResults[clusterIndex].merge(year,
                     pValuesForTheCurrentYear[numSpace][clusterIndex]);
             }
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(unsigned int hourInTheYear)
@@ -294,9 +293,9 @@ public:
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
-    size_t nbClusters_;
-    unsigned int pNbYearsParallel;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
+    size_t nbClusters_ = 0;
+    unsigned int pNbYearsParallel = 0;
 
 }; // class STstorageWithdrawalByCluster
 
@@ -28,6 +28,7 @@
 #define __SOLVER_VARIABLE_ECONOMY_ALL_H__
 
 #include "../variable.h"
+#include "../trimmable.h"
 #include "../area.h"
 #include "../setofareas.h"
 #include "../bindConstraints.h"
@@ -108,76 +109,78 @@ namespace Antares::Solver::Variable::Economy
 /*!
 ** \brief All variables for a single link (economy)
 */
-typedef FlowLinear             // Flow linear
-  <FlowLinearAbs               // Flow linear Abs
-   <LoopFlow                   // Loop flow
-    <FlowQuad                  // Flow Quad
-     <CongestionFee            // Congestion Fee
-      <CongestionFeeAbs        // Congestion Fee (Abs)
-       <MarginalCost           // Marginal Cost
-        <CongestionProbability // Congestion Probability (+/-)
-         <HurdleCosts          // Hurdle costs
-          <>>>>>>>>>
-    VariablePerLink;
+typedef StaticList<FlowLinear,            // Flow linear
+                   FlowLinearAbs,         // Flow linear Abs
+                   LoopFlow,              // Loop flow
+                   FlowQuad,              // Flow Quad
+                   CongestionFee,         // Congestion Fee
+                   CongestionFeeAbs,      // Congestion Fee (Abs)
+                   MarginalCost,          // Marginal Cost
+                   CongestionProbability, // Congestion Probability (+/-)
+                   HurdleCosts            // Hurdle costs
+                   >::EndedBy<Container::EndOfList>
+  VariablePerLink;
 // forward declaration
 class Links;
 
 /*!
 ** \brief All variables for a single area (economy)
 */
-typedef                           // Prices
-  OverallCost                     // Overall Cost (Op. Cost + Unsupplied Eng.)
-  <OperatingCost                  // Operating Cost
-   <Price                         // Marginal price
-                                  // Thermal pollutants
-    <ThermalAirPollutantEmissions // Overall pollutant emissions(from all thermal dispatchable
-                                  // clusters) Production by thermal cluster
-     <ProductionByDispatchablePlant    // Energy generated by thermal dispatchable clusters
-      <ProductionByRenewablePlant      // Energy generated by renewable clusters (must-run)
-       <Balance                        // Nodal Energy Balance
-                                       // Misc Gen.
-        <RowBalance                    // Misc Gen. Row balance
-         <PSP                          // PSP
-          <MiscGenMinusRowPSP          // Misc Gen. - Row Balance - PSP
-                                       // Time series
-           <TimeSeriesValuesLoad       // Load
-            <TimeSeriesValuesHydro     // Hydro
-             <TimeSeriesValuesWind     // Wind
-              <TimeSeriesValuesSolar   // Solar
-                                       // Other
-               <DispatchableGeneration // All dispatchable generation
-                <RenewableGeneration   // All renewable generation
-                 <HydroStorage         // Hydro Storage Generation
-                  <Pumping             // Pumping generation
-                   <ReservoirLevel     // Reservoir levels
-                    <Inflows           // Hydraulic inflows
-                     <Overflows        // Hydraulic overflows
-                      <WaterValue      // Water values
-                       <HydroCost      // Hydro costs
-                        <ShortTermStorageByGroup<STstorageInjectionByCluster<
-                          STstorageWithdrawalByCluster<STstorageLevelsByCluster<
-                          STstorageCashFlowByCluster<
-                            UnsupliedEnergy           // Unsuplied Energy
-                            <DomesticUnsuppliedEnergy // Domestic Unsupplied Energy
-                             <LMRViolations           // LMR Violations
-                              <SpilledEnergy          // Spilled Energy
-                               <SpilledEnergyAfterCSR // SpilledEnergyAfterCSR
-                                <LOLD                 // LOLD
-                                 <LOLP                // LOLP
-                                  <AvailableDispatchGen<DispatchableGenMargin<
-                                    DtgMarginCsr // DTG MRG CSR
-                                    <Marge<NonProportionalCost<
-                                      NonProportionalCostByDispatchablePlant // Startup cost + Fixed
-                                                                             // cost per thermal
-                                                                             // plant detail
-                                      <NbOfDispatchedUnits         // Number of Units Dispatched
-                                       <NbOfDispatchedUnitsByPlant // Number of Units Dispatched by
-                                                                   // plant
-                                        <ProfitByPlant
-                                         // Links
-                                         <Variable::Economy::Links // All links
-                                          >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    VariablesPerArea;
+typedef StaticList<OverallCost,   // Overall Cost (Op. Cost + Unsupplied Eng.)
+                   OperatingCost, // Operating Cost
+                   Price,         // Marginal price
+                   // Thermal pollutants
+                   ThermalAirPollutantEmissions, // Overall pollutant emissions(from all thermal
+                                                 // dispatchable clusters)
+                   // Production by thermal cluster
+                   ProductionByDispatchablePlant, // Energy generated by thermal dispatchable
+                                                  // clusters
+                   ProductionByRenewablePlant, // Energy generated by renewable clusters (must-run)
+                   Balance,                    // Nodal Energy Balance
+                   // Misc Gen.
+                   RowBalance,         // Misc Gen. Row balance
+                   PSP,                // PSP
+                   MiscGenMinusRowPSP, // Misc Gen. - Row Balance - PSP
+                   // Time series
+                   TimeSeriesValuesLoad,  // Load
+                   TimeSeriesValuesHydro, // Hydro
+                   TimeSeriesValuesWind,  // Wind
+                   TimeSeriesValuesSolar, // Solar
+                   // Other
+                   DispatchableGeneration, // All dispatchable generation
+                   RenewableGeneration,    // All renewable generation
+                   HydroStorage,           // Hydro Storage Generation
+                   Pumping,                // Pumping generation
+                   ReservoirLevel,         // Reservoir levels
+                   Inflows,                // Hydraulic inflows
+                   Overflows,              // Hydraulic overflows
+                   WaterValue,             // Water values
+                   HydroCost,              // Hydro costs
+                   ShortTermStorageByGroup,
+                   STstorageInjectionByCluster,
+                   STstorageWithdrawalByCluster,
+                   STstorageLevelsByCluster,
+                   STstorageCashFlowByCluster,
+                   UnsupliedEnergy,          // Unsuplied Energy
+                   DomesticUnsuppliedEnergy, // Domestic Unsupplied Energy
+                   LMRViolations,            // LMR Violations
+                   SpilledEnergy,            // Spilled Energy
+                   SpilledEnergyAfterCSR,    // SpilledEnergyAfterCSR
+                   LOLD,                     // LOLD
+                   LOLP,                     // LOLP
+                   AvailableDispatchGen,
+                   DispatchableGenMargin,
+                   DtgMarginCsr, // DTG MRG CSR
+                   Marge,
+                   NonProportionalCost,
+                   NonProportionalCostByDispatchablePlant, // Startup cost + Fixed cost per
+                                                           // thermal plant detail
+                   NbOfDispatchedUnits,                    // Number of Units Dispatched
+                   NbOfDispatchedUnitsByPlant, // Number of Units Dispatched by plant
+                   ProfitByPlant
+                   // Links
+                   >::EndedBy<Variable::Economy::Links> // All links
+  VariablesPerArea;
 
 /*!
 ** \brief All variables for a single set of areas (economy)
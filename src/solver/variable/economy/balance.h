@@ -89,6 +89,9 @@ struct VCardBalance
         hasIntermediateValues = 1,
         //! Can this variable be non applicable (0 : no, 1 : yes)
         isPossiblyNonApplicable = 0,
+        //! Computed even if not printed (0 : no, 1 : yes)
+        //! (read by the quadratic flow post-processing)
+        isComputedWhenNotPrinted = 1,
     };
 
     typedef IntermediateValues IntermediateValuesBaseType;
@@ -220,18 +223,17 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             // Merge all those values with the global results
-            AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/,
+            AncestorType::pResults.merge(year,
                                          pValuesForTheCurrentYear[numSpace]);
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(unsigned int hourInTheYear)
@@ -289,11 +291,11 @@ public:
     }
 
 private:
-    double* bilanPays;
-    long* pInterco;
+    double* bilanPays = nullptr;
+    long* pInterco = nullptr;
 
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
     unsigned int pNbYearsParallel;
 
 }; // class Balance
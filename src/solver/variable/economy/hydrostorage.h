@@ -212,18 +212,17 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             // Merge all those values with the global results
-            AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/,
+            AncestorType::pResults.merge(year,
                                          pValuesForTheCurrentYear[numSpace]);
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(unsigned int hourInTheYear)
@@ -232,15 +231,16 @@ public:
         NextType::hourBegin(hourInTheYear);
     }
 
-    void hourForEachArea(State& state, unsigned int numSpace)
+    void weekForEachAreaBatch(State& state, unsigned int numSpace)
     {
-        // Total HydroStorage emissions
-        pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] =
-          // Current Hydro Storage generation
-          state.hourlyResults->TurbinageHoraire[state.hourInTheWeek];
+        // Current Hydro Storage generation
+        double* values = pValuesForTheCurrentYear[numSpace].hour + state.hourInTheYear;
+        const double* hourly = state.hourlyResults->TurbinageHoraire.data();
+        for (uint hw = 0; hw != Constants::nbHoursInAWeek; ++hw)
+            values[hw] = hourly[hw];
 
         // Next variable
-        NextType::hourForEachArea(state, numSpace);
+        NextType::weekForEachAreaBatch(state, numSpace);
     }
 
     Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(
@@ -270,7 +270,7 @@ public:
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
     unsigned int pNbYearsParallel;
 
 }; // class HydroStorage
@@ -241,21 +241,20 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             for (uint i = 0; i != VCardType::columnCount; ++i)
             {
                 // Merge all those values with the global results
-                AncestorType::pResults[i].merge(numSpaceToYear[numSpace],
+                AncestorType::pResults[i].merge(year,
                                                 pValuesForTheCurrentYear[numSpace][i]);
             }
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(uint hourInTheYear)
@@ -349,8 +348,8 @@ private:
     std::vector<float> yearsWeight;
     float yearsWeightSum;
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
-    typename VCardType::IntermediateValuesType pValuesForYearLocalReport;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
+    typename VCardType::IntermediateValuesType pValuesForYearLocalReport = nullptr;
     unsigned int pNbYearsParallel;
 
 }; // class CongestionProbability
@@ -86,6 +86,9 @@ struct VCardHurdleCosts
         hasIntermediateValues = 1,
         //! Can this variable be non applicable (0 : no, 1 : yes)
         isPossiblyNonApplicable = 0,
+        //! Computed even if not printed (0 : no, 1 : yes)
+        //! (part of the annual system cost)
+        isComputedWhenNotPrinted = 1,
     };
 
     typedef IntermediateValues IntermediateValuesBaseType;
@@ -202,18 +205,17 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             // Merge all those values with the global results
-            AncestorType::pResults.merge(numSpaceToYear[numSpace],
+            AncestorType::pResults.merge(year,
                                          pValuesForTheCurrentYear[numSpace]);
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourForEachArea(State& state, unsigned int numSpace)
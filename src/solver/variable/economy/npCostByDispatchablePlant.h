@@ -261,21 +261,20 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             for (unsigned int i = 0; i < pSize; ++i)
             {
                 // Merge all those values with the global results
-                AncestorType::pResults[i].merge(numSpaceToYear[numSpace],
+                AncestorType::pResults[i].merge(year,
                                                 pValuesForTheCurrentYear[numSpace][i]);
             }
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(unsigned int hourInTheYear)
@@ -324,9 +323,9 @@ public:
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
-    size_t pSize;
-    unsigned int pNbYearsParallel;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
+    size_t pSize = 0;
+    unsigned int pNbYearsParallel = 0;
 
 }; // class NonProportionalCostByDispatchablePlant
 
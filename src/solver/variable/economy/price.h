@@ -210,18 +210,17 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             // Merge all those values with the global results
-            AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/,
+            AncestorType::pResults.merge(year,
                                          pValuesForTheCurrentYear[numSpace]);
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(uint hourInTheYear)
@@ -230,15 +229,18 @@ public:
         NextType::hourBegin(hourInTheYear);
     }
 
-    void hourForEachArea(State& state, unsigned int numSpace)
+    void weekForEachAreaBatch(State& state, unsigned int numSpace)
     {
         // Marginal Price
         // Note: The marginal price provided by the solver is negative
         // (naming convention).
-        pValuesForTheCurrentYear[numSpace][state.hourInTheYear]
-          -= state.hourlyResults->CoutsMarginauxHoraires[state.hourInTheWeek];
+        double* values = pValuesForTheCurrentYear[numSpace].hour + state.hourInTheYear;
+        const double* hourly = state.hourlyResults->CoutsMarginauxHoraires.data();
+        for (uint hw = 0; hw != Constants::nbHoursInAWeek; ++hw)
+            values[hw] -= hourly[hw];
+
         // Next variable
-        NextType::hourForEachArea(state, numSpace);
+        NextType::weekForEachAreaBatch(state, numSpace);
     }
 
     Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(
@@ -268,7 +270,7 @@ public:
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
     unsigned int pNbYearsParallel;
 
 }; // class Price
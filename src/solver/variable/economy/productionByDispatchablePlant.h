@@ -86,6 +86,9 @@ struct VCardProductionByDispatchablePlant
         hasIntermediateValues = 1,
         //! Can this variable be non applicable (0 : no, 1 : yes)
         isPossiblyNonApplicable = 0,
+        //! Computed even if not printed (0 : no, 1 : yes)
+        //! (gives the production of the clusters)
+        isComputedWhenNotPrinted = 1,
     };
 
     typedef IntermediateValues IntermediateValuesDeepType;
@@ -282,21 +285,20 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             for (unsigned int i = 0; i < pSize; ++i)
             {
                 // Merge all those values with the global results
-                AncestorType::pResults[i].merge(numSpaceToYear[numSpace],
+                AncestorType::pResults[i].merge(year,
                                                 pValuesForTheCurrentYear[numSpace][i]);
             }
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(unsigned int hourInTheYear)
@@ -213,18 +213,17 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             // Merge all those values with the global results
-            AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/,
+            AncestorType::pResults.merge(year,
                                          pValuesForTheCurrentYear[numSpace]);
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourBegin(unsigned int hourInTheYear)
@@ -233,14 +232,16 @@ public:
         NextType::hourBegin(hourInTheYear);
     }
 
-    void hourForEachArea(State& state, unsigned int numSpace)
+    void weekForEachAreaBatch(State& state, unsigned int numSpace)
     {
         // Retrieving the hourly pumping energy
-        pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear]
-          = state.hourlyResults->PompageHoraire[state.hourInTheWeek];
+        double* values = pValuesForTheCurrentYear[numSpace].hour + state.hourInTheYear;
+        const double* hourly = state.hourlyResults->PompageHoraire.data();
+        for (uint hw = 0; hw != Constants::nbHoursInAWeek; ++hw)
+            values[hw] = hourly[hw];
 
         // Next variable
-        NextType::hourForEachArea(state, numSpace);
+        NextType::weekForEachAreaBatch(state, numSpace);
     }
 
     Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(
@@ -272,7 +273,7 @@ private:
     //! The attached area
     Antares::Data::Area* pArea;
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
     unsigned int pNbYearsParallel;
 
 }; // class Pumping
@@ -212,8 +212,7 @@ public:
         NextType::yearEnd(year, numSpace);
     }
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary)
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
         // Here we compute synthesis : 
         //  for each interval of any time period results (hourly, daily, weekly, ...),
@@ -221,15 +220,15 @@ public:
         //  For instance :
         //      - we compute the average of the results of the first hour over all MC years
         //      - or we compute the average of the results of the n-th day over all MC years
-        for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+        for (const auto& [numSpace, year] : numSpaceToYear)
         {
             VariableAccessorType::ComputeSummary(pValuesForTheCurrentYear[numSpace],
                                                  AncestorType::pResults,
-                                                 numSpaceToYear[numSpace]);
+                                                 year);
         }
 
         // Next variable
-        NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        NextType::computeSummary(numSpaceToYear);
     }
 
     void hourForEachArea(State& state, unsigned int numSpace)
@@ -288,7 +287,7 @@ public:
 
 private:
     //! Intermediate values for each year
-    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear;
+    typename VCardType::IntermediateValuesType pValuesForTheCurrentYear = nullptr;
     unsigned int pNbYearsParallel;
 
 }; // class ShortTermStorageByGroup
@@ -146,11 +146,9 @@ public:
     {
     }
 
-    static void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                               uint nbYearsForCurrentSummary)
+    static void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear)
     {
         UNUSED_VARIABLE(numSpaceToYear);
-        UNUSED_VARIABLE(nbYearsForCurrentSummary);
     };
 
     template<class V>
@@ -165,7 +163,7 @@ public:
     }
 
     template<class V>
-    void computeSpatialAggregatesSummary(V&, std::map<unsigned int, unsigned int>&, unsigned int)
+    void computeSpatialAggregatesSummary(V&, std::map<unsigned int, unsigned int>&)
     {
     }
 
@@ -187,6 +185,11 @@ public:
         UNUSED_VARIABLE(numSpace);
     }
 
+    static void weekForEachAreaBatch(State&, uint numSpace)
+    {
+        UNUSED_VARIABLE(numSpace);
+    }
+
     static void weekEnd(State&)
     {
     }
@@ -139,8 +139,7 @@ public:
 
     void yearEnd(unsigned int year, unsigned int numSpace);
 
-    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
-                        unsigned int nbYearsForCurrentSummary);
+    void computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear);
 
     void hourBegin(unsigned int hourInTheYear);
     void hourForEachArea(State& state);
@@ -176,8 +175,21 @@ public:
 
     template<class V>
     void computeSpatialAggregatesSummary(V& allVars,
-                                         std::map<unsigned int, unsigned int>& numSpaceToYear,
-                                         unsigned int);
+                                         std::map<unsigned int, unsigned int>& numSpaceToYear);
+
+    //! One part of the summary per set of areas (see List::computeSummaryPart())
+    unsigned int summaryPartCount() const
+    {
+        return static_cast<unsigned int>(pSetsOfAreas.size());
+    }
+
+    template<class V>
+    void computeSummaryPart(V& allVars,
+                            unsigned int part,
+                            std::map<unsigned int, unsigned int>& numSpaceToYear)
+    {
+        pSetsOfAreas[part]->computeSpatialAggregatesSummary(allVars, numSpaceToYear);
+    }
 
     template<class V>
     void simulationEndSpatialAggregates(V& allVars);
@@ -79,6 +79,11 @@ void SetsOfAreas<NextT>::initializeFromStudy(Data::Study& study)
         // Instancing a new set of variables of the area
         NextType* n = new NextType();
 
+        // For each current set's variable, getting the print status, that is :
+        // is variable's column(s) printed in output (set of areas) reports ?
+        // Variables not printed at all are not allocated, hence this must be done first.
+        n->getPrintStatusFromStudy(study);
+
         // Initialize the variables
         // From the study
         n->initializeFromStudy(study);
@@ -88,10 +93,6 @@ void SetsOfAreas<NextT>::initializeFromStudy(Data::Study& study)
         // - over all years district statistics reports
         n->broadcastNonApplicability(true);
 
-        // For each current set's variable, getting the print status, that is :
-        // is variable's column(s) printed in output (set of areas) reports ?
-        n->getPrintStatusFromStudy(study);
-
         // Adding the variables for the area in the list
         pSetsOfAreas.push_back(n);
         auto* originalSet = &sets[setIndex];
@@ -159,8 +160,7 @@ inline void SetsOfAreas<NextT>::yearEnd(uint /*year*/, uint /*numSpace*/)
 
 template<class NextT>
 inline void SetsOfAreas<NextT>::computeSummary(
-  std::map<unsigned int, unsigned int>& /*numSpaceToYear*/,
-  unsigned int /* nbYearsForCurrentSummary */)
+  std::map<unsigned int, unsigned int>& /*numSpaceToYear*/)
 {
     // Nothing to do here
 }
@@ -310,14 +310,12 @@ template<class NextT>
 template<class V>
 void SetsOfAreas<NextT>::computeSpatialAggregatesSummary(
   V& allVars,
-  std::map<unsigned int, unsigned int>& numSpaceToYear,
-  unsigned int nbYearsForCurrentSummary)
+  std::map<unsigned int, unsigned int>& numSpaceToYear)
 {
     for (uint setindex = 0; setindex != pSetsOfAreas.size(); ++setindex)
     {
         assert(setindex < pOriginalSets.size());
-        pSetsOfAreas[setindex]->computeSpatialAggregatesSummary(
-          allVars, numSpaceToYear, nbYearsForCurrentSummary);
+        pSetsOfAreas[setindex]->computeSpatialAggregatesSummary(allVars, numSpaceToYear);
     }
 }
 
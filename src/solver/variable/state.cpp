@@ -72,7 +72,8 @@ State::State(Data::Study& s) :
  optimalSolutionCost1(0.),
  optimalSolutionCost2(0.),
  averageOptimizationTime1(0.),
- averageOptimizationTime2(0.)
+ averageOptimizationTime2(0.),
+ problemBuildTime(0)
 {
 }
 
@@ -237,6 +237,8 @@ public:
     double averageOptimizationTime1;
     // Average time spent in second optimization over the year (ms)
     double averageOptimizationTime2;
+    // Time spent building the structure of the weekly problems over the year (ms)
+    int64_t problemBuildTime;
     // -----------------------------------------------------------------
 }; // class State
 
@@ -0,0 +1,117 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __SOLVER_VARIABLE_SURVEY_RESULTS_FIXED_FORMAT_H__
+#define __SOLVER_VARIABLE_SURVEY_RESULTS_FIXED_FORMAT_H__
+
+#include <yuni/yuni.h>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace Antares::Solver::Variable
+{
+/*!
+** \brief Write a number as snprintf() does with a format of the form `%.Nf` (0 <= N <= 9)
+**
+** The value is scaled by 10^N and rounded to an integer, which is exact as long as the
+** scaled value is not too large nor too close to a tie. snprintf() is called in any other
+** case (and for any other format), thus the text is always the same as with snprintf().
+**
+** \param out    The output buffer (at least 32 characters for the fast path)
+** \param size   The size of the output buffer
+** \param v      A finite value
+** \param format The printf format
+** \return The number of characters written (final zero excluded), negative on error
+*/
+inline int FormatFixed(char* out, size_t size, double v, const char* format)
+{
+    static constexpr double powersOf10[]
+      = {1., 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+    if (format[0] == '%' and format[1] == '.' and format[2] >= '0' and format[2] <= '9'
+        and format[3] == 'f' and format[4] == '\0' and size >= 32)
+    {
+        const int decimals = format[2] - '0';
+        const double scaled = std::fabs(v) * powersOf10[decimals];
+
+        // Below 2^40, the error of the product is less than 2^-13 : the rounding of the
+        // exact value is known when the fractional part is not within 2^-12 of one half
+        if (scaled < 1099511627776.)
+        {
+            const double integral = std::floor(scaled);
+            const double fraction = scaled - integral;
+            if (std::fabs(fraction - 0.5) > 1. / 4096.)
+            {
+                auto n = static_cast<uint64_t>(integral) + (fraction > 0.5 ? 1 : 0);
+                char digits[24];
+                const char* end = std::to_chars(digits, digits + sizeof(digits), n).ptr;
+                const int count = static_cast<int>(end - digits);
+
+                char* p = out;
+                if (std::signbit(v))
+                    *p++ = '-';
+                if (count <= decimals)
+                {
+                    // 0.00ddd
+                    *p++ = '0';
+                    *p++ = '.';
+                    for (int i = count; i < decimals; ++i)
+                        *p++ = '0';
+                    memcpy(p, digits, count);
+                    p += count;
+                }
+                else
+                {
+                    memcpy(p, digits, count - decimals);
+                    p += count - decimals;
+                    if (decimals != 0)
+                    {
+                        *p++ = '.';
+                        memcpy(p, digits + count - decimals, decimals);
+                        p += decimals;
+                    }
+                }
+                *p = '\0';
+                return static_cast<int>(p - out);
+            }
+        }
+    }
+
+// The snprintf routine is required since we may not have the ending zero
+// with the standard printf. The conversion may require a bigger buffer.
+#ifdef YUNI_OS_MSVC
+    return ::sprintf_s(out, size, format, v);
+#else
+    return ::snprintf(out, size, format, v);
+#endif
+}
+
+} // namespace Antares::Solver::Variable
+
+#endif // __SOLVER_VARIABLE_SURVEY_RESULTS_FIXED_FORMAT_H__
@@ -29,6 +29,8 @@
 #include <yuni/yuni.h>
 #include <antares/study/study.h>
 #include "surveyresults.h"
+#include "fixed-format.h"
+#include <antares/columnar/writer.h>
 #include <antares/logs/logs.h>
 #include <yuni/io/file.h>
 #include <antares/io/file.h>
@@ -90,15 +92,8 @@ void InternalExportDigestLinksMatrix(const Data::Study& study,
                     }
                     else
                     {
-// The snprintf routine is required since we may not have the ending zero
-// with the standard printf. The conversion may require a bigger buffer.
-#ifdef YUNI_OS_MSVC
-                        sizePrintf = ::sprintf_s(
-                          conversionBuffer + 1, sizeof(conversionBuffer) - 2, "%.0f", v);
-#else
-                        sizePrintf = ::snprintf(
-                          conversionBuffer + 1, sizeof(conversionBuffer) - 2, "%.0f", v);
-#endif
+                        sizePrintf = FormatFixed(
+                          conversionBuffer + 1, sizeof(conversionBuffer) - 2, v, "%.0f");
                         if (sizePrintf >= 0)
                             buffer.append((const char*)conversionBuffer);
                         else
@@ -361,13 +356,8 @@ inline void SurveyResults::AppendDoubleValue(uint& error,
             }
             else
             {
-#ifdef YUNI_OS_MSVC
-                int sizePrintf = ::sprintf_s(
-                  conversionBuffer + 1, sizeof(conversionBuffer) - 2, precision.c_str(), v);
-#else
-                int sizePrintf = ::snprintf(
-                  conversionBuffer + 1, sizeof(conversionBuffer) - 2, precision.c_str(), v);
-#endif
+                int sizePrintf = FormatFixed(
+                  conversionBuffer + 1, sizeof(conversionBuffer) - 2, v, precision.c_str());
 
                 if (sizePrintf >= 0)
                 {
@@ -620,19 +610,10 @@ void SurveyResults::exportDigestAllYears(std::string& buffer)
             }
             else
             {
-// The snprintf routine is required since we may not have the ending zero
-// with the standard printf. The conversion may require a bigger buffer.
-#ifdef YUNI_OS_MSVC
-                sizePrintf = ::sprintf_s(conversionBuffer + 1,
+                sizePrintf = FormatFixed(conversionBuffer + 1,
                                          sizeof(conversionBuffer) - 2,
-                                         precision[i].c_str(),
-                                         values[i][y]);
-#else
-                sizePrintf = ::snprintf(conversionBuffer + 1,
-                                        sizeof(conversionBuffer) - 2,
-                                        precision[i].c_str(),
-                                        values[i][y]);
-#endif
+                                         values[i][y],
+                                         precision[i].c_str());
                 if (sizePrintf >= 0)
                     buffer.append((const char*)conversionBuffer);
                 else
@@ -655,15 +636,22 @@ void SurveyResults::saveToFile(int dataLevel, int fileLevel, int precisionLevel)
 {
     logs.debug() << " :: survey writing `" << data.filename << "`";
 
-    // Clearing the buffer
-    data.fileBuffer.clear();
-    data.fileBuffer.reserve(2 * 1024 * 1024);
-
     // How many rows have we got ?
     const uint heightBegin = GetRangeLimit(data.study, precisionLevel, Data::rangeBegin);
     // (+1 for condition stop)
     const uint heightEnd = GetRangeLimit(data.study, precisionLevel, Data::rangeEnd) + 1;
 
+    if (data.study.parameters.resultFormat == Data::columnarFiles)
+    {
+        saveToColumnarFile(dataLevel, fileLevel, precisionLevel, heightBegin, heightEnd);
+        return;
+    }
+
+    // Clearing the buffer, large enough for the whole file (about 12 characters per value)
+    data.fileBuffer.clear();
+    const size_t estimatedSize = (size_t)(heightEnd - heightBegin) * (32 + 12 * data.columnIndex);
+    data.fileBuffer.reserve(std::max<size_t>(2 * 1024 * 1024, estimatedSize));
+
     // Big header
     if (data.area)
         data.fileBuffer << data.area->name;
@@ -744,6 +732,100 @@ void SurveyResults::saveToFile(int dataLevel, int fileLevel, int precisionLevel)
     pResultWriter.addEntryFromBuffer(data.filename.c_str(), data.fileBuffer);
 }
 
+template<class CallbackT>
+static void ForEachField(const Clob& line, const CallbackT& callback)
+{
+    // "\tfield0\tfield1...", possibly followed by a new line
+    uint index = 0;
+    Clob::Size offset = 0;
+    while (offset < line.size() and line[offset] == '\t')
+    {
+        Clob::Size end = offset + 1;
+        while (end < line.size() and line[end] != '\t' and line[end] != '\n')
+            ++end;
+        callback(index++, std::string_view(line.c_str() + offset + 1, end - offset - 1));
+        offset = end;
+    }
+}
+
+static std::string_view ToStringView(const AnyString& text)
+{
+    return std::string_view(text.c_str(), text.size());
+}
+
+void SurveyResults::saveToColumnarFile(int dataLevel,
+                                       int fileLevel,
+                                       int precisionLevel,
+                                       uint heightBegin,
+                                       uint heightEnd)
+{
+    Columnar::Writer writer(heightBegin + 1, heightEnd - heightBegin);
+    auto& buffer = data.fileBuffer;
+
+    // Title
+    writer.setTitle(Columnar::titleElement, data.area ? data.area->name.c_str() : "system");
+    buffer.clear();
+    Category::DataLevelToStream(buffer, dataLevel);
+    writer.setTitle(Columnar::titleDataLevel, ToStringView(buffer));
+    buffer.clear();
+    Category::FileLevelToStreamShort(buffer, fileLevel);
+    writer.setTitle(Columnar::titleFileLevel, ToStringView(buffer));
+    buffer.clear();
+    Category::PrecisionLevelToStream(buffer, precisionLevel);
+    writer.setTitle(Columnar::titleTimeLevel, ToStringView(buffer));
+    if (data.link)
+        writer.setTitle(Columnar::titleLinkedElement, data.link->with->name.c_str());
+
+    // Index columns, with the same names and labels as in the txt files
+    buffer.clear();
+    WriteIndexHeaderToFileDescriptor<2>(precisionLevel, buffer, "", captions, 0);
+    ForEachField(buffer, [&writer](uint, std::string_view name) { writer.addIndexColumn(name); });
+    for (uint y = heightBegin; y < heightEnd; ++y)
+    {
+        buffer.clear();
+        writeDateToFileDescriptor(y + 1, precisionLevel);
+        ForEachField(buffer, [&writer](uint column, std::string_view label) {
+            writer.addLabel(column, label);
+        });
+    }
+
+    // Values
+    uint error = 0;
+    for (uint x = 0; x != data.columnIndex; ++x)
+    {
+        assert(not precision[x].empty() && "invalid precision");
+        writer.addValueColumn(ToStringView(captions[0][x]),
+                              ToStringView(captions[1][x]),
+                              ToStringView(captions[2][x]),
+                              ToStringView(precision[x]),
+                              values[x] + heightBegin,
+                              nonApplicableStatus[x]);
+        if (nonApplicableStatus[x])
+            continue;
+        // Same checks as for the txt files
+        for (uint y = heightBegin; y < heightEnd; ++y)
+        {
+            const double v = values[x][y];
+            if (not Math::NaN(v) and not Math::Infinite(v))
+                continue;
+            if (++error != 1)
+                continue;
+            if (not Math::NaN(v))
+                logs.error() << "'infinite' value detected";
+            else if (not data.study.runtime->quadraticOptimizationHasFailed)
+                logs.error() << "'NaN' value detected";
+        }
+    }
+
+    std::string filename = data.filename.c_str();
+    if (filename.size() > 4 and filename.compare(filename.size() - 4, 4, ".txt") == 0)
+        filename.replace(filename.size() - 4, 4, ".bin");
+
+    std::string content;
+    writer.finish(content);
+    pResultWriter.addEntryFromBuffer(filename, content);
+}
+
 void SurveyResults::exportGridInfos()
 {
     data.exportGridInfos(pResultWriter);
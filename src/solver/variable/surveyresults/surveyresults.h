@@ -151,6 +151,13 @@ private:
 
     void writeDateToFileDescriptor(uint row, int precisionLevel);
 
+    //! Write the report as a columnar file (.bin), for the result format `columnarFiles`
+    void saveToColumnarFile(int dataLevel,
+                            int fileLevel,
+                            int precisionLevel,
+                            uint heightBegin,
+                            uint heightEnd);
+
 }; // class SurveyResults
 
 } // namespace Antares::Solver::Variable
@@ -0,0 +1,282 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __SOLVER_VARIABLE_TRIMMABLE_H__
+#define __SOLVER_VARIABLE_TRIMMABLE_H__
+
+#include <utility>
+#include "endoflist.h"
+
+namespace Antares::Solver::Variable
+{
+/*!
+** \brief A variable of a static list, skipped when it is trimmed out of the output
+**
+** The events are given to the variable only if its values are computed (see
+** IVariable::isComputed()). Otherwise they go straight to the next variable in the list,
+** and the variable neither allocates nor computes anything.
+*/
+template<class VariableT>
+class Trimmable : public VariableT
+{
+public:
+    //! Type of the next static variable
+    typedef typename VariableT::NextType NextType;
+
+public:
+    template<class... ArgsT>
+    void initializeFromStudy(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::initializeFromStudy(std::forward<ArgsT>(args)...);
+        else
+            NextType::initializeFromStudy(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void initializeFromArea(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::initializeFromArea(std::forward<ArgsT>(args)...);
+        else
+            NextType::initializeFromArea(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void initializeFromAreaLink(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::initializeFromAreaLink(std::forward<ArgsT>(args)...);
+        else
+            NextType::initializeFromAreaLink(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void simulationBegin(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::simulationBegin(std::forward<ArgsT>(args)...);
+        else
+            NextType::simulationBegin(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void simulationEnd(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::simulationEnd(std::forward<ArgsT>(args)...);
+        else
+            NextType::simulationEnd(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void yearBegin(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::yearBegin(std::forward<ArgsT>(args)...);
+        else
+            NextType::yearBegin(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void yearEndBuild(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::yearEndBuild(std::forward<ArgsT>(args)...);
+        else
+            NextType::yearEndBuild(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void yearEndBuildPrepareDataForEachThermalCluster(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::yearEndBuildPrepareDataForEachThermalCluster(std::forward<ArgsT>(args)...);
+        else
+            NextType::yearEndBuildPrepareDataForEachThermalCluster(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void yearEndBuildForEachThermalCluster(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::yearEndBuildForEachThermalCluster(std::forward<ArgsT>(args)...);
+        else
+            NextType::yearEndBuildForEachThermalCluster(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void yearEnd(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::yearEnd(std::forward<ArgsT>(args)...);
+        else
+            NextType::yearEnd(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void computeSummary(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::computeSummary(std::forward<ArgsT>(args)...);
+        else
+            NextType::computeSummary(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void hourBegin(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::hourBegin(std::forward<ArgsT>(args)...);
+        else
+            NextType::hourBegin(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void hourForEachArea(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::hourForEachArea(std::forward<ArgsT>(args)...);
+        else
+            NextType::hourForEachArea(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void hourForEachLink(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::hourForEachLink(std::forward<ArgsT>(args)...);
+        else
+            NextType::hourForEachLink(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void hourEnd(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::hourEnd(std::forward<ArgsT>(args)...);
+        else
+            NextType::hourEnd(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void weekBegin(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::weekBegin(std::forward<ArgsT>(args)...);
+        else
+            NextType::weekBegin(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void weekForEachArea(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::weekForEachArea(std::forward<ArgsT>(args)...);
+        else
+            NextType::weekForEachArea(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void weekForEachAreaBatch(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::weekForEachAreaBatch(std::forward<ArgsT>(args)...);
+        else
+            NextType::weekForEachAreaBatch(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void weekEnd(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::weekEnd(std::forward<ArgsT>(args)...);
+        else
+            NextType::weekEnd(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void buildAnnualSurveyReport(ArgsT&&... args) const
+    {
+        if (VariableT::isComputed())
+            VariableT::buildAnnualSurveyReport(std::forward<ArgsT>(args)...);
+        else
+            NextType::buildAnnualSurveyReport(std::forward<ArgsT>(args)...);
+    }
+
+    template<class... ArgsT>
+    void beforeYearByYearExport(ArgsT&&... args)
+    {
+        if (VariableT::isComputed())
+            VariableT::beforeYearByYearExport(std::forward<ArgsT>(args)...);
+        else
+            NextType::beforeYearByYearExport(std::forward<ArgsT>(args)...);
+    }
+
+    uint64_t memoryUsage() const
+    {
+        return VariableT::isComputed() ? VariableT::memoryUsage() : NextType::memoryUsage();
+    }
+
+    template<class VCardToFindT>
+    const double* retrieveHourlyResultsForCurrentYear(uint numSpace) const
+    {
+        return VariableT::isComputed()
+                 ? VariableT::template retrieveHourlyResultsForCurrentYear<VCardToFindT>(numSpace)
+                 : NextType::template retrieveHourlyResultsForCurrentYear<VCardToFindT>(numSpace);
+    }
+
+}; // class Trimmable
+
+/*!
+** \brief Static list of trimmable variables
+**
+** \code
+** // Trimmable<Load<Trimmable<Wind<Container::EndOfList>>>>
+** typedef StaticList<Load, Wind>::EndedBy<Container::EndOfList> VariablesPerArea;
+** \endcode
+*/
+template<template<class> class... VariablesT>
+struct StaticList;
+
+template<>
+struct StaticList<>
+{
+    template<class EndT>
+    using EndedBy = EndT;
+};
+
+template<template<class> class VariableT, template<class> class... OthersT>
+struct StaticList<VariableT, OthersT...>
+{
+    template<class EndT>
+    using EndedBy
+      = Trimmable<VariableT<typename StaticList<OthersT...>::template EndedBy<EndT>>>;
+};
+
+} // namespace Antares::Solver::Variable
+
+#endif // __SOLVER_VARIABLE_TRIMMABLE_H__
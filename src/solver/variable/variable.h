@@ -108,6 +108,12 @@ public:
     template<class PredicateT>
     static void RetrieveVariableList(PredicateT& predicate);
 
+    /*!
+    ** \brief Get the print status of the variable from the study (thematic trimming)
+    **
+    ** It must be called before initializeFromStudy(), since a variable trimmed out
+    ** of the output does not allocate its values.
+    */
     void getPrintStatusFromStudy(Data::Study& study);
     void supplyMaxNumberOfColumns(Data::Study& study);
 
@@ -259,6 +265,14 @@ public:
     //@{
     void weekBegin(State& state);
     void weekForEachArea(State& state, uint numSpace);
+    /*!
+    ** \brief Event: The hourly results of the week are available, for a given area
+    **
+    ** Called once per week instead of once per hour, with `state.hourInTheYear` set to the
+    ** first hour of the week. Variables which only copy or accumulate the hourly results of
+    ** the area should do it here, for the whole week, rather than in `hourForEachArea()`.
+    */
+    void weekForEachAreaBatch(State& state, uint numSpace);
 
     void weekEnd(State& state);
     //@}
@@ -340,6 +354,15 @@ public:
     //! The results
     const StoredResultType& results() const;
 
+    /*!
+    ** \brief Get if the values of the variable are computed
+    **
+    ** That is if at least one of its columns is printed, or if its values are needed
+    ** by other computations (`VCardT::isComputedWhenNotPrinted`). Otherwise the variable
+    ** is skipped by the static list (see Trimmable<>) and allocates nothing.
+    */
+    bool isComputed() const;
+
 protected:
     //! All the results about this variable
     StoredResultType pResults;
@@ -350,6 +373,8 @@ protected:
     bool* isNonApplicable;
     // Do we print results regarding the current variable in output files ? Or do we skip them ?
     bool* isPrinted;
+    // Are the values of the variable computed ? (see isComputed())
+    bool pIsComputed = true;
     // Positive column count (original column count can be < 0 for some variable [see variables "by
     // plant"])
     uint pColumnCount;
@@ -28,6 +28,8 @@
 #define __SOLVER_VARIABLE_VARIABLE_HXX__
 
 #include <yuni/core/static/types.h>
+#include <algorithm>
+#include <type_traits>
 #include <antares/study/variable-print-info.h>
 
 namespace Antares::Solver::Variable
@@ -213,6 +215,14 @@ inline void IVariable<ChildT, NextT, VCardT>::weekForEachArea(State& state, unsi
     NextType::weekForEachArea(state, numSpace);
 }
 
+template<class ChildT, class NextT, class VCardT>
+inline void IVariable<ChildT, NextT, VCardT>::weekForEachAreaBatch(State& state,
+                                                                   unsigned int numSpace)
+{
+    // Next variable
+    NextType::weekForEachAreaBatch(state, numSpace);
+}
+
 template<class ChildT, class NextT, class VCardT>
 inline void IVariable<ChildT, NextT, VCardT>::hourBegin(uint hourInTheYear)
 {
@@ -350,6 +360,10 @@ inline void IVariable<ChildT, NextT, VCardT>::beforeYearByYearExport(uint year,
 template<class ChildT, class NextT, class VCardT>
 inline uint64_t IVariable<ChildT, NextT, VCardT>::memoryUsage() const
 {
+    // Nothing is allocated for a variable trimmed out of the output
+    if (!pIsComputed)
+        return NextType::memoryUsage();
+
     uint64_t r = VariableAccessorType::Value(pResults);
     if ((int)VCardT::columnCount != (int)Category::dynamicColumns)
     {
@@ -547,6 +561,12 @@ inline const typename Storage<VCardT>::ResultsType& IVariable<ChildT, NextT, VCa
     return pResults;
 }
 
+template<class ChildT, class NextT, class VCardT>
+inline bool IVariable<ChildT, NextT, VCardT>::isComputed() const
+{
+    return pIsComputed;
+}
+
 
 // ===================================================================
 // Each output variable gets registered in the print info collector
@@ -681,12 +701,35 @@ namespace // anonymous
             isPrinted[0] = study.parameters.variablesPrintInfo.isPrinted(VCardT::Caption());
         }
     };
+
+    // Are the values of a variable computed even if it is not printed ?
+    // (`VCardT::isComputedWhenNotPrinted`, 0 by default)
+    template<class VCardT, class = void>
+    struct IsComputedWhenNotPrinted
+    {
+        enum
+        {
+            Yes = 0
+        };
+    };
+
+    template<class VCardT>
+    struct IsComputedWhenNotPrinted<VCardT,
+                                    std::void_t<decltype(VCardT::isComputedWhenNotPrinted)>>
+    {
+        enum
+        {
+            Yes = VCardT::isComputedWhenNotPrinted
+        };
+    };
 } // namespace
 
 template<class ChildT, class NextT, class VCardT>
 inline void IVariable<ChildT, NextT, VCardT>::getPrintStatusFromStudy(Data::Study& study)
 {
     GetPrintStatusHelper<VCardType::columnCount, VCardType>::Do(study, isPrinted);
+    pIsComputed = IsComputedWhenNotPrinted<VCardType>::Yes
+                  || std::any_of(isPrinted, isPrinted + pColumnCount, [](bool b) { return b; });
     // Go to the next variable
     NextType::getPrintStatusFromStudy(study);
 }
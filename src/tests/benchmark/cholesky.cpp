@@ -0,0 +1,47 @@
+#include <boost/test/unit_test.hpp>
+
+#include "cholesky.h"
+#include "cholesky-reference.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace Antares::Solver;
+using namespace CholeskyReference;
+
+// Factorization of the correlation matrices of the XCast generators, by panels of columns,
+// against the textbook implementation
+BOOST_AUTO_TEST_SUITE(cholesky)
+
+BOOST_AUTO_TEST_CASE(timings_against_the_reference_implementation)
+{
+    using Clock = std::chrono::steady_clock;
+    using ms = std::chrono::duration<double, std::milli>;
+    for (uint n : {50u, 100u, 200u, 500u, 1000u})
+    {
+        auto A = randomCorrelation(n, 3);
+        SquareMatrix L(n), expected(n);
+        std::vector<double> temp(n);
+
+        // Best of a few runs
+        double reference = 1e30;
+        double blocked = 1e30;
+        for (uint run = 0; run != 5; ++run)
+        {
+            auto start = Clock::now();
+            referenceCholesky(expected.entry, A.entry, n, temp.data());
+            auto middle = Clock::now();
+            Cholesky<double>(L.entry, A.entry, n, temp.data(), CholeskySummation::byPanels);
+            auto end = Clock::now();
+            reference = std::min(reference, ms(middle - start).count());
+            blocked = std::min(blocked, ms(end - middle).count());
+        }
+
+        BOOST_TEST_MESSAGE("n = " << n << " : reference " << reference << " ms, blocked "
+                                  << blocked << " ms");
+        BOOST_CHECK_SMALL(maxDifferenceOfLowerTriangles(L, expected), 1e-9);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,6 @@
+#define BOOST_TEST_MODULE antares benchmarks
+#define BOOST_TEST_DYN_LINK
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
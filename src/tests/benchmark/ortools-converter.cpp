@@ -0,0 +1,269 @@
+#include <boost/test/unit_test.hpp>
+
+#include "ortools_utils.h"
+#include "ortools/linear_solver/linear_solver.pb.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Antares::Optimization;
+
+namespace
+{
+using Term = std::pair<int, double>;
+//! Upper bound of the variables which are only bounded below, as LINFINI_ANTARES
+constexpr double infinity = 1e80;
+constexpr double twoPi = 6.283185307179586;
+
+// A problem shaped as the weekly problem : per hour and area, thermal clusters (generation and
+// number of units on), unsupplied and spilled energy, flows of the links in the balance, and
+// ramping constraints between consecutive hours
+class WeeklyProblem
+{
+public:
+    WeeklyProblem(int areas, int clusters) :
+     problem(variableNames,
+             constraintNames,
+             integerVariables,
+             variableStatus,
+             constraintStatus,
+             false,
+             false)
+    {
+        std::vector<int> previousGeneration(areas * clusters, -1);
+        const int links = areas + areas / 2;
+        for (int hour = 0; hour != 168; ++hour)
+        {
+            std::vector<std::vector<Term>> balance(areas);
+            for (int a = 0; a != areas; ++a)
+            {
+                for (int c = 0; c != clusters; ++c)
+                {
+                    const double unit = 100. + 50. * c;
+                    const int units = 2 + (a + c) % 4;
+                    const int generation = addVariable(0., unit * units, 20. + 7. * c + 0.01 * a);
+                    const int nodu = addVariable(0., units, 100. + 10. * c);
+                    balance[a].push_back({generation, 1.});
+                    addConstraint('<', 0., {{generation, 1.}, {nodu, -unit}});
+                    addConstraint('>', 0., {{generation, 1.}, {nodu, -0.3 * unit}});
+                    int& previous = previousGeneration[a * clusters + c];
+                    if (previous >= 0)
+                    {
+                        addConstraint('<', 0.5 * unit, {{generation, 1.}, {previous, -1.}});
+                        addConstraint('>', -0.5 * unit, {{generation, 1.}, {previous, -1.}});
+                    }
+                    previous = generation;
+                }
+                balance[a].push_back({addVariable(0., infinity, 3000.), 1.});
+                balance[a].push_back({addVariable(0., infinity, 0.5), -1.});
+            }
+            for (int l = 0; l != links; ++l)
+            {
+                const int from = l % areas;
+                const int to = (l < areas) ? (l + 1) % areas : (l * 7 + 3) % areas;
+                if (from == to)
+                    continue;
+                const int flow = addVariable(-800., 800., 0.01);
+                balance[from].push_back({flow, -1.});
+                balance[to].push_back({flow, 1.});
+            }
+            for (int a = 0; a != areas; ++a)
+            {
+                const double load = 600. + 200. * std::sin(twoPi * hour / 24. + a)
+                                    + 13. * (a % 5);
+                addConstraint('=', load, balance[a]);
+            }
+        }
+
+        integerVariables.assign(xmin.size(), false);
+        problem.NombreDeVariables = (int)xmin.size();
+        problem.TypeDeVariable = types.data();
+        problem.Xmin = xmin.data();
+        problem.Xmax = xmax.data();
+        problem.CoutLineaire = costs.data();
+        problem.NombreDeContraintes = (int)sens.size();
+        problem.IndicesDebutDeLigne = rowStart.data();
+        problem.NombreDeTermesDesLignes = rowSize.data();
+        problem.IndicesColonnes = columns.data();
+        problem.CoefficientsDeLaMatriceDesContraintes = coefficients.data();
+        problem.Sens = sens.data();
+        problem.SecondMembre = rhs.data();
+    }
+
+    // The same model, through the protocol buffer of OR-Tools
+    void toProto(operations_research::MPModelProto& model) const
+    {
+        const Nomenclature variableName('x');
+        const Nomenclature constraintName('c');
+        model.mutable_variable()->Reserve(problem.NombreDeVariables);
+        for (int i = 0; i != problem.NombreDeVariables; ++i)
+        {
+            auto* variable = model.add_variable();
+            variable->set_lower_bound(xmin[i]);
+            variable->set_upper_bound(xmax[i]);
+            variable->set_objective_coefficient(costs[i]);
+            variable->set_name(variableName.GetName(i));
+        }
+        model.mutable_constraint()->Reserve(problem.NombreDeContraintes);
+        for (int row = 0; row != problem.NombreDeContraintes; ++row)
+        {
+            auto* constraint = model.add_constraint();
+            if (sens[row] != '<')
+                constraint->set_lower_bound(rhs[row]);
+            if (sens[row] != '>')
+                constraint->set_upper_bound(rhs[row]);
+            constraint->set_name(constraintName.GetName(row));
+            constraint->mutable_var_index()->Reserve(rowSize[row]);
+            constraint->mutable_coefficient()->Reserve(rowSize[row]);
+            for (int pos = rowStart[row]; pos != rowStart[row] + rowSize[row]; ++pos)
+            {
+                constraint->add_var_index(columns[pos]);
+                constraint->add_coefficient(coefficients[pos]);
+            }
+        }
+    }
+
+    LpNames variableNames;
+    LpNames constraintNames;
+    std::vector<bool> integerVariables;
+    std::vector<int> variableStatus;
+    std::vector<int> constraintStatus;
+
+    std::vector<int> types;
+    std::vector<double> xmin;
+    std::vector<double> xmax;
+    std::vector<double> costs;
+    std::vector<int> rowStart;
+    std::vector<int> rowSize;
+    std::vector<int> columns;
+    std::vector<double> coefficients;
+    std::vector<char> sens;
+    std::vector<double> rhs;
+
+    PROBLEME_SIMPLEXE_NOMME problem;
+
+private:
+    int addVariable(double min, double max, double cost)
+    {
+        types.push_back(max < infinity ? VARIABLE_BORNEE_DES_DEUX_COTES
+                                       : VARIABLE_BORNEE_INFERIEUREMENT);
+        xmin.push_back(min);
+        xmax.push_back(max);
+        costs.push_back(cost);
+        return (int)xmin.size() - 1;
+    }
+
+    template<class TermsT>
+    void addConstraint(char direction, double value, const TermsT& terms)
+    {
+        rowStart.push_back((int)columns.size());
+        rowSize.push_back((int)terms.size());
+        for (const auto& [column, coefficient] : terms)
+        {
+            columns.push_back(column);
+            coefficients.push_back(coefficient);
+        }
+        sens.push_back(direction);
+        rhs.push_back(value);
+    }
+
+    void addConstraint(char direction, double value, std::initializer_list<Term> terms)
+    {
+        addConstraint<std::initializer_list<Term>>(direction, value, terms);
+    }
+};
+
+// What is done when the solver restarts (new year, safe-mode retry) : the kept model is updated
+void updateTheModel(MPSolver* solver, const PROBLEME_SIMPLEXE_NOMME& problem)
+{
+    ORTOOLS_ReinitialiserLeProbleme(solver);
+    ORTOOLS_ModifierLeVecteurCouts(solver, problem.CoutLineaire, problem.NombreDeVariables);
+    ORTOOLS_ModifierLeVecteurSecondMembre(
+      solver, problem.SecondMembre, problem.Sens, problem.NombreDeContraintes);
+    ORTOOLS_CorrigerLesBornes(solver,
+                              problem.Xmin,
+                              problem.Xmax,
+                              problem.TypeDeVariable,
+                              problem.NombreDeVariables);
+    ORTOOLS_ModifierLaMatriceDesContraintes(solver,
+                                            problem.IndicesDebutDeLigne,
+                                            problem.NombreDeTermesDesLignes,
+                                            problem.CoefficientsDeLaMatriceDesContraintes,
+                                            problem.IndicesColonnes,
+                                            problem.NombreDeContraintes);
+}
+
+std::string exportAsMps(const MPSolver* solver)
+{
+    std::string content;
+    solver->ExportModelAsMpsFormat(/*fixed_format=*/false, /*obfuscated=*/false, &content);
+    return content;
+}
+} // namespace
+
+// Conversion of the weekly problem into a MPSolver (first week, infeasibility analysis), against
+// the update of the kept model when the solver restarts and against MPSolver::LoadModelFromProto
+BOOST_AUTO_TEST_SUITE(ortools_converter)
+
+BOOST_AUTO_TEST_CASE(timings_against_the_update_of_the_model_and_the_load_from_a_proto)
+{
+    using Clock = std::chrono::steady_clock;
+    using ms = std::chrono::duration<double, std::milli>;
+    const std::string solverName = "coin";
+    const auto available = getAvailableOrtoolsSolverName();
+    BOOST_REQUIRE(std::find(available.begin(), available.end(), solverName) != available.end());
+
+    for (int areas : {5, 20, 50})
+    {
+        WeeklyProblem weekly(areas, 6);
+        const auto& problem = weekly.problem;
+
+        // Best of a few runs
+        double conversion = 1e30;
+        double update = 1e30;
+        double protoBuild = 1e30;
+        double protoLoad = 1e30;
+        for (int run = 0; run != 5; ++run)
+        {
+            auto start = Clock::now();
+            ProblemSimplexeNommeConverter converter(solverName, &problem);
+            MPSolver* converted = converter.Convert();
+            auto middle = Clock::now();
+            updateTheModel(converted, problem);
+            auto end = Clock::now();
+            conversion = std::min(conversion, ms(middle - start).count());
+            update = std::min(update, ms(end - middle).count());
+
+            start = Clock::now();
+            operations_research::MPModelProto model;
+            weekly.toProto(model);
+            middle = Clock::now();
+            MPSolver* loaded = MPSolverFactory(&problem, solverName);
+            std::string error;
+            const auto status = loaded->LoadModelFromProto(model, &error, /*clear_names=*/false);
+            end = Clock::now();
+            protoBuild = std::min(protoBuild, ms(middle - start).count());
+            protoLoad = std::min(protoLoad, ms(end - middle).count());
+
+            BOOST_REQUIRE_MESSAGE(status == operations_research::MPSOLVER_MODEL_IS_VALID, error);
+            if (run == 0)
+                BOOST_CHECK(exportAsMps(converted) == exportAsMps(loaded));
+            ORTOOLS_LibererProbleme(converted);
+            ORTOOLS_LibererProbleme(loaded);
+        }
+
+        BOOST_TEST_MESSAGE(problem.NombreDeVariables
+                           << " variables, " << problem.NombreDeContraintes << " constraints, "
+                           << weekly.coefficients.size() << " nonzeros : conversion " << conversion
+                           << " ms, update of the kept model " << update
+                           << " ms, LoadModelFromProto " << protoBuild << " + " << protoLoad
+                           << " ms (proto + load)");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
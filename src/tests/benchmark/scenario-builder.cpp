@@ -0,0 +1,54 @@
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include <scenario-builder/sets.h>
+#include "fixture.h"
+
+// Reading of the scenario builder (scenariobuilder.dat)
+BOOST_AUTO_TEST_SUITE(scenario_builder)
+
+// Reading of a large file. The size can be raised with the environment variable
+// ANTARES_SC_BUILDER_LINES (e.g. 10000000 for a scenario builder of 10M lines).
+BOOST_FIXTURE_TEST_CASE(reading_of_a_large_file, Fixture)
+{
+    unsigned long lineCount = 200000;
+    if (const char* env = std::getenv("ANTARES_SC_BUILDER_LINES"))
+        lineCount = std::strtoul(env, nullptr, 10);
+
+    const auto path = std::filesystem::temp_directory_path() / "benchmark-sc-builder-large.dat";
+    {
+        std::ofstream file(path, std::ios::binary);
+        const char* prefixes[] = {"l,area 1,", "w,area 2,", "s,area 3,", "t,area 1,", "r,area 3,"};
+        file << "[large]\n";
+        for (unsigned long i = 0; i != lineCount; ++i)
+        {
+            const unsigned long kind = i % 5;
+            file << prefixes[kind] << i % 20;
+            if (kind == 3)
+                file << ",th-cluster-12";
+            else if (kind == 4)
+                file << ",rn-cluster-31";
+            file << " = " << 1 + i % 9 << '\n';
+        }
+    }
+
+    ScenarioBuilder::Sets sets;
+    sets.setStudy(*study);
+    const auto start = std::chrono::steady_clock::now();
+    BOOST_CHECK(sets.loadFromINIFile(path.string()));
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::filesystem::remove(path);
+    BOOST_TEST_MESSAGE(lineCount << " lines read in " << elapsed.count() << "s");
+
+    auto rules = sets.find("large");
+    BOOST_REQUIRE(rules);
+    // The last line for each year wins
+    const unsigned long last = (lineCount - 1) / 5 * 5;
+    BOOST_CHECK_EQUAL(rules->load.get_value(last % 20, area_1->index), 1 + last % 9);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
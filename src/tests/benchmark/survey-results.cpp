@@ -0,0 +1,45 @@
+#include <boost/test/unit_test.hpp>
+
+#include "hourly-report.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace HourlyReport;
+
+// Writing of the result files of the output variables
+BOOST_AUTO_TEST_SUITE(survey_results)
+
+// Throughput of the writing of a file values-hourly.txt (8760 rows and 50 columns)
+BOOST_AUTO_TEST_CASE(throughput_of_the_writing_of_an_hourly_report)
+{
+    using Clock = std::chrono::steady_clock;
+    using ms = std::chrono::duration<double, std::milli>;
+
+    StudyForAnAreaReport fixture;
+    LastFileWriter writer;
+    SurveyResults results(*fixture.study, "output", writer);
+
+    for (const char* precision : {"%.0f", "%.2f"})
+    {
+        fixture.fill(results, precision);
+
+        // Best of a few runs
+        constexpr uint runCount = 10;
+        double best = 1e30;
+        for (uint run = 0; run != runCount; ++run)
+        {
+            auto start = Clock::now();
+            results.saveToFile(Category::area, Category::va, Category::hourly);
+            best = std::min(best, ms(Clock::now() - start).count());
+        }
+
+        const double megabytes = writer.lastContent.size() / (1024. * 1024.);
+        BOOST_TEST_MESSAGE(precision << " : " << best << " ms per file of " << megabytes
+                                     << " MB, " << megabytes / (best / 1000.) << " MB/s");
+        BOOST_CHECK_EQUAL(writer.fileCount, runCount);
+        writer.fileCount = 0;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
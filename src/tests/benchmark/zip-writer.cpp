@@ -0,0 +1,143 @@
+#include <boost/test/unit_test.hpp>
+
+#include <antares/benchmarking/DurationCollector.h>
+#include <antares/study/parameters.h>
+#include <antares/writer/writer_factory.h>
+#include <yuni/core/system/cpu.h>
+#include <yuni/job/queue/service.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Total of the durations of each kind (ms), added by the jobs of the zip writer
+class DurationSums : public Benchmarking::IDurationCollector
+{
+public:
+    void addDuration(const std::string& name, int64_t duration) override
+    {
+        std::lock_guard lock(mutex_);
+        sums_[name] += duration;
+    }
+
+    int64_t operator[](const std::string& name)
+    {
+        std::lock_guard lock(mutex_);
+        return sums_[name];
+    }
+
+private:
+    std::map<std::string, int64_t> sums_;
+    std::mutex mutex_;
+};
+
+// Content of an hourly report of an area : 8760 rows of 20 columns
+std::string hourlyReport(unsigned seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> distribution(-5000., 50000.);
+    std::string content;
+    char buffer[32];
+    for (unsigned hour = 0; hour != 8760; ++hour)
+    {
+        content += "\t" + std::to_string(hour + 1) + "\t01\tJAN\t00:00";
+        for (unsigned column = 0; column != 20; ++column)
+        {
+            const double value = distribution(generator);
+            content.append(buffer, std::snprintf(buffer, sizeof(buffer), "\t%.2f", value));
+        }
+        content += '\n';
+    }
+    return content;
+}
+} // namespace
+
+// Zip output (result-format = zip) of a study with the year-by-year results
+BOOST_AUTO_TEST_SUITE(zip_writer)
+
+// The MC years run in parallel each add the hourly reports of their areas to the archive.
+// The entries are compressed by the I/O queue (its threads are reported), outside of the lock
+// of the archive : `in the lock` is the part of the writing which can't be run in parallel.
+BOOST_AUTO_TEST_CASE(writing_of_a_year_by_year_output)
+{
+    using Clock = std::chrono::steady_clock;
+    using ms = std::chrono::duration<double, std::milli>;
+
+    constexpr unsigned yearCount = 8;
+    constexpr unsigned areaCount = 10;
+    const unsigned parallelYears = std::max(2u, std::min(4u, Yuni::System::CPU::Count()));
+
+    std::vector<std::string> reports;
+    size_t bytesPerYear = 0;
+    for (unsigned area = 0; area != areaCount; ++area)
+    {
+        reports.push_back(hourlyReport(area));
+        bytesPerYear += reports.back().size();
+    }
+    const double megabytes = yearCount * bytesPerYear / (1024. * 1024.);
+
+    const auto folder = std::filesystem::temp_directory_path() / "benchmark-zip-writer";
+    for (unsigned ioThreads : {1u, parallelYears})
+    {
+        auto ioQueue = std::make_shared<Yuni::Job::QueueService>();
+        ioQueue->maximumThreadCount(ioThreads);
+        ioQueue->start();
+        DurationSums durations;
+        auto writer = Antares::Solver::resultWriterFactory(
+          Antares::Data::zipArchive,
+          folder.string(),
+          ioQueue,
+          durations,
+          Antares::Data::Parameters::defaultZipCompressionLevel);
+
+        const auto start = Clock::now();
+        std::vector<std::thread> years;
+        for (unsigned first = 0; first != parallelYears; ++first)
+        {
+            years.emplace_back([&, first]() {
+                for (unsigned year = first; year < yearCount; year += parallelYears)
+                {
+                    for (unsigned area = 0; area != areaCount; ++area)
+                    {
+                        std::string content = reports[area];
+                        writer->addEntryFromBuffer("mc-ind/" + std::to_string(year + 1)
+                                                     + "/areas/area " + std::to_string(area)
+                                                     + "/values-hourly.txt",
+                                                   content);
+                    }
+                }
+            });
+        }
+        for (auto& year : years)
+            year.join();
+        writer->flush();
+        writer->finalize(false);
+        const double elapsed = ms(Clock::now() - start).count();
+        ioQueue->wait(Yuni::qseIdle);
+        ioQueue->stop();
+
+        const auto archive = folder.string() + ".zip";
+        const double archiveSize = std::filesystem::file_size(archive) / (1024. * 1024.);
+        std::filesystem::remove(archive);
+
+        BOOST_TEST_MESSAGE(parallelYears
+                           << " parallel years, " << ioThreads << " I/O threads : " << megabytes
+                           << " MB in " << elapsed << " ms (" << megabytes / (elapsed / 1000.)
+                           << " MB/s), archive " << archiveSize << " MB, compression "
+                           << durations["zip_compress"] << " ms, in the lock "
+                           << durations["zip_write"] << " ms, waiting for the lock "
+                           << durations["zip_wait"] << " ms");
+        BOOST_CHECK(archiveSize > 0.);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
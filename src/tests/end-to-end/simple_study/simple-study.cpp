@@ -230,6 +230,88 @@ BOOST_AUTO_TEST_CASE(parallel2)
 BOOST_AUTO_TEST_SUITE_END()
 
 
+// =================================
+// Two linked areas fixture
+// =================================
+// The load of the second area is supplied by the cluster of the first one, through the link
+struct StudyWithTwoLinkedAreas : public StudyBuilder
+{
+    using StudyBuilder::StudyBuilder;
+    StudyWithTwoLinkedAreas();
+
+    // Data members
+    Area* area1 = nullptr;
+    Area* area2 = nullptr;
+    AreaLink* link = nullptr;
+    std::shared_ptr<ThermalCluster> cluster;
+    double loadInArea2 = 0.;
+    double clusterCost = 0.;
+};
+
+StudyWithTwoLinkedAreas::StudyWithTwoLinkedAreas()
+{
+    simulationBetweenDays(0, 7);
+    area1 = addAreaToStudy("Area 1");
+    area2 = addAreaToStudy("Area 2");
+
+    TimeSeriesConfigurer(area1->load.series.timeSeries).setColumnCount(1).fillColumnWith(0, 0.);
+
+    loadInArea2 = 50.;
+    TimeSeriesConfigurer(area2->load.series.timeSeries)
+      .setColumnCount(1)
+      .fillColumnWith(0, loadInArea2);
+
+    link = AreaAddLinkBetweenAreas(area1, area2);
+    configureLinkCapacities(link);
+
+    clusterCost = 2.;
+    cluster = addClusterToArea(area1, "some cluster");
+    ThermalClusterConfig(cluster.get())
+      .setNominalCapacity(100.)
+      .setAvailablePower(0, 100.)
+      .setCosts(clusterCost)
+      .setUnitCount(1);
+}
+
+BOOST_FIXTURE_TEST_SUITE(TWO_LINKED_AREAS__THEMATIC_TRIMMING, StudyWithTwoLinkedAreas)
+
+// The balance of the areas is used by the quadratic flow post-processing, even when it is
+// not printed
+BOOST_AUTO_TEST_CASE(balance_trimmed_out__flows_are_computed)
+{
+    setNumberMCyears(2);
+    study->maxNbYearsInParallel = 2;
+    study->parameters.thematicTrimming = true;
+    study->parameters.variablesPrintInfo.setPrintStatus("BALANCE", false);
+
+    simulation->create();
+    simulation->run();
+
+    OutputRetriever output(simulation->rawSimu());
+    BOOST_TEST(output.flow(link).hour(0) == loadInArea2, tt::tolerance(0.001));
+}
+
+BOOST_AUTO_TEST_CASE(all_variables_trimmed_out_but_costs_and_flows__same_results)
+{
+    setNumberMCyears(1);
+    auto& printInfo = study->parameters.variablesPrintInfo;
+    study->parameters.thematicTrimming = true;
+    printInfo.setAllPrintStatusesTo(false);
+    printInfo.setPrintStatus("OV. COST", true);
+    printInfo.setPrintStatus("FLOW LIN.", true);
+
+    simulation->create();
+    simulation->run();
+
+    OutputRetriever output(simulation->rawSimu());
+    BOOST_TEST(output.overallCost(area1).hour(0) == loadInArea2 * clusterCost,
+               tt::tolerance(0.001));
+    BOOST_TEST(output.flow(link).hour(0) == loadInArea2, tt::tolerance(0.001));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
 BOOST_AUTO_TEST_SUITE(error_cases)
 BOOST_AUTO_TEST_CASE(error_on_wrong_hydro_data)
 {
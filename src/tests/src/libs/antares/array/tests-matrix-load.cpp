@@ -9,6 +9,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <filesystem>
 #include <stdio.h>
 
 namespace utf = boost::unit_test;
@@ -843,4 +844,108 @@ BOOST_AUTO_TEST_CASE(load_fails_so_jit_not_created_by_effective_loading___jit_cr
 }
 
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(binary_cache)
+
+struct cache_fixture
+{
+	cache_fixture()
+	{
+		study_folder = std::filesystem::temp_directory_path() / "antares-matrix-cache-study";
+		std::filesystem::remove_all(study_folder);
+		std::filesystem::create_directories(study_folder / "input");
+		csv_file = (study_folder / "input" / "series.txt").string();
+		MatrixCache::Enable(study_folder.string());
+	}
+
+	~cache_fixture()
+	{
+		MatrixCache::Disable();
+		std::filesystem::remove_all(study_folder);
+	}
+
+	Clob* build_buffer(const vector<double>& values)
+	{
+		Matrix_easy_to_fill<double, double> mtx_0(2, 2, values);
+		buffer_factory.matrix_to_build_buffer_with(&mtx_0);
+		buffer_factory.set_precision(2);
+		return buffer_factory.build_buffer();
+	}
+
+	std::filesystem::path study_folder;
+	std::string csv_file;
+	fake_buffer_factory<double, double> buffer_factory;
+};
+
+BOOST_FIXTURE_TEST_CASE(first_load_creates_the_cache___second_load_gives_same_matrix, cache_fixture)
+{
+	Clob* fake_buffer = build_buffer({ 1.5, -2.25, 3.75, 4. });
+	Matrix_mock_load_to_buffer<double, double> mtx;
+	BOOST_CHECK(mtx.loadFromCSVFile(csv_file, 2, 2, Matrix<>::optFixedSize, fake_buffer));
+	delete fake_buffer;
+
+	auto cache_file = study_folder / MatrixCache::folderName / "input" / "series.txt.bin";
+	BOOST_CHECK(std::filesystem::exists(cache_file));
+
+	// Marking the last value of the cache file, to tell the cache from the CSV file
+	{
+		std::fstream file(cache_file, std::ios::binary | std::ios::in | std::ios::out);
+		const double mark = 42.;
+		file.seekp(sizeof(MatrixCache::Header) + 3 * sizeof(double));
+		file.write(reinterpret_cast<const char*>(&mark), sizeof(mark));
+	}
+
+	fake_buffer = build_buffer({ 1.5, -2.25, 3.75, 4. });
+	Matrix_mock_load_to_buffer<double, double> cached;
+	BOOST_CHECK(cached.loadFromCSVFile(csv_file, 2, 2, Matrix<>::optFixedSize, fake_buffer));
+	delete fake_buffer;
+
+	BOOST_REQUIRE_EQUAL(cached.width, 2);
+	BOOST_REQUIRE_EQUAL(cached.height, 2);
+	BOOST_CHECK_EQUAL(cached.entry[0][0], mtx.entry[0][0]);
+	BOOST_CHECK_EQUAL(cached.entry[0][1], mtx.entry[0][1]);
+	BOOST_CHECK_EQUAL(cached.entry[1][0], mtx.entry[1][0]);
+	BOOST_CHECK_EQUAL(cached.entry[1][1], 42.);
+}
+
+BOOST_FIXTURE_TEST_CASE(file_with_missing_rows_loaded_anyway___not_cached_to_keep_the_warning, cache_fixture)
+{
+	Clob* fake_buffer = build_buffer({ 1.5, -2.25, 3.75, 4. });
+	Matrix_mock_load_to_buffer<double, double> mtx;
+	logs.warning().clear();
+	BOOST_CHECK(mtx.loadFromCSVFile(csv_file, 2, 5, Matrix<>::optFixedSize | Matrix<>::optNeverFails, fake_buffer));
+	delete fake_buffer;
+
+	BOOST_REQUIRE_EQUAL(mtx.height, 5);
+	BOOST_CHECK(logs.warning().contains("not enough rows"));
+	BOOST_CHECK(not std::filesystem::exists(study_folder / MatrixCache::folderName / "input" / "series.txt.bin"));
+}
+
+BOOST_FIXTURE_TEST_CASE(csv_content_changed___cache_is_not_used, cache_fixture)
+{
+	Clob* fake_buffer = build_buffer({ 1.5, -2.25, 3.75, 4. });
+	Matrix_mock_load_to_buffer<double, double> mtx;
+	BOOST_CHECK(mtx.loadFromCSVFile(csv_file, 2, 2, Matrix<>::optFixedSize, fake_buffer));
+	delete fake_buffer;
+
+	fake_buffer = build_buffer({ 9.5, -2.25, 3.75, 4. });
+	Matrix_mock_load_to_buffer<double, double> reloaded;
+	BOOST_CHECK(reloaded.loadFromCSVFile(csv_file, 2, 2, Matrix<>::optFixedSize, fake_buffer));
+	delete fake_buffer;
+
+	BOOST_CHECK_EQUAL(reloaded.entry[0][0], 9.5);
+}
+
+BOOST_FIXTURE_TEST_CASE(file_outside_of_the_study___not_cached, cache_fixture)
+{
+	Clob* fake_buffer = build_buffer({ 1.5, -2.25, 3.75, 4. });
+	Matrix_mock_load_to_buffer<double, double> mtx;
+	BOOST_CHECK(mtx.loadFromCSVFile("path/to/a/file", 2, 2, Matrix<>::optFixedSize, fake_buffer));
+	delete fake_buffer;
+
+	BOOST_CHECK(not std::filesystem::exists(study_folder / MatrixCache::folderName));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
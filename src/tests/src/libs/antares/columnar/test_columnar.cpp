@@ -0,0 +1,170 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#define BOOST_TEST_MODULE test-columnar tests
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "antares/columnar/reader.h"
+#include "antares/columnar/writer.h"
+
+using namespace Antares::Columnar;
+
+namespace
+{
+const double costs[] = {1234.4, 0., -0.6};
+const double loads[] = {5., 5., 5.};
+const double others[] = {std::numeric_limits<double>::quiet_NaN(),
+                         std::numeric_limits<double>::infinity(),
+                         0.25};
+
+// A daily report of 3 days, as the solver writes it
+std::string buildReport(const char* format = "%.0f")
+{
+    Writer writer(1, 3);
+    writer.setTitle(titleElement, "fr");
+    writer.setTitle(titleDataLevel, "area");
+    writer.setTitle(titleFileLevel, "va");
+    writer.setTitle(titleTimeLevel, "daily");
+
+    const char* names[] = {"index", "day", "month"};
+    const char* labels[3][3] = {{"1", "01", "JAN"}, {"2", "02", "JAN"}, {"3", "03", "JAN"}};
+    for (auto* name : names)
+        writer.addIndexColumn(name);
+    for (auto& row : labels)
+    {
+        for (uint32_t column = 0; column != 3; ++column)
+            writer.addLabel(column, row[column]);
+    }
+
+    writer.addValueColumn("OV. COST", "Euro", "EXP", format, costs, false);
+    writer.addValueColumn("LOAD", "MWh", "EXP", "%.2f", loads, false);
+    writer.addValueColumn("SPIL. ENRG", "MWh", "std", "%.1f", costs, true);
+    writer.addValueColumn("OTHER", "MWh", "EXP", "%.2f", others, false);
+
+    std::string content;
+    writer.finish(content);
+    return content;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(columns_are_read_back)
+{
+    const std::string content = buildReport();
+    Reader reader;
+    BOOST_REQUIRE(reader.assign(content.data(), content.size()));
+
+    BOOST_CHECK_EQUAL(reader.rowCount(), 3u);
+    BOOST_CHECK_EQUAL(reader.firstRow(), 1u);
+    BOOST_CHECK_EQUAL(reader.indexColumnCount(), 3u);
+    BOOST_CHECK_EQUAL(reader.valueColumnCount(), 4u);
+    BOOST_CHECK(reader.title(titleElement) == "fr");
+    BOOST_CHECK(reader.title(titleTimeLevel) == "daily");
+    BOOST_CHECK(reader.title(titleLinkedElement).empty());
+
+    BOOST_CHECK(reader.indexName(2) == "month");
+    BOOST_CHECK(reader.label(1, 2) == "03");
+
+    BOOST_CHECK_EQUAL(reader.find("ov. cost"), 0);
+    BOOST_CHECK_EQUAL(reader.find("unknown"), -1);
+    BOOST_CHECK(reader.unit(0) == "Euro");
+    BOOST_CHECK(reader.stat(2) == "std");
+    BOOST_CHECK(reader.format(1) == "%.2f");
+
+    BOOST_CHECK(reader.encoding(0) == Encoding::plain);
+    BOOST_CHECK(reader.encoding(1) == Encoding::constant);
+    BOOST_CHECK(reader.encoding(2) == Encoding::notApplicable);
+    BOOST_REQUIRE(reader.values(0) != nullptr);
+    BOOST_CHECK_EQUAL(reader.values(0)[2], -0.6);
+    BOOST_CHECK(reader.values(1) == nullptr);
+    BOOST_CHECK_EQUAL(reader.value(1, 2), 5.);
+    BOOST_CHECK_EQUAL(reader.value(2, 0), 0.);
+}
+
+BOOST_AUTO_TEST_CASE(text_is_the_same_as_the_txt_files)
+{
+    const std::string content = buildReport();
+    Reader reader;
+    BOOST_REQUIRE(reader.assign(content.data(), content.size()));
+
+    std::string text;
+    reader.appendText(text);
+    BOOST_CHECK_EQUAL(text,
+                      "fr\tarea\tva\tdaily\n"
+                      "\tVARIABLES\tBEGIN\tEND\n"
+                      "\t4\t1\t3\n"
+                      "\n"
+                      "fr\tdaily\t\t\tOV. COST\tLOAD\tSPIL. ENRG\tOTHER\n"
+                      "\t\t\t\tEuro\tMWh\tMWh\tMWh\n"
+                      "\tindex\tday\tmonth\tEXP\tEXP\tstd\tEXP\n"
+                      "\t1\t01\tJAN\t1234\t5.00\tN/A\tNaN\n"
+                      "\t2\t02\tJAN\t0\t5.00\tN/A\t+inf\n"
+                      "\t3\t03\tJAN\t-1\t5.00\tN/A\t0.25\n");
+}
+
+BOOST_AUTO_TEST_CASE(file_is_mapped_in_memory)
+{
+    const auto path = std::filesystem::temp_directory_path() / "test-columnar-values-daily.bin";
+    const std::string content = buildReport();
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(content.data(), (std::streamsize)content.size());
+    }
+
+    Reader reader;
+    BOOST_REQUIRE(reader.open(path.string()));
+    BOOST_CHECK_EQUAL(reader.rowCount(), 3u);
+    std::string value;
+    reader.appendValue(value, 0, 0);
+    BOOST_CHECK_EQUAL(value, "1234");
+    reader.close();
+
+    std::filesystem::remove(path);
+    BOOST_CHECK(!reader.open(path.string()));
+}
+
+BOOST_AUTO_TEST_CASE(invalid_files_are_rejected)
+{
+    Reader reader;
+    std::string content = buildReport();
+
+    BOOST_CHECK(!reader.assign(content.data(), sizeof(FileHeader) - 1));
+    BOOST_CHECK(!reader.assign(content.data(), content.size() - 8));
+
+    std::string corrupted = content;
+    corrupted[0] = 'X';
+    BOOST_CHECK(!reader.assign(corrupted.data(), corrupted.size()));
+
+    // The format is given to snprintf
+    content = buildReport("%s");
+    BOOST_CHECK(!reader.assign(content.data(), content.size()));
+}
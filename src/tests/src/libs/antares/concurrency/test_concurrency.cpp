@@ -121,3 +121,53 @@ BOOST_AUTO_TEST_CASE(allow_to_use_function_object_pointer)
     future.get();
     BOOST_CHECK(functionObjectPtr->called);
 }
+
+BOOST_AUTO_TEST_CASE(for_each_index_processes_every_index_once)
+{
+    auto threadPool = createThreadPool(3);
+    std::vector<std::atomic<int>> calls(100);
+    ForEachIndex(*threadPool, 100, [&calls](unsigned int i) { ++calls[i]; });
+    for (const auto& c: calls)
+    {
+        BOOST_CHECK_EQUAL(c, 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(for_each_index_progresses_when_the_pool_is_busy)
+{
+    // The only thread of the pool is blocked until the indices are processed
+    auto threadPool = createThreadPool(1);
+    std::promise<void> release;
+    auto blocking = AddTask(*threadPool, [f = release.get_future().share()]() { f.wait(); });
+
+    unsigned int processed = 0;
+    ForEachIndex(*threadPool, 10, [&processed](unsigned int) { ++processed; });
+    BOOST_CHECK_EQUAL(processed, 10);
+
+    release.set_value();
+    blocking.get();
+}
+
+BOOST_AUTO_TEST_CASE(for_each_index_rethrows_the_error_of_the_lowest_index)
+{
+    auto threadPool = createThreadPool(2);
+    std::vector<std::atomic<int>> calls(10);
+    auto task = [&calls](unsigned int i)
+    {
+        ++calls[i];
+        if (i == 7)
+        {
+            throw TestExceptionN<7>();
+        }
+        if (i == 3)
+        {
+            throw TestExceptionN<3>();
+        }
+    };
+    BOOST_CHECK_THROW(ForEachIndex(*threadPool, 10, task), TestExceptionN<3>);
+    // The other indices are processed all the same
+    for (const auto& c: calls)
+    {
+        BOOST_CHECK_EQUAL(c, 1);
+    }
+}
@@ -0,0 +1,174 @@
+#ifndef ANTARES_TESTS_STUDY_SCENARIO_BUILDER_FIXTURE_H
+#define ANTARES_TESTS_STUDY_SCENARIO_BUILDER_FIXTURE_H
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <study.h>
+#include <rules.h>
+#include <scenario-builder/scBuilderIndex.h>
+
+// Study of the tests and of the benchmark of the reading of the scenario builder
+using namespace Antares::Data;
+
+// ===========================
+// Add a cluster to an area
+// ===========================
+
+inline void addClusterToAreaList(Area* area, std::shared_ptr<ThermalCluster> cluster)
+{
+	area->thermal.clusters.push_back(cluster.get());
+	area->thermal.list.add(cluster);
+	area->thermal.list.mapping[cluster->id()] = cluster;
+}
+
+inline void addClusterToAreaList(Area* area, std::shared_ptr<RenewableCluster> cluster)
+{
+	area->renewable.clusters.push_back(cluster.get());
+	area->renewable.list.add(cluster);
+}
+
+template<class ClusterType>
+std::shared_ptr<ClusterType> addClusterToArea(Area* area, const std::string& clusterName)
+{
+	auto cluster = std::make_shared<ClusterType>(area);
+	cluster->setName(clusterName);
+
+	addClusterToAreaList(area, cluster);
+
+	return cluster;
+}
+
+
+// =================
+// The fixture
+// =================
+struct Fixture
+{
+	Fixture(const Fixture & f) = delete;
+	Fixture(const Fixture && f) = delete;
+	Fixture & operator= (const Fixture & f) = delete;
+	Fixture& operator= (const Fixture && f) = delete;
+	Fixture() : my_rule(*study)
+	{
+		// Set study parameters
+		study->parameters.nbYears = 20;
+		study->parameters.timeSeriesToGenerate = 0; // No generated time-series, only ready made time-series
+
+		// Add areas
+		area_1 = study->areaAdd("Area 1");
+		area_2 = study->areaAdd("Area 2");
+		area_3 = study->areaAdd("Area 3");
+		study->areas.rebuildIndexes();
+
+		// Load : set the nb of ready made TS
+		uint nbReadyMadeTS = 13;
+		area_1->load.series.timeSeries.resize(nbReadyMadeTS, 1);
+		area_2->load.series.timeSeries.resize(nbReadyMadeTS, 1);
+		area_3->load.series.timeSeries.resize(nbReadyMadeTS, 1);
+
+		// Wind : set the nb of ready made TS
+		nbReadyMadeTS = 17;
+		area_1->wind.series.timeSeries.resize(nbReadyMadeTS, 1);
+		area_2->wind.series.timeSeries.resize(nbReadyMadeTS, 1);
+		area_3->wind.series.timeSeries.resize(nbReadyMadeTS, 1);
+
+		// Solar : set the nb of ready made TS
+		nbReadyMadeTS = 9;
+		area_1->solar.series.timeSeries.resize(nbReadyMadeTS, 1);
+		area_2->solar.series.timeSeries.resize(nbReadyMadeTS, 1);
+		area_3->solar.series.timeSeries.resize(nbReadyMadeTS, 1);
+
+		// Hydro : set the nb of ready made TS
+		nbReadyMadeTS = 12;
+		area_1->hydro.series->resizeGenerationTS(nbReadyMadeTS, 1);
+		area_2->hydro.series->resizeGenerationTS(nbReadyMadeTS, 1);
+		area_3->hydro.series->resizeGenerationTS(nbReadyMadeTS, 1);
+
+		// Links
+		link_12 = AreaAddLinkBetweenAreas(area_1, area_2, false);
+		link_12->directCapacities.resize(15, 1);
+
+		link_13 = AreaAddLinkBetweenAreas(area_1, area_3, false);
+		link_13->directCapacities.resize(11, 1);
+
+		link_23 = AreaAddLinkBetweenAreas(area_2, area_3, false);
+		link_23->directCapacities.resize(8, 1);
+
+		// Add thermal clusters
+		thCluster_11 = addClusterToArea<ThermalCluster>(area_1, "th-cluster-11");
+		thCluster_12 = addClusterToArea<ThermalCluster>(area_1, "th-cluster-12");
+		thCluster_31 = addClusterToArea<ThermalCluster>(area_3, "th-cluster-31");
+
+		// Thermal clusters : set the nb of ready made TS
+		thCluster_11->series.timeSeries.resize(14, 1);
+		thCluster_12->series.timeSeries.resize(14, 1);
+		thCluster_31->series.timeSeries.resize(14, 1);
+
+		// Thermal clusters : update areas local numbering for clusters
+		area_1->thermal.prepareAreaWideIndexes();
+		area_2->thermal.prepareAreaWideIndexes();
+		area_3->thermal.prepareAreaWideIndexes();
+
+		// Add renewable clusters
+		rnCluster_21 = addClusterToArea<RenewableCluster>(area_2, "rn-cluster-21");
+		rnCluster_31 = addClusterToArea<RenewableCluster>(area_3, "rn-cluster-31");
+		rnCluster_32 = addClusterToArea<RenewableCluster>(area_3, "rn-cluster-32");
+
+		// Renewable clusters : set the nb of ready made TS
+		rnCluster_21->series.timeSeries.resize(9, 1);
+		rnCluster_31->series.timeSeries.resize(9, 1);
+		rnCluster_32->series.timeSeries.resize(9, 1);
+
+		// Renewable clusters : update areas local numbering for clusters
+		area_1->renewable.prepareAreaWideIndexes();
+		area_2->renewable.prepareAreaWideIndexes();
+		area_3->renewable.prepareAreaWideIndexes();
+
+		// Resize all TS numbers storage (1 column x nbYears lines) 
+		area_1->resizeAllTimeseriesNumbers(study->parameters.nbYears);
+		area_2->resizeAllTimeseriesNumbers(study->parameters.nbYears);
+		area_3->resizeAllTimeseriesNumbers(study->parameters.nbYears);
+
+        auto bc = study->bindingConstraints.add("BC_1");
+        bc->group("groupTest");
+        auto group = study->bindingConstraintsGroups.add("groupTest");
+		group->add(bc);
+        study->bindingConstraintsGroups.resizeAllTimeseriesNumbers(study->parameters.nbYears);
+        bc->RHSTimeSeries().resize(7, 1);
+
+		BOOST_CHECK(my_rule.reset());
+		index.emplace(*study);
+	}
+
+	~Fixture() = default;
+
+	// Read a line of the scenario builder, the study being indexed once for all the lines
+	bool readLine(const AreaName::Vector& splitKey, const String& value)
+	{
+		ScenarioBuilder::Key key;
+		for (auto& field : splitKey)
+			key.add(std::string_view(field.c_str(), field.size()));
+		return my_rule.readLine(key, std::string_view(value.c_str(), value.size()), *index);
+	}
+
+    Study::Ptr study = std::make_shared<Study>();
+	Area* area_1;
+	Area* area_2;
+	Area* area_3;
+	AreaLink* link_12;
+	AreaLink* link_13;
+	AreaLink* link_23;
+	std::shared_ptr<ThermalCluster> thCluster_11;
+	std::shared_ptr<ThermalCluster> thCluster_12;
+	std::shared_ptr<ThermalCluster> thCluster_31;
+	std::shared_ptr<RenewableCluster> rnCluster_21;
+	std::shared_ptr<RenewableCluster> rnCluster_31;
+	std::shared_ptr<RenewableCluster> rnCluster_32;
+
+	ScenarioBuilder::Rules my_rule;
+	std::optional<ScenarioBuilder::StudyIndex> index;
+};
+
+#endif // ANTARES_TESTS_STUDY_SCENARIO_BUILDER_FIXTURE_H
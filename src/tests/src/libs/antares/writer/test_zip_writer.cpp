@@ -29,6 +29,12 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "yuni/job/queue/service.h"
 #include "antares/writer/i_writer.h"
 #include "antares/writer/writer_factory.h"
@@ -74,16 +80,20 @@ std::string removeExtension(const std::string& name, const std::string& ext)
 }
 
 
-TestContext createContext(const std::filesystem::path zipPath, int threadCount)
+TestContext createContext(const std::filesystem::path zipPath,
+                          int threadCount,
+                          int compressionLevel = 2,
+                          Antares::Data::ResultFormat format = Antares::Data::zipArchive)
 {
     auto threadPool = createThreadPool(threadCount);
     std::unique_ptr<IDurationCollector> durationCollector = std::make_unique<Benchmarking::NullDurationCollector>();
     std::string archiveName = zipPath.string();
     auto writer = Antares::Solver::resultWriterFactory(
-            Antares::Data::zipArchive,
+            format,
             removeExtension(zipPath.string(), ".zip"),
             threadPool,
-            *durationCollector
+            *durationCollector,
+            compressionLevel
         );
     return {
         threadPool,
@@ -126,3 +136,63 @@ BOOST_AUTO_TEST_CASE(test_zip)
     checkZipContent(readerHandle, "test-second-path", "test-content2");
     mz_zip_reader_close(readerHandle);
 }
+
+BOOST_DATA_TEST_CASE(test_zip_compression_levels, boost::unit_test::data::make({0, 2, 9}), level)
+{
+    // Entries are compressed in parallel, then appended to the archive
+    auto working_tmp_dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    auto zipPath = working_tmp_dir / ("test-" + std::to_string(level) + ".zip");
+    auto context = createContext(zipPath, 4, level);
+    std::vector<std::string> contents;
+    for (int i = 0; i < 16; i++)
+    {
+        std::string content;
+        for (int j = 0; j <= i; j++)
+            content += "line " + std::to_string(j) + " of entry " + std::to_string(i) + "\n";
+        contents.push_back(content);
+        context.writer->addEntryFromBuffer("entry-" + std::to_string(i), content);
+    }
+    context.writer->flush();
+    context.writer->finalize(true);
+
+    ZipReaderHandle readerHandle = mz_zip_reader_create();
+    std::string zipPathStr = zipPath.string();
+    BOOST_CHECK(mz_zip_reader_open_file(readerHandle, zipPathStr.c_str()) == MZ_OK);
+    for (int i = 0; i < 16; i++)
+        checkZipContent(readerHandle, "entry-" + std::to_string(i), contents[i]);
+    mz_zip_reader_close(readerHandle);
+    mz_zip_reader_delete(&readerHandle);
+}
+
+std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+BOOST_AUTO_TEST_CASE(test_files_written_in_background)
+{
+    // Entries are written by the jobs of the queue, flush waits for all of them
+    auto working_tmp_dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+    auto outputPath = working_tmp_dir / "output";
+    auto context = createContext(outputPath, 1, 2, Antares::Data::legacyFilesDirectories);
+    BOOST_CHECK(context.writer->needsTheJobQueue());
+    for (int i = 0; i < 16; i++)
+    {
+        std::string content = "content " + std::to_string(i);
+        context.writer->addEntryFromBuffer("dir-" + std::to_string(i % 4) + "/sub/file-"
+                                             + std::to_string(i) + ".txt",
+                                           content);
+    }
+    context.writer->flush();
+
+    for (int i = 0; i < 16; i++)
+    {
+        auto path = outputPath / ("dir-" + std::to_string(i % 4)) / "sub"
+                    / ("file-" + std::to_string(i) + ".txt");
+        BOOST_CHECK(std::filesystem::exists(path));
+        BOOST_CHECK_EQUAL(readFile(path), "content " + std::to_string(i));
+    }
+}
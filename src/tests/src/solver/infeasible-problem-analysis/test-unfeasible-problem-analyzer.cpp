@@ -204,6 +204,25 @@ BOOST_AUTO_TEST_CASE(analysis_should_ignore_ill_named_constraint)
     BOOST_CHECK(!analysis.hasDetectedInfeasibilityCause());
 }
 
+BOOST_AUTO_TEST_CASE(analysis_should_relax_the_given_constraints_whatever_their_names)
+{
+    std::unique_ptr<MPSolver> unfeasibleProblem = createUnfeasibleProblem("ignored-name");
+    BOOST_CHECK(unfeasibleProblem->Solve() == MPSolver::INFEASIBLE);
+
+    ConstraintSlackAnalysis analysis({0}, {});
+    analysis.run(unfeasibleProblem.get());
+    BOOST_CHECK(analysis.hasDetectedInfeasibilityCause());
+}
+
+BOOST_AUTO_TEST_CASE(analysis_should_not_relax_other_constraints)
+{
+    std::unique_ptr<MPSolver> unfeasibleProblem = createUnfeasibleProblem("BC::hourly::hour<36>");
+    BOOST_CHECK(unfeasibleProblem->Solve() == MPSolver::INFEASIBLE);
+
+    ConstraintSlackAnalysis analysis({}, {});
+    analysis.run(unfeasibleProblem.get());
+    BOOST_CHECK(!analysis.hasDetectedInfeasibilityCause());
+}
 
 // TODO: this test should be improved by changing the API, the current interface does not allow
 //       to check that no constraint was identified...
@@ -0,0 +1,119 @@
+#ifndef ANTARES_TESTS_SOLVER_MISC_CHOLESKY_REFERENCE_H
+#define ANTARES_TESTS_SOLVER_MISC_CHOLESKY_REFERENCE_H
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Helpers shared by the tests and the benchmark of the Cholesky factorization
+namespace CholeskyReference
+{
+// Square matrix, stored as an array of rows (T**) like the entries of Matrix
+struct SquareMatrix
+{
+    explicit SquareMatrix(unsigned n) : size(n), values(n * n, 0.), rows(n)
+    {
+        for (unsigned i = 0; i != n; ++i)
+            rows[i] = values.data() + i * n;
+        entry = rows.data();
+    }
+    SquareMatrix(const SquareMatrix&) = delete;
+    SquareMatrix(SquareMatrix&&) = default;
+
+    unsigned size;
+    std::vector<double> values;
+    std::vector<double*> rows;
+    double** entry;
+};
+
+// Correlation matrix of `n` random vectors, positive definite
+inline SquareMatrix randomCorrelation(unsigned n, unsigned seed)
+{
+    std::mt19937 generator(seed);
+    std::normal_distribution<double> normal;
+    const unsigned dimension = n + 10;
+
+    std::vector<double> vectors(n * dimension);
+    for (auto& x : vectors)
+        x = normal(generator);
+    for (unsigned i = 0; i != n; ++i)
+    {
+        double norm = 0.;
+        for (unsigned d = 0; d != dimension; ++d)
+            norm += vectors[i * dimension + d] * vectors[i * dimension + d];
+        norm = std::sqrt(norm);
+        for (unsigned d = 0; d != dimension; ++d)
+            vectors[i * dimension + d] /= norm;
+    }
+
+    SquareMatrix result(n);
+    for (unsigned i = 0; i != n; ++i)
+    {
+        for (unsigned j = 0; j <= i; ++j)
+        {
+            double x = 0.;
+            for (unsigned d = 0; d != dimension; ++d)
+                x += vectors[i * dimension + d] * vectors[j * dimension + d];
+            result.rows[i][j] = (i == j) ? 1. : x;
+            result.rows[j][i] = result.rows[i][j];
+        }
+    }
+    return result;
+}
+
+// The textbook implementation, used as a reference
+inline bool referenceCholesky(double** L, double** A, unsigned size, double* temp)
+{
+    for (unsigned i = 0; i != size; ++i)
+        temp[i] = 0;
+
+    for (unsigned i = 0; i < size; ++i)
+    {
+        double* Li = L[i];
+        double som = A[i][i];
+        for (unsigned j = 0; j < i; ++j)
+            som -= Li[j] * Li[j];
+
+        if (som > 1.0e-9)
+        {
+            Li[i] = std::sqrt(som);
+            for (unsigned k = i + 1; k < size; ++k)
+            {
+                double* Lk = L[k];
+                if (temp[k] == A[k][k])
+                    Lk[i] = 0;
+                else
+                {
+                    som = A[k][i];
+                    for (unsigned j = 0; j < i; ++j)
+                        som -= Li[j] * Lk[j];
+                    Lk[i] = som / Li[i];
+                    temp[k] += Lk[i] * Lk[i];
+                    if (temp[k] > A[k][k])
+                        return true;
+                }
+            }
+        }
+        else
+        {
+            for (unsigned k = i; k != size; ++k)
+                L[k][i] = 0;
+        }
+    }
+    return false;
+}
+
+inline double maxDifferenceOfLowerTriangles(const SquareMatrix& a, const SquareMatrix& b)
+{
+    double result = 0.;
+    for (unsigned i = 0; i != a.size; ++i)
+    {
+        for (unsigned j = 0; j <= i; ++j)
+            result = std::max(result, std::abs(a.rows[i][j] - b.rows[i][j]));
+    }
+    return result;
+}
+} // namespace CholeskyReference
+
+#endif // ANTARES_TESTS_SOLVER_MISC_CHOLESKY_REFERENCE_H
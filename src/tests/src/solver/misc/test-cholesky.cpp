@@ -0,0 +1,91 @@
+#define BOOST_TEST_MODULE test cholesky
+#define BOOST_TEST_DYN_LINK
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "cholesky.h"
+#include "cholesky-reference.h"
+#include "matrix-dp-make.h"
+
+#include <vector>
+
+using namespace Antares::Solver;
+using namespace CholeskyReference;
+
+BOOST_AUTO_TEST_CASE(positive_definite_matrices_give_the_reference_factor)
+{
+    for (uint n : {1u, 3u, 4u, 31u, 32u, 33u, 65u, 150u})
+    {
+        auto A = randomCorrelation(n, n);
+        SquareMatrix L(n), expected(n);
+        std::vector<double> temp(n);
+
+        BOOST_CHECK(not Cholesky<double>(
+          L.entry, A.entry, n, temp.data(), CholeskySummation::byPanels));
+        BOOST_CHECK(not referenceCholesky(expected.entry, A.entry, n, temp.data()));
+        BOOST_CHECK_SMALL(maxDifferenceOfLowerTriangles(L, expected), 1e-9);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sequential_summation_gives_exactly_the_reference_factor)
+{
+    for (uint n : {1u, 33u, 150u})
+    {
+        auto A = randomCorrelation(n, n);
+        SquareMatrix L(n), expected(n);
+        std::vector<double> temp(n);
+
+        BOOST_CHECK(not Cholesky<double>(L.entry, A.entry, n, temp.data()));
+        BOOST_CHECK(not referenceCholesky(expected.entry, A.entry, n, temp.data()));
+        BOOST_CHECK_EQUAL(maxDifferenceOfLowerTriangles(L, expected), 0.);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(non_positive_definite_matrices_are_detected)
+{
+    for (uint n : {3u, 40u, 100u})
+    {
+        // Too strong correlations between the first processes
+        auto A = randomCorrelation(n, 7 * n);
+        A.rows[1][0] = A.rows[0][1] = 0.9;
+        A.rows[2][0] = A.rows[0][2] = 0.9;
+        A.rows[2][1] = A.rows[1][2] = -0.9;
+        SquareMatrix L(n), expected(n);
+        std::vector<double> temp(n);
+
+        BOOST_CHECK(Cholesky<double>(L.entry, A.entry, n, temp.data()));
+        BOOST_CHECK(
+          Cholesky<double>(L.entry, A.entry, n, temp.data(), CholeskySummation::byPanels));
+        BOOST_CHECK(referenceCholesky(expected.entry, A.entry, n, temp.data()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(the_shrink_of_a_non_positive_definite_matrix_is_unchanged)
+{
+    const uint n = 50;
+    auto A = randomCorrelation(n, 11);
+    A.rows[1][0] = A.rows[0][1] = 0.9;
+    A.rows[2][0] = A.rows[0][2] = 0.9;
+    A.rows[2][1] = A.rows[1][2] = -0.9;
+    SquareMatrix L(n), B(n);
+    std::vector<double> temp(n);
+    double** nullmatrx = nullptr;
+
+    double r = MatrixDPMake<double>(L.entry,
+                                    A.entry,
+                                    B.entry,
+                                    nullmatrx,
+                                    n,
+                                    temp.data(),
+                                    true,
+                                    CholeskySummation::byPanels);
+    BOOST_CHECK(r > 0. and r < 1.);
+    BOOST_CHECK(
+      not Cholesky<double>(L.entry, B.entry, n, temp.data(), CholeskySummation::byPanels));
+
+    SquareMatrix expected(n);
+    BOOST_CHECK(not referenceCholesky(expected.entry, B.entry, n, temp.data()));
+    BOOST_CHECK_SMALL(maxDifferenceOfLowerTriangles(L, expected), 1e-9);
+}
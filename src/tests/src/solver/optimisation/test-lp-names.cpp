@@ -0,0 +1,103 @@
+#define BOOST_TEST_MODULE test lp names
+#define BOOST_TEST_DYN_LINK
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "opt_rename_problem.h"
+
+using namespace Antares::Optimization;
+
+BOOST_AUTO_TEST_CASE(names_are_built_on_demand)
+{
+    LpNames names;
+    names.resize(5);
+    VariableNamer namer(names);
+    namer.UpdateArea("fr");
+    namer.UpdateTimeStep(175);
+    namer.NODU(0, "base 1");
+    namer.NTCDirect(1, "be", "fr");
+    namer.LayerStorage(2, 3);
+    namer.ShortTermStorageInjection(3, "battery");
+
+    BOOST_CHECK_EQUAL(names[0], "NODU::area<fr>::ThermalCluster<base*1>::hour<175>");
+    BOOST_CHECK_EQUAL(names[1], "NTCDirect::link<be$$fr>::hour<175>");
+    BOOST_CHECK_EQUAL(names[2], "LayerStorage::area<fr>::Layer<3>::hour<175>");
+    BOOST_CHECK_EQUAL(names[3], "Injection::area<fr>::ShortTermStorage<battery>::hour<175>");
+    BOOST_CHECK(names.empty(4));
+    BOOST_CHECK_EQUAL(names[4], "");
+}
+
+BOOST_AUTO_TEST_CASE(names_of_the_binding_constraints)
+{
+    LpNames names;
+    names.resize(3);
+    ConstraintNamer namer(names);
+    namer.UpdateTimeStep(175);
+    namer.BindingConstraintHour(0, "bc 1");
+    namer.UpdateTimeStep(3);
+    namer.BindingConstraintDay(1, "bc 1");
+    namer.UpdateTimeStep(1);
+    namer.BindingConstraintWeek(2, "bc 1");
+
+    BOOST_CHECK_EQUAL(names[0], "bc*1::hourly::hour<175>");
+    BOOST_CHECK_EQUAL(names[1], "bc*1::daily::day<3>");
+    BOOST_CHECK_EQUAL(names[2], "bc*1::weekly::week<1>");
+}
+
+BOOST_AUTO_TEST_CASE(time_steps_are_shifted_to_the_current_week)
+{
+    LpNames names;
+    names.resize(3);
+    ConstraintNamer namer(names);
+    namer.UpdateArea("fr");
+    namer.UpdateTimeStep(1 * 168 + 7);
+    namer.AreaBalance(0);
+    namer.UpdateTimeStep(1);
+    namer.HydroPower(1);
+    namer.UpdateTimeStep(3);
+    namer.BindingConstraintDay(2, "bc");
+    names.setWeekOfTheTimeSteps(1);
+
+    names.setWeek(3);
+    BOOST_CHECK_EQUAL(names[0], "AreaBalance::area<fr>::hour<511>");
+    BOOST_CHECK_EQUAL(names[1], "HydroPower::area<fr>::week<3>");
+    BOOST_CHECK_EQUAL(names[2], "bc::daily::day<3>");
+
+    names.setWeek(0);
+    BOOST_CHECK_EQUAL(names[0], "AreaBalance::area<fr>::hour<7>");
+    BOOST_CHECK_EQUAL(names[1], "HydroPower::area<fr>::week<0>");
+}
+
+BOOST_AUTO_TEST_CASE(constraints_relaxed_by_the_infeasibility_analysis)
+{
+    LpNames names;
+    names.resize(4);
+    ConstraintNamer namer(names);
+    namer.UpdateArea("fr");
+    namer.AreaBalance(0);
+    namer.FictiveLoads(1);
+    namer.AreaHydroLevel(2);
+    namer.BindingConstraintWeek(3, "bc");
+
+    BOOST_CHECK(!names.relaxable(0));
+    BOOST_CHECK(names.relaxable(1));
+    BOOST_CHECK(names.relaxable(2));
+    BOOST_CHECK(names.relaxable(3));
+
+    // Naming again an element resets it
+    namer.AreaBalance(1);
+    BOOST_CHECK(!names.relaxable(1));
+}
+
+BOOST_AUTO_TEST_CASE(locations_are_interned)
+{
+    LpNames names;
+    const std::string* a = names.intern({"area<", "fr", ">"});
+    const std::string* b = names.intern({"area<fr>"});
+    const std::string* c = names.intern({"area<", "be", ">"});
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a != c);
+    BOOST_CHECK_EQUAL(*a, "area<fr>");
+}
@@ -46,7 +46,8 @@ BOOST_AUTO_TEST_CASE(BC_group_TestGroup_has_output_file) {
 
     Benchmarking::NullDurationCollector nullDurationCollector;
     auto resultWriter = resultWriterFactory(ResultFormat::legacyFilesDirectories, working_tmp_dir.string().c_str(),
-                                              nullptr, nullDurationCollector);
+                                              nullptr, nullDurationCollector,
+                                              study->parameters.zipCompressionLevel);
     fs::path bc_path = working_tmp_dir / "ts-numbers" / "bindingconstraints" / "TestGroup.txt";
 
     initializeStudy(*study);
@@ -69,7 +70,8 @@ BOOST_AUTO_TEST_CASE(BC_output_ts_numbers_file_for_each_group) {
 
     Benchmarking::NullDurationCollector nullDurationCollector;
     auto resultWriter = resultWriterFactory(ResultFormat::legacyFilesDirectories, working_tmp_dir.string().c_str(),
-                                              nullptr, nullDurationCollector);
+                                              nullptr, nullDurationCollector,
+                                              study->parameters.zipCompressionLevel);
 
     initializeStudy(*study);
     TimeSeriesNumbers::Generate(*study);
@@ -95,7 +97,8 @@ BOOST_AUTO_TEST_CASE(BC_timeseries_numbers_store_values) {
 
     Benchmarking::NullDurationCollector nullDurationCollector;
     auto resultWriter = resultWriterFactory(ResultFormat::legacyFilesDirectories, working_tmp_dir.string().c_str(),
-                                              nullptr, nullDurationCollector);
+                                              nullptr, nullDurationCollector,
+                                              study->parameters.zipCompressionLevel);
 
     initializeStudy(*study);
     TimeSeriesNumbers::Generate(*study);
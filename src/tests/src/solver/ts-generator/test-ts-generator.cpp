@@ -0,0 +1,285 @@
+#define BOOST_TEST_MODULE test time-series generators
+#define BOOST_TEST_DYN_LINK
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/study/study.h>
+#include <antares/writer/i_writer.h>
+#include <yuni/job/queue/service.h>
+#include "ts-generator/generator.h"
+
+#include <memory>
+#include <vector>
+
+using namespace Antares::Data;
+using namespace Antares::Solver;
+
+namespace
+{
+std::shared_ptr<Yuni::Job::QueueService> createThreadPool(uint size)
+{
+    auto threadPool = std::make_shared<Yuni::Job::QueueService>();
+    threadPool->maximumThreadCount(size);
+    threadPool->start();
+    return threadPool;
+}
+
+// Fingerprint of a time-series, sensitive to the order of the values (exact : the generated
+// values are rounded)
+double fingerprint(const Matrix<double>& series, uint ts)
+{
+    double result = 0.;
+    for (uint h = 0; h != series.height; ++h)
+        result += series[ts][h] * (h + 1);
+    return result;
+}
+
+// A study whose load time-series are generated by XCast, for 3 correlated areas
+struct XCastStudy
+{
+    XCastStudy()
+    {
+        logs.verbosityLevel = Yuni::Logs::Verbosity::Error::level;
+
+        study = std::make_shared<Study>();
+        study->parameters.reset();
+        study->parameters.derated = false;
+        study->parameters.noOutput = true;
+        study->parameters.timeSeriesToGenerate = timeSeriesLoad;
+        study->parameters.timeSeriesToArchive = 0;
+        study->parameters.nbTimeSeriesLoad = 6;
+        // The correlation matrix is computed for each point as well
+        study->parameters.timeSeriesAccuracyOnCorrelation = timeSeriesLoad;
+        study->calendar.reset({study->parameters.dayOfThe1stJanuary,
+                               study->parameters.firstWeekday,
+                               study->parameters.firstMonthInYear,
+                               false});
+
+        for (uint i = 0; i != 3; ++i)
+        {
+            Area* area = study->areaAdd("area " + std::to_string(i + 1));
+            area->createMissingData();
+            area->resetToDefaultValues();
+
+            auto& xcast = area->load.prepro->xcast;
+            xcast.capacity = 1000. * (i + 1);
+            for (uint month = 0; month != 12; ++month)
+            {
+                xcast.data[XCast::dataCoeffAlpha][month] = 2.f + i + 0.1f * month;
+                xcast.data[XCast::dataCoeffBeta][month] = 3.f + 0.2f * month;
+                xcast.data[XCast::dataCoeffTheta][month] = 0.5f + 0.1f * i;
+                xcast.data[XCast::dataCoeffMu][month] = 1.f + i;
+                // Daily profile
+                for (uint h = 0; h != 24; ++h)
+                    xcast.K[month][h] = 0.8f + 0.02f * h;
+            }
+        }
+        study->areas.rebuildIndexes();
+
+        auto& correlation = study->preproLoadCorrelation;
+        correlation.reset(*study);
+        correlation.mode(Correlation::modeAnnual);
+        auto* a1 = study->areas.byIndex[0];
+        auto* a2 = study->areas.byIndex[1];
+        auto* a3 = study->areas.byIndex[2];
+        correlation.set(*correlation.annual, *a1, *a2, 0.8);
+        correlation.set(*correlation.annual, *a1, *a3, 0.5);
+        correlation.set(*correlation.annual, *a2, *a3, 0.3);
+
+        study->runtime = new StudyRuntimeInfos();
+        for (uint i = 0; i != seedMax; ++i)
+            study->runtime->random[i].reset(study->parameters.seed[i]);
+    }
+
+    std::vector<Matrix<double>> generate(std::shared_ptr<Yuni::Job::QueueService> queueService)
+    {
+        BOOST_REQUIRE(TSGenerator::GenerateTimeSeries<timeSeriesLoad>(
+          *study, 0, writer, queueService));
+
+        std::vector<Matrix<double>> result;
+        for (uint i = 0; i != study->areas.size(); ++i)
+            result.emplace_back().copyFrom(study->areas.byIndex[i]->load.series.timeSeries);
+        return result;
+    }
+
+    Study::Ptr study;
+    NullResultWriter writer;
+};
+
+// A study whose thermal time-series are generated, for 2 areas of 3 clusters
+struct ThermalStudy
+{
+    ThermalStudy()
+    {
+        logs.verbosityLevel = Yuni::Logs::Verbosity::Error::level;
+
+        study = std::make_shared<Study>();
+        study->parameters.reset();
+        study->parameters.derated = false;
+        study->parameters.noOutput = true;
+        study->parameters.timeSeriesToGenerate = timeSeriesThermal;
+        study->parameters.timeSeriesToArchive = 0;
+        study->parameters.nbTimeSeriesThermal = 5;
+
+        for (uint i = 0; i != 2; ++i)
+        {
+            Area* area = study->areaAdd("area " + std::to_string(i + 1));
+            area->createMissingData();
+            area->resetToDefaultValues();
+
+            for (uint c = 0; c != 3; ++c)
+            {
+                auto cluster = std::make_shared<ThermalCluster>(area);
+                cluster->setName("cluster " + std::to_string(c + 1));
+                cluster->reset();
+                cluster->unitCount = 2 + c;
+                cluster->nominalCapacity = 100. * (c + 1);
+                cluster->forcedVolatility = 0.2 * c;
+                cluster->plannedVolatility = 0.1 * i;
+                cluster->forcedLaw = (c == 1) ? thermalLawGeometric : thermalLawUniform;
+
+                auto& data = cluster->prepro->data;
+                for (uint d = 0; d != DAYS_PER_YEAR; ++d)
+                {
+                    data[PreproThermal::foRate][d] = 0.05 + 0.01 * c;
+                    data[PreproThermal::foDuration][d] = 2 + c;
+                    data[PreproThermal::poRate][d] = (d < 180) ? 0.1 : 0.;
+                    data[PreproThermal::poDuration][d] = 7;
+                    data[PreproThermal::npoMax][d] = cluster->unitCount;
+                }
+
+                auto added = area->thermal.list.add(cluster);
+                area->thermal.list.mapping[cluster->id()] = added;
+            }
+            area->thermal.prepareAreaWideIndexes();
+        }
+        study->areas.rebuildIndexes();
+
+        study->runtime = new StudyRuntimeInfos();
+        for (uint i = 0; i != seedMax; ++i)
+            study->runtime->random[i].reset(study->parameters.seed[i]);
+    }
+
+    std::vector<Matrix<double>> generate(std::shared_ptr<Yuni::Job::QueueService> queueService)
+    {
+        BOOST_REQUIRE(
+          TSGenerator::GenerateThermalTimeSeries(*study, 0, true, true, writer, queueService));
+
+        std::vector<Matrix<double>> result;
+        study->areas.each([&](Area& area) {
+            for (auto& [id, cluster] : area.thermal.list.mapping)
+                result.emplace_back().copyFrom(cluster->series.timeSeries);
+        });
+        return result;
+    }
+
+    Study::Ptr study;
+    NullResultWriter writer;
+};
+
+void checkSameTimeSeries(const std::vector<Matrix<double>>& lhs,
+                         const std::vector<Matrix<double>>& rhs)
+{
+    BOOST_REQUIRE_EQUAL(lhs.size(), rhs.size());
+    for (uint area = 0; area != lhs.size(); ++area)
+    {
+        BOOST_REQUIRE_EQUAL(lhs[area].width, rhs[area].width);
+        BOOST_REQUIRE_EQUAL(lhs[area].height, rhs[area].height);
+        for (uint ts = 0; ts != lhs[area].width; ++ts)
+            BOOST_CHECK_EQUAL(fingerprint(lhs[area], ts), fingerprint(rhs[area], ts));
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(xcast)
+
+// Fingerprints of the time-series generated by the previous versions (8.8) for that study,
+// whatever the number of threads : the legacy sequence is the default
+BOOST_AUTO_TEST_CASE(by_default__same_time_series_as_the_previous_versions)
+{
+    const double expected[3][6]
+      = {{15095926075., 15294523305., 14877779890., 14812334916., 15184930364., 14944358608.},
+         {36398855264., 36535342047., 36090754635., 35929216463., 36038495781., 35841685630.},
+         {61258121079., 60931430496., 60962654347., 61296524088., 60931504189., 60894790493.}};
+
+    for (uint threadCount : {1u, 4u})
+    {
+        XCastStudy fixture;
+        BOOST_CHECK(fixture.study->parameters.legacyXCastTSRandomSequence);
+        auto series = fixture.generate(createThreadPool(threadCount));
+
+        BOOST_REQUIRE_EQUAL(series.size(), 3);
+        for (uint area = 0; area != 3; ++area)
+        {
+            BOOST_REQUIRE_EQUAL(series[area].width, 6);
+            BOOST_REQUIRE_EQUAL(series[area].height, HOURS_PER_YEAR);
+            for (uint ts = 0; ts != 6; ++ts)
+                BOOST_CHECK_EQUAL(fingerprint(series[area], ts), expected[area][ts]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(new_random_sequences__time_series_do_not_depend_on_the_number_of_threads)
+{
+    XCastStudy sequential;
+    sequential.study->parameters.legacyXCastTSRandomSequence = false;
+    auto expected = sequential.generate(nullptr);
+
+    for (uint threadCount : {1u, 2u, 4u})
+    {
+        XCastStudy fixture;
+        fixture.study->parameters.legacyXCastTSRandomSequence = false;
+        checkSameTimeSeries(fixture.generate(createThreadPool(threadCount)), expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(thermal)
+
+// Fingerprints of the time-series generated by the previous versions (8.8) for that study,
+// whatever the number of threads : the legacy sequence is the default
+BOOST_AUTO_TEST_CASE(by_default__same_time_series_as_the_previous_versions)
+{
+    const double expected[6][5]
+      = {{7178805600., 7085677200., 7226118000., 7255928400., 7031037600.},
+         {21183760800., 21202711200., 20695452000., 20625597600., 21124608000.},
+         {40901378400., 41629168800., 40472539200., 42170490000., 42440968800.},
+         {7149684000., 7153311600., 6897326400., 7162542000., 7245769200.},
+         {21300465600., 21673408800., 20554382400., 20674029600., 21586221600.},
+         {41397480000., 42477692400., 41728561200., 41442134400., 42819120000.}};
+
+    for (uint threadCount : {1u, 4u})
+    {
+        ThermalStudy fixture;
+        BOOST_CHECK(fixture.study->parameters.legacyThermalTSRandomSequence);
+        auto series = fixture.generate(createThreadPool(threadCount));
+
+        BOOST_REQUIRE_EQUAL(series.size(), 6);
+        for (uint cluster = 0; cluster != 6; ++cluster)
+        {
+            BOOST_REQUIRE_EQUAL(series[cluster].width, 5);
+            BOOST_REQUIRE_EQUAL(series[cluster].height, HOURS_PER_YEAR);
+            for (uint ts = 0; ts != 5; ++ts)
+                BOOST_CHECK_EQUAL(fingerprint(series[cluster], ts), expected[cluster][ts]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(new_random_sequences__time_series_do_not_depend_on_the_number_of_threads)
+{
+    ThermalStudy sequential;
+    sequential.study->parameters.legacyThermalTSRandomSequence = false;
+    auto expected = sequential.generate(nullptr);
+
+    for (uint threadCount : {1u, 2u, 4u})
+    {
+        ThermalStudy fixture;
+        fixture.study->parameters.legacyThermalTSRandomSequence = false;
+        checkSameTimeSeries(fixture.generate(createThreadPool(threadCount)), expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+#define BOOST_TEST_MODULE test mps serializer
+#define BOOST_TEST_DYN_LINK
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "mps_serializer.h"
+
+extern "C"
+{
+#include "spx_constantes_externes.h"
+}
+
+using namespace Antares::Optimization;
+
+namespace
+{
+// min x0 + 2 x1
+// c0 : x0 + x1 >= 1
+// c1 : x1 - x2 = 0.5
+// 0 <= x0 <= 10, x1 >= -1 (integer), x2 free
+struct SmallProblem
+{
+    SmallProblem(bool named) :
+     problem(variableNames,
+             constraintNames,
+             integerVariables,
+             variableStatus,
+             constraintStatus,
+             named,
+             false)
+    {
+        variableNames.resize(3);
+        constraintNames.resize(2);
+        problem.NombreDeVariables = 3;
+        problem.TypeDeVariable = types;
+        problem.Xmin = xmin;
+        problem.Xmax = xmax;
+        problem.CoutLineaire = costs;
+        problem.NombreDeContraintes = 2;
+        problem.IndicesDebutDeLigne = rowStart;
+        problem.NombreDeTermesDesLignes = rowSize;
+        problem.IndicesColonnes = columns;
+        problem.CoefficientsDeLaMatriceDesContraintes = coefficients;
+        problem.Sens = sens;
+        problem.SecondMembre = rhs;
+    }
+
+    LpNames variableNames;
+    LpNames constraintNames;
+    std::vector<bool> integerVariables = {false, true, false};
+    std::vector<int> variableStatus;
+    std::vector<int> constraintStatus;
+
+    int types[3] = {VARIABLE_BORNEE_DES_DEUX_COTES, VARIABLE_BORNEE_INFERIEUREMENT,
+                    VARIABLE_NON_BORNEE};
+    double xmin[3] = {0., -1., 0.};
+    double xmax[3] = {10., 1e80, 0.};
+    double costs[3] = {1., 2., 0.};
+    int rowStart[2] = {0, 2};
+    int rowSize[2] = {2, 2};
+    int columns[4] = {0, 1, 1, 2};
+    double coefficients[4] = {1., 1., 1., -1.};
+    char sens[3] = ">=";
+    double rhs[2] = {1., 0.5};
+
+    PROBLEME_SIMPLEXE_NOMME problem;
+};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(the_problem_is_written_by_columns)
+{
+    SmallProblem small(false);
+    std::string output;
+    SerializeToMPS(small.problem, output);
+
+    const std::string expected = "NAME          Antares\n"
+                                 "ROWS\n"
+                                 " N  OBJECTIVE\n"
+                                 " G  c0\n"
+                                 " E  c1\n"
+                                 "COLUMNS\n"
+                                 "    x0  OBJECTIVE  1\n"
+                                 "    x0  c0  1\n"
+                                 "    MARKER  'MARKER'  'INTORG'\n"
+                                 "    x1  OBJECTIVE  2\n"
+                                 "    x1  c0  1\n"
+                                 "    x1  c1  1\n"
+                                 "    MARKER  'MARKER'  'INTEND'\n"
+                                 "    x2  c1  -1\n"
+                                 "RHS\n"
+                                 "    RHS  c0  1\n"
+                                 "    RHS  c1  0.5\n"
+                                 "BOUNDS\n"
+                                 " UP BOUNDS  x0  10\n"
+                                 " LO BOUNDS  x1  -1\n"
+                                 " PL BOUNDS  x1\n"
+                                 " FR BOUNDS  x2\n"
+                                 "ENDATA\n";
+    BOOST_CHECK_EQUAL(output, expected);
+}
+
+BOOST_AUTO_TEST_CASE(names_are_used_for_named_problems)
+{
+    SmallProblem small(true);
+    small.variableNames.set(1, {"NODU", small.variableNames.intern({"area<fr>"}),
+                                TimeStepType::hour, 3});
+    std::string output;
+    SerializeToMPS(small.problem, output);
+
+    BOOST_CHECK(output.find("    NODU::area<fr>::hour<3>  c1  1\n") != std::string::npos);
+    BOOST_CHECK(output.find(" PL BOUNDS  NODU::area<fr>::hour<3>\n") != std::string::npos);
+    // Elements without a name keep the default one
+    BOOST_CHECK(output.find("    x0  c0  1\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(numbers_are_read_back_exactly)
+{
+    SmallProblem small(false);
+    small.rhs[1] = 0.1 + 0.2;
+    std::string output;
+    SerializeToMPS(small.problem, output);
+
+    const auto position = output.find("    RHS  c1  ") + 13;
+    const double value = std::stod(output.substr(position, output.find('\n', position)));
+    BOOST_CHECK_EQUAL(value, 0.1 + 0.2);
+}
@@ -0,0 +1,105 @@
+#ifndef ANTARES_TESTS_SOLVER_VARIABLE_HOURLY_REPORT_H
+#define ANTARES_TESTS_SOLVER_VARIABLE_HOURLY_REPORT_H
+
+#include <antares/study/study.h>
+#include <antares/writer/i_writer.h>
+#include "surveyresults/surveyresults.h"
+
+#include <memory>
+#include <random>
+#include <string>
+
+// Report of an area shared by the tests and the benchmark of the result files
+namespace HourlyReport
+{
+using namespace Antares::Data;
+using namespace Antares::Solver;
+using namespace Antares::Solver::Variable;
+
+inline constexpr uint columnCount = 50;
+
+// Keeps the last file written, as the result writers do
+class LastFileWriter : public IResultWriter
+{
+public:
+    void addEntryFromBuffer(const std::string& path, Yuni::Clob& content) override
+    {
+        lastPath.assign(path);
+        lastContent.assign(content.c_str(), content.size());
+        ++fileCount;
+    }
+    void addEntryFromBuffer(const std::string& path, std::string& content) override
+    {
+        lastPath.assign(path);
+        lastContent = content;
+        ++fileCount;
+    }
+    void addEntryFromFile(const std::string&, const std::string&) override
+    {
+    }
+    void flush() override
+    {
+    }
+    bool needsTheJobQueue() const override
+    {
+        return false;
+    }
+    void finalize(bool) override
+    {
+    }
+
+    std::string lastPath;
+    std::string lastContent;
+    uint fileCount = 0;
+};
+
+// A study for the hourly report of one area, with the columns of a file values-hourly.txt
+struct StudyForAnAreaReport
+{
+    StudyForAnAreaReport()
+    {
+        logs.verbosityLevel = Yuni::Logs::Verbosity::Error::level;
+
+        study = std::make_shared<Study>();
+        study->parameters.reset();
+        study->calendarOutput.reset({study->parameters.dayOfThe1stJanuary,
+                                     study->parameters.firstWeekday,
+                                     study->parameters.firstMonthInYear,
+                                     false});
+        area = study->areaAdd("area");
+        study->areas.rebuildIndexes();
+
+        auto& printInfo = study->parameters.variablesPrintInfo;
+        VariablePrintInfo variable(Category::area, Category::va);
+        variable.setMaxColumns(columnCount);
+        printInfo.add("VARIABLE", variable);
+        printInfo.computeMaxColumnsCountInReports();
+
+        study->runtime = new StudyRuntimeInfos();
+        study->runtime->rangeLimits.hour[rangeBegin] = 0;
+        study->runtime->rangeLimits.hour[rangeEnd] = HOURS_PER_YEAR - 1;
+    }
+
+    // Results to write, random but for a few zeros
+    void fill(SurveyResults& results, const char* precision)
+    {
+        std::mt19937_64 generator(1);
+        std::uniform_real_distribution<double> distribution(-5000., 50000.);
+
+        results.data.area = area;
+        results.data.filename = "values-hourly.txt";
+        results.data.columnIndex = columnCount;
+        for (uint x = 0; x != columnCount; ++x)
+        {
+            results.precision[x] = precision;
+            for (uint y = 0; y != HOURS_PER_YEAR; ++y)
+                results.values[x][y] = (y % 7 == 0) ? 0. : distribution(generator);
+        }
+    }
+
+    Study::Ptr study;
+    Area* area = nullptr;
+};
+} // namespace HourlyReport
+
+#endif // ANTARES_TESTS_SOLVER_VARIABLE_HOURLY_REPORT_H
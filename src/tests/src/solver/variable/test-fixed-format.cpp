@@ -0,0 +1,74 @@
+#define BOOST_TEST_MODULE test fixed format
+#define BOOST_TEST_DYN_LINK
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "fixed-format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+
+using namespace Antares::Solver::Variable;
+
+namespace
+{
+const char* formats[] = {"%.0f", "%.1f", "%.2f", "%.3f", "%.4f", "%.5f", "%.6f"};
+
+std::string withSnprintf(double v, const char* format)
+{
+    char buffer[512];
+    int size = snprintf(buffer, sizeof(buffer), format, v);
+    return std::string(buffer, size);
+}
+
+std::string withFormatFixed(double v, const char* format)
+{
+    char buffer[512];
+    int size = FormatFixed(buffer, sizeof(buffer), v, format);
+    BOOST_REQUIRE(size >= 0);
+    BOOST_CHECK_EQUAL(size, (int)strlen(buffer));
+    return std::string(buffer, size);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(particular_values_are_written_as_with_snprintf)
+{
+    const double values[] = {1.,     -1.,     0.5,      -0.5,    1.5,     2.5,    0.125,
+                             0.375,  -0.125,  1e-3,     -1e-3,   5e-7,    0.05,   0.15,
+                             0.25,   0.35,    123.456,  -9.995,  9.995,   99.5,   1e11,
+                             1e12,   -1e13,   1e300,    -1e300,  4.35,    2.675,  1.0049999,
+                             1.0050, 1e-300,  -1e-300,  0.0,     -0.0,    12345678.9};
+    for (double v : values)
+    {
+        for (const char* format : formats)
+            BOOST_CHECK_EQUAL(withFormatFixed(v, format), withSnprintf(v, format));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(random_values_are_written_as_with_snprintf)
+{
+    std::mt19937_64 generator(42);
+    std::uniform_real_distribution<double> exponent(-8., 14.);
+    std::uniform_int_distribution<int> sign(0, 1);
+    std::uniform_int_distribution<int> integer(-100000, 100000);
+    for (uint i = 0; i != 200000; ++i)
+    {
+        double v = std::pow(10., exponent(generator)) * (sign(generator) ? 1. : -1.);
+        // Values close to ties as well
+        if (i % 4 == 0)
+            v = integer(generator) / 1000. + 0.0005;
+        for (const char* format : formats)
+            BOOST_CHECK_EQUAL(withFormatFixed(v, format), withSnprintf(v, format));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(other_formats_are_given_to_snprintf)
+{
+    BOOST_CHECK_EQUAL(withFormatFixed(3.25, "%.2e"), withSnprintf(3.25, "%.2e"));
+    BOOST_CHECK_EQUAL(withFormatFixed(3.25, "%g"), withSnprintf(3.25, "%g"));
+}
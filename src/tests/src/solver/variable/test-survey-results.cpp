@@ -0,0 +1,73 @@
+#define BOOST_TEST_MODULE test survey results
+#define BOOST_TEST_DYN_LINK
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "hourly-report.h"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Antares::Data;
+using namespace Antares::Solver;
+using namespace Antares::Solver::Variable;
+using namespace HourlyReport;
+
+namespace
+{
+std::vector<std::string> split(const std::string& line)
+{
+    std::vector<std::string> fields;
+    std::istringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, '\t'))
+        fields.push_back(field);
+    return fields;
+}
+
+std::string withSnprintf(double v, const char* format)
+{
+    char buffer[512];
+    int size = snprintf(buffer, sizeof(buffer), format, v);
+    return std::string(buffer, size);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(values_of_an_hourly_report_are_written_as_with_snprintf)
+{
+    StudyForAnAreaReport fixture;
+    LastFileWriter writer;
+    SurveyResults results(*fixture.study, "output", writer);
+
+    for (const char* precision : {"%.0f", "%.2f"})
+    {
+        fixture.fill(results, precision);
+        results.saveToFile(Category::area, Category::va, Category::hourly);
+        BOOST_CHECK_EQUAL(writer.lastPath, "values-hourly.txt");
+
+        std::vector<std::string> lines;
+        std::istringstream stream(writer.lastContent);
+        for (std::string line; std::getline(stream, line);)
+            lines.push_back(line);
+        BOOST_REQUIRE(lines.size() > HOURS_PER_YEAR);
+        BOOST_CHECK_EQUAL(split(lines[0])[0], "area");
+
+        // The values follow the 5 fields of the date (the line begins with a tab)
+        const size_t firstRow = lines.size() - HOURS_PER_YEAR;
+        for (uint y = 0; y != HOURS_PER_YEAR; ++y)
+        {
+            auto fields = split(lines[firstRow + y]);
+            BOOST_REQUIRE_EQUAL(fields.size(), 5 + columnCount);
+            BOOST_CHECK_EQUAL(fields[1], std::to_string(y + 1));
+            for (uint x = 0; x != columnCount; ++x)
+            {
+                const double v = results.values[x][y];
+                BOOST_CHECK_EQUAL(fields[5 + x], (v == 0.) ? "0" : withSnprintf(v, precision));
+            }
+        }
+    }
+}
@@ -0,0 +1,332 @@
+#define BOOST_TEST_MODULE test batchrun scheduler
+#define BOOST_TEST_DYN_LINK
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/study/study.h>
+#include "scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Antares;
+using namespace Antares::BatchRun;
+
+namespace
+{
+constexpr uint64_t MiB = 1024 * 1024;
+
+StudyToRun studyToRun(const char* folder, uint cores, uint64_t memory)
+{
+    StudyToRun study;
+    study.folder = folder;
+    study.cores = cores;
+    study.estimatedMemory = memory;
+    return study;
+}
+
+// Resources in use while the studies are run, and order in which they are started
+struct Usage
+{
+    int operator()(const StudyToRun& study)
+    {
+        {
+            std::lock_guard guard(mutex);
+            cores += study.cores;
+            memory += study.estimatedMemory;
+            ++running;
+            maxCores = std::max(maxCores, cores);
+            maxMemory = std::max(maxMemory, memory);
+            maxRunning = std::max(maxRunning, running);
+            started.push_back(study.folder.c_str());
+            if (study.folder == alone && running != 1)
+                aloneWasShared = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        {
+            std::lock_guard guard(mutex);
+            cores -= study.cores;
+            memory -= study.estimatedMemory;
+            --running;
+        }
+        return study.folder == failing ? 1 : 0;
+    }
+
+    std::mutex mutex;
+    uint cores = 0;
+    uint64_t memory = 0;
+    uint running = 0;
+    uint maxCores = 0;
+    uint64_t maxMemory = 0;
+    uint maxRunning = 0;
+    std::vector<std::string> started;
+    std::string alone;
+    bool aloneWasShared = false;
+    std::string failing;
+};
+
+int run(std::vector<StudyToRun>& studies, uint maxCores, uint64_t maxMemory, Usage& usage)
+{
+    return (int)RunStudies(
+      studies, maxCores, maxMemory, [&](const StudyToRun& study) { return usage(study); });
+}
+
+namespace fs = std::filesystem;
+
+// Values kept for the year in progress by an output variable
+constexpr uint64_t valuesOfAYear = HOURS_PER_YEAR + DAYS_PER_YEAR + 53 + 12 + 1;
+
+// A study of 3 areas, 2 links and a thermal cluster, saved into a folder
+struct StudyFolder
+{
+    explicit StudyFolder(bool allVariables = true)
+    {
+        logs.verbosityLevel = Yuni::Logs::Verbosity::Error::level;
+        fs::remove_all(folder);
+
+        auto study = std::make_shared<Data::Study>(true);
+        study->parameters.reset();
+        study->header.caption = "estimation";
+        auto* a = study->areaAdd("a");
+        auto* b = study->areaAdd("b");
+        auto* c = study->areaAdd("c");
+        Data::AreaAddLinkBetweenAreas(a, b, false);
+        Data::AreaAddLinkBetweenAreas(b, c, false);
+        auto cluster = std::make_shared<Data::ThermalCluster>(a);
+        cluster->setName("cluster");
+        a->thermal.list.add(cluster);
+        study->areas.rebuildIndexes();
+        for (auto* correlation : {&study->preproLoadCorrelation,
+                                  &study->preproSolarCorrelation,
+                                  &study->preproWindCorrelation,
+                                  &study->preproHydroCorrelation})
+            correlation->reset(*study);
+        study->parameters.thematicTrimming = !allVariables;
+        study->parameters.variablesPrintInfo.setAllPrintStatusesTo(allVariables);
+        BOOST_REQUIRE(study->saveToFolder(folder.string()));
+    }
+
+    ~StudyFolder()
+    {
+        fs::remove_all(folder);
+    }
+
+    // Write a matrix of the input, of `rows` x `columns` values
+    void writeMatrix(const fs::path& filename, uint rows, uint columns) const
+    {
+        std::ofstream file(folder / "input" / filename);
+        for (uint y = 0; y != rows; ++y)
+        {
+            for (uint x = 0; x != columns; ++x)
+                file << (x ? "\t" : "") << 1;
+            file << '\n';
+        }
+    }
+
+    // Change the parameters in settings/generaldata.ini
+    template<class ChangeT>
+    void changeParameters(const ChangeT& change) const
+    {
+        const auto filename = (folder / "settings" / "generaldata.ini").string();
+        Data::Parameters parameters;
+        BOOST_REQUIRE(
+          parameters.loadFromFile(filename, Data::versionLatest, Data::StudyLoadOptions()));
+        change(parameters);
+        BOOST_REQUIRE(parameters.saveToFile(filename));
+    }
+
+    StudyToRun estimate(const Data::StudyLoadOptions& options = Data::StudyLoadOptions()) const
+    {
+        StudyToRun study;
+        study.folder = folder.string();
+        study.version = Data::versionLatest;
+        EstimateResources(study, options);
+        return study;
+    }
+
+    const fs::path folder = fs::temp_directory_path() / "test-batchrun-estimation";
+};
+
+Data::StudyLoadOptions forceParallel(uint maxNbYearsInParallel)
+{
+    Data::StudyLoadOptions options;
+    options.nbYears = 4;
+    options.forceParallel = true;
+    options.maxNbYearsInParallel = maxNbYearsInParallel;
+    return options;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(run_studies)
+
+BOOST_AUTO_TEST_CASE(the_budget_of_cores_and_memory_is_never_exceeded)
+{
+    std::vector<StudyToRun> studies = {studyToRun("s1", 4, 100 * MiB),
+                                       studyToRun("s2", 2, 300 * MiB),
+                                       studyToRun("s3", 1, 50 * MiB),
+                                       studyToRun("s4", 3, 200 * MiB),
+                                       studyToRun("s5", 2, 100 * MiB),
+                                       studyToRun("s6", 1, 400 * MiB)};
+    Usage usage;
+    BOOST_CHECK_EQUAL(run(studies, 6, 600 * MiB, usage), 0);
+
+    BOOST_CHECK_EQUAL(usage.started.size(), studies.size());
+    BOOST_CHECK_LE(usage.maxCores, 6);
+    BOOST_CHECK_LE(usage.maxMemory, 600 * MiB);
+    // Some studies have been run at once
+    BOOST_CHECK_GT(usage.maxRunning, 1);
+    for (const auto& study : studies)
+    {
+        BOOST_CHECK_EQUAL(study.returnCode, 0);
+        BOOST_CHECK_GT(study.wallTime, 0.);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(the_largest_studies_are_started_first)
+{
+    std::vector<StudyToRun> studies = {studyToRun("small", 1, 10 * MiB),
+                                       studyToRun("large", 1, 500 * MiB),
+                                       studyToRun("medium", 1, 100 * MiB),
+                                       studyToRun("medium, more cores", 2, 100 * MiB)};
+    // One study at a time
+    Usage usage;
+    BOOST_CHECK_EQUAL(run(studies, 1, 500 * MiB, usage), 0);
+
+    const std::vector<std::string> expected = {"large", "medium, more cores", "medium", "small"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+      usage.started.begin(), usage.started.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(usage.maxRunning, 1);
+}
+
+BOOST_AUTO_TEST_CASE(a_study_exceeding_the_budget_is_run_alone)
+{
+    std::vector<StudyToRun> studies = {studyToRun("s1", 1, 10 * MiB),
+                                       studyToRun("too large", 8, 10 * MiB),
+                                       studyToRun("s2", 1, 10 * MiB),
+                                       studyToRun("s3", 1, 10 * MiB)};
+    Usage usage;
+    usage.alone = "too large";
+    BOOST_CHECK_EQUAL(run(studies, 4, 1024 * MiB, usage), 0);
+
+    BOOST_CHECK_EQUAL(usage.started.size(), studies.size());
+    BOOST_CHECK(!usage.aloneWasShared);
+    // The other studies are run at once
+    BOOST_CHECK_EQUAL(usage.maxRunning, 3);
+}
+
+BOOST_AUTO_TEST_CASE(the_failures_are_counted)
+{
+    std::vector<StudyToRun> studies
+      = {studyToRun("s1", 1, MiB), studyToRun("failing", 1, MiB), studyToRun("s2", 1, MiB)};
+    Usage usage;
+    usage.failing = "failing";
+    BOOST_CHECK_EQUAL(run(studies, 2, 1024 * MiB, usage), 1);
+
+    BOOST_CHECK_EQUAL(studies[0].returnCode, 0);
+    BOOST_CHECK_EQUAL(studies[1].returnCode, 1);
+    BOOST_CHECK_EQUAL(studies[2].returnCode, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(estimate_resources)
+
+BOOST_AUTO_TEST_CASE(the_time_series_are_accounted_for_from_the_dimensions_of_their_matrices)
+{
+    StudyFolder study;
+    const auto before = study.estimate();
+    BOOST_CHECK_EQUAL(before.cores, 1);
+
+    study.writeMatrix(fs::path("load") / "series" / "load_a.txt", HOURS_PER_YEAR, 10);
+    study.writeMatrix(fs::path("hydro") / "series" / "b" / "mod.txt", DAYS_PER_YEAR, 5);
+    study.writeMatrix(fs::path("thermal") / "series" / "a" / "cluster" / "series.txt",
+                      HOURS_PER_YEAR,
+                      3);
+    const auto after = study.estimate();
+    BOOST_CHECK_EQUAL(after.estimatedMemory - before.estimatedMemory,
+                      (HOURS_PER_YEAR * 10 + DAYS_PER_YEAR * 5 + HOURS_PER_YEAR * 3)
+                        * sizeof(double));
+}
+
+BOOST_AUTO_TEST_CASE(the_time_series_to_generate_are_accounted_for_from_their_number)
+{
+    StudyFolder study;
+    study.writeMatrix(fs::path("load") / "series" / "load_a.txt", HOURS_PER_YEAR, 10);
+    const auto readyMade = study.estimate();
+
+    // Load for each area, thermal for each cluster
+    study.changeParameters([](Data::Parameters& parameters) {
+        parameters.timeSeriesToGenerate = Data::timeSeriesLoad | Data::timeSeriesThermal;
+        parameters.nbTimeSeriesLoad = 20;
+        parameters.nbTimeSeriesThermal = 7;
+    });
+    const auto generated = study.estimate();
+    BOOST_CHECK_EQUAL(generated.estimatedMemory - readyMade.estimatedMemory,
+                      (3 * 20 * HOURS_PER_YEAR + 7 * HOURS_PER_YEAR - 10 * HOURS_PER_YEAR)
+                        * sizeof(double));
+}
+
+BOOST_AUTO_TEST_CASE(each_year_run_in_parallel_holds_the_results_of_a_year)
+{
+    StudyFolder study;
+    const auto sequential = study.estimate();
+    const auto twoYears = study.estimate(forceParallel(2));
+    const auto threeYears = study.estimate(forceParallel(3));
+    BOOST_CHECK_EQUAL(sequential.cores, 1);
+    BOOST_CHECK_EQUAL(twoYears.cores, 2);
+    BOOST_CHECK_EQUAL(threeYears.cores, 3);
+
+    // The values of a year for each selected variable of the 3 areas and of the 2 links
+    const uint64_t resultsOfAYear = twoYears.estimatedMemory - sequential.estimatedMemory;
+    BOOST_CHECK_GT(resultsOfAYear, 0);
+    BOOST_CHECK_EQUAL(threeYears.estimatedMemory - twoYears.estimatedMemory, resultsOfAYear);
+    BOOST_CHECK_EQUAL(resultsOfAYear % (valuesOfAYear * sizeof(double)), 0);
+}
+
+BOOST_AUTO_TEST_CASE(unselected_variables_are_not_accounted_for)
+{
+    StudyFolder study(false);
+    BOOST_CHECK_EQUAL(study.estimate(forceParallel(2)).estimatedMemory,
+                      study.estimate().estimatedMemory);
+}
+
+BOOST_AUTO_TEST_CASE(a_study_which_can_not_be_read_keeps_the_default_resources)
+{
+    StudyToRun study;
+    study.folder = (fs::temp_directory_path() / "antares-no-such-study").string();
+    EstimateResources(study, Data::StudyLoadOptions());
+    BOOST_CHECK_EQUAL(study.cores, 1);
+    BOOST_CHECK_EQUAL(study.estimatedMemory, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_CASE(the_report_has_a_line_per_study)
+{
+    std::vector<StudyToRun> studies = {studyToRun("s1", 2, 300 * MiB),
+                                       studyToRun("s2", 1, 10 * MiB)};
+    studies[1].returnCode = 1;
+    studies[0].wallTime = 12.5;
+
+    const auto path = fs::temp_directory_path() / "test-batchrun-report.txt";
+    BOOST_REQUIRE(WriteReport(studies, path.string()));
+
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);)
+        lines.push_back(line);
+    file.close();
+    fs::remove(path);
+
+    BOOST_REQUIRE_EQUAL(lines.size(), 3);
+    BOOST_CHECK_EQUAL(lines[1], "s1\tsuccess\t2\t300\t12.50");
+    BOOST_CHECK_EQUAL(lines[2], "s2\tfailure\t1\t10\t0.00");
+}
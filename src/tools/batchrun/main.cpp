@@ -30,6 +30,7 @@
 #include <antares/solver.h>
 #include <antares/resources/resources.h>
 #include <yuni/core/nullable.h>
+#include <atomic>
 #include <map>
 #include <iostream>
 #include <yuni/core/string.h>
@@ -38,6 +39,9 @@
 #include <antares/args/args_to_utf8.h>
 #include <antares/version.h>
 #include <antares/locale.h>
+#include <yuni/core/system/cpu.h>
+#include <yuni/core/system/memory.h>
+#include "scheduler.h"
 #ifdef YUNI_OS_WINDOWS
 #include <process.h>
 #endif
@@ -50,14 +54,16 @@ namespace // anonymous
 class MyStudyFinder final : public Data::StudyFinder
 {
 public:
-    void onStudyFound(const String& folder, Data::Version) override
+    void onStudyFound(const String& folder, Data::Version version) override
     {
         logs.info() << "Found: " << folder;
-        list.push_back(folder);
+        auto& study = list.emplace_back();
+        study.folder = folder;
+        study.version = version;
     }
 
 public:
-    String::Vector list;
+    std::vector<BatchRun::StudyToRun> list;
 };
 
 } // anonymous namespace
@@ -99,6 +105,9 @@ int main(int argc, char* argv[])
     Nullable<String> optSolver;
     Nullable<String> optName;
     Nullable<uint> optForceParallel;
+    Nullable<uint> optMaxCores;
+    Nullable<uint> optMaxMemory;
+    Nullable<String> optReport;
 
     // Command Line options
     {
@@ -143,6 +152,18 @@ int main(int argc, char* argv[])
                     ' ',
                     "force-parallel",
                     "Override the max number of years computed simultaneously");
+        options.add(optMaxCores,
+                    ' ',
+                    "max-cores",
+                    "Max number of cores used by the studies run simultaneously (default: all)");
+        options.add(optMaxMemory,
+                    ' ',
+                    "max-memory",
+                    "Max memory (MiB) used by the studies run simultaneously (default: all)");
+        options.add(optReport,
+                    ' ',
+                    "report",
+                    "Write the summary of the runs (status and wall time of each study)");
         options.remainingArguments(optInput);
         // Version
         options.addParagraph("\nMisc.");
@@ -232,23 +253,34 @@ int main(int argc, char* argv[])
         String dirname;
         IO::ExtractFilePath(dirname, solver);
 
-        String cmd;
-
-        uint studyIndx = 0;
-        foreach (auto& studypath, finder.list)
-        {
-            ++studyIndx;
-
+        // Resources required by each study
+        Data::StudyLoadOptions loadOptions;
+        loadOptions.nbYears = !optYears ? 0 : *optYears;
+        loadOptions.enableParallel = optParallel;
+        loadOptions.forceParallel = !(!optForceParallel);
+        loadOptions.maxNbYearsInParallel = !optForceParallel ? 0 : *optForceParallel;
+        for (auto& study : finder.list)
+            BatchRun::EstimateResources(study, loadOptions);
+
+        const uint maxCores = !optMaxCores ? System::CPU::Count() : *optMaxCores;
+        const uint64_t maxMemory = !optMaxMemory ? System::Memory::Total()
+                                                 : (uint64_t)*optMaxMemory * 1024 * 1024;
+        logs.info() << "Budget: " << maxCores << " core(s), " << (maxMemory / 1024 / 1024)
+                    << " MiB";
+
+        // Changing the current working directory
+        IO::Directory::Current::Set(dirname);
+
+        const uint studyCount = (uint)finder.list.size();
+        std::atomic<uint> studyIndx = 0;
+        auto execute = [&](const BatchRun::StudyToRun& study) -> int {
+            const auto& studypath = study.folder;
             logs.info();
-            if (optVerbose)
-                logs.info();
-
-            logs.checkpoint() << "Running simulation: `" << studypath << "` (" << studyIndx << '/'
-                              << (uint)finder.list.size() << ')';
-            if (optVerbose)
-                logs.debug();
+            logs.checkpoint() << "Running simulation: `" << studypath << "` (" << ++studyIndx
+                              << '/' << studyCount << ", " << study.cores << " core(s), "
+                              << (study.estimatedMemory / 1024 / 1024) << " MiB)";
 
-            cmd.clear();
+            String cmd;
             if (not System::windows)
                 cmd << "nice ";
             else
@@ -282,8 +314,6 @@ int main(int argc, char* argv[])
             if (!optVerbose)
                 cmd << sendToNull();
 
-            // Changing the current working directory
-            IO::Directory::Current::Set(dirname);
             // Executing the converter
             if (optVerbose)
                 logs.info() << "Executing " << cmd;
@@ -292,9 +322,9 @@ int main(int argc, char* argv[])
             int cmd_return_code = system(cmd.c_str());
 
             if (cmd_return_code != 0)
-                logs.error() << "An error occured.";
+                logs.error() << "An error occured: `" << studypath << '`';
             else
-                logs.info() << "Success.";
+                logs.info() << "Success: `" << studypath << '`';
 
             if (cmd_return_code == -1)
             {
@@ -317,7 +347,22 @@ int main(int argc, char* argv[])
                 }
 #endif
             }
+            return cmd_return_code;
+        };
+
+        const uint failed = BatchRun::RunStudies(finder.list, maxCores, maxMemory, execute);
+
+        // Summary
+        logs.info();
+        for (const auto& study : finder.list)
+        {
+            logs.info() << "  " << (study.returnCode == 0 ? "success" : "FAILURE") << "  "
+                        << study.wallTime << "s  `" << study.folder << '`';
         }
+        if (failed != 0)
+            logs.error() << failed << '/' << studyCount << " simulation(s) have failed";
+        if (!(!optReport))
+            BatchRun::WriteReport(finder.list, *optReport);
 
         logs.info() << "Done.";
 
@@ -0,0 +1,284 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "scheduler.h"
+#include <antares/study/study.h>
+#include <antares/logs/logs.h>
+#include <antares/inifile/inifile.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+using namespace Yuni;
+
+namespace Antares::BatchRun
+{
+namespace
+{
+namespace fs = std::filesystem;
+
+// Values kept for the year in progress by an output variable : hourly, daily, weekly, monthly
+// and annual values
+constexpr uint64_t valuesOfAYear = HOURS_PER_YEAR + DAYS_PER_YEAR + 53 + 12 + 1;
+
+// Number of values of a matrix stored as text. Only its first line is read : it gives the
+// number of columns, and the number of rows is the size of the file divided by the length of
+// this line. An empty matrix is not accounted for
+uint64_t ValueCount(const fs::path& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    std::string line;
+    if (!file || !std::getline(file, line))
+        return 0;
+    const uint64_t lineSize = line.size() + 1;
+    while (!line.empty() && (line.back() == '\r' || line.back() == '\t' || line.back() == ' '))
+        line.pop_back();
+    if (line.empty())
+        return 0;
+
+    std::error_code error;
+    const uint64_t fileSize = fs::file_size(filename, error);
+    if (error)
+        return 0;
+    const uint64_t columns = 1 + std::count(line.begin(), line.end(), '\t');
+    const uint64_t rows = std::max<uint64_t>(1, fileSize / lineSize);
+    return rows * columns;
+}
+
+// Number of values of all the matrices of a folder and of its sub-folders
+uint64_t ValueCountInFolder(const fs::path& folder)
+{
+    uint64_t count = 0;
+    std::error_code error;
+    for (fs::recursive_directory_iterator it(folder, error), end; !error && it != end;
+         it.increment(error))
+    {
+        if (it->path().extension() == ".txt" && it->is_regular_file(error))
+            count += ValueCount(it->path());
+    }
+    return count;
+}
+
+// Number of sections of an INI file, e.g. the links or the clusters of an area
+uint SectionCount(const fs::path& filename)
+{
+    IniFile ini;
+    if (!ini.open(filename.string(), false))
+        return 0;
+    uint count = 0;
+    ini.each([&count](const IniFile::Section&) { ++count; });
+    return count;
+}
+
+// Input of a study, as found on disk
+struct StudyInput
+{
+    explicit StudyInput(const fs::path& folder)
+    {
+        std::error_code error;
+        for (fs::directory_iterator it(folder / "areas", error), end; !error && it != end;
+             it.increment(error))
+        {
+            if (!it->is_directory(error))
+                continue;
+            const auto area = it->path().filename();
+            ++areas;
+            links += SectionCount(folder / "links" / area / "properties.ini");
+            thermalClusters += SectionCount(folder / "thermal" / "clusters" / area / "list.ini");
+        }
+    }
+
+    uint areas = 0;
+    uint links = 0;
+    uint thermalClusters = 0;
+};
+} // namespace
+
+void EstimateResources(StudyToRun& study, const Data::StudyLoadOptions& options)
+{
+    const fs::path folder = study.folder.c_str();
+
+    // Only the parameters are loaded, to count the MC years the solver runs in parallel and
+    // the output variables it selects as the solver does
+    Data::StudyLoadOptions loadOptions = options;
+    loadOptions.usedByTheSolver = true;
+    loadOptions.prepareOutput = false;
+
+    Data::Study data;
+    const auto generalData = folder / "settings" / "generaldata.ini";
+    const auto verbosity = logs.verbosityLevel;
+    logs.verbosityLevel = Logs::Verbosity::Warning::level;
+    const bool loaded = fs::exists(generalData)
+                        && data.parameters.loadFromFile(
+                          generalData.string(), study.version, loadOptions);
+    if (loaded)
+        data.getNumberOfCores(options.forceParallel, options.maxNbYearsInParallel);
+    logs.verbosityLevel = verbosity;
+
+    if (!loaded)
+    {
+        logs.warning() << study.folder << ": the resources of the study could not be estimated";
+        return;
+    }
+
+    const auto& parameters = data.parameters;
+    const bool parallel = options.enableParallel || options.forceParallel;
+    study.cores = parallel ? std::max(1u, data.maxNbYearsInParallel) : 1;
+
+    // The time-series are shared by all the MC years. They are generated, or read from the
+    // matrices of the input
+    const fs::path input = folder / "input";
+    const StudyInput counts(input);
+    auto series = [&](Data::TimeSeriesType type, const char* name, uint count, uint number) {
+        if (parameters.timeSeriesToGenerate & type)
+            return (uint64_t)count * number * HOURS_PER_YEAR;
+        return ValueCountInFolder(input / name / "series");
+    };
+    uint64_t values = 0;
+    values += series(Data::timeSeriesLoad, "load", counts.areas, parameters.nbTimeSeriesLoad);
+    values += series(Data::timeSeriesSolar, "solar", counts.areas, parameters.nbTimeSeriesSolar);
+    values += series(Data::timeSeriesWind, "wind", counts.areas, parameters.nbTimeSeriesWind);
+    values += series(Data::timeSeriesHydro, "hydro", counts.areas, parameters.nbTimeSeriesHydro);
+    values += series(
+      Data::timeSeriesThermal, "thermal", counts.thermalClusters, parameters.nbTimeSeriesThermal);
+    values += ValueCountInFolder(input / "renewables" / "series");
+    values += ValueCountInFolder(input / "st-storage" / "series");
+    values += ValueCountInFolder(input / "links");
+    values += ValueCountInFolder(input / "bindingconstraints");
+
+    // The results of the year in progress are held by each MC year run in parallel
+    const auto& printInfo = parameters.variablesPrintInfo;
+    const uint64_t resultsOfAYear = ((uint64_t)counts.areas * printInfo.getNbSelectedZonalVars()
+                                     + (uint64_t)counts.links * printInfo.getNbSelectedLinkVars())
+                                    * valuesOfAYear;
+
+    study.estimatedMemory = (values + study.cores * resultsOfAYear) * sizeof(double);
+}
+
+uint RunStudies(std::vector<StudyToRun>& studies,
+                uint maxCores,
+                uint64_t maxMemory,
+                const std::function<int(const StudyToRun&)>& execute)
+{
+    std::vector<StudyToRun*> pending;
+    pending.reserve(studies.size());
+    for (auto& study : studies)
+        pending.push_back(&study);
+    // The largest studies first, the smallest ones fill the remaining budget
+    std::stable_sort(pending.begin(), pending.end(), [](const auto* a, const auto* b) {
+        if (a->estimatedMemory != b->estimatedMemory)
+            return a->estimatedMemory > b->estimatedMemory;
+        return a->cores > b->cores;
+    });
+
+    std::mutex mutex;
+    std::condition_variable completion;
+    uint usedCores = 0;
+    uint64_t usedMemory = 0;
+    uint running = 0;
+    uint completed = 0;
+    uint failed = 0;
+    std::vector<std::thread> threads;
+    threads.reserve(studies.size());
+
+    std::unique_lock lock(mutex);
+    while (!pending.empty())
+    {
+        for (auto it = pending.begin(); it != pending.end();)
+        {
+            auto& study = **it;
+            const bool fits = usedCores + study.cores <= maxCores
+                              && usedMemory + study.estimatedMemory <= maxMemory;
+            if (!fits && running != 0)
+            {
+                ++it;
+                continue;
+            }
+
+            usedCores += study.cores;
+            usedMemory += study.estimatedMemory;
+            ++running;
+            threads.emplace_back([&, s = &study]() {
+                const auto start = std::chrono::steady_clock::now();
+                const int returnCode = execute(*s);
+                const std::chrono::duration<double> elapsed
+                  = std::chrono::steady_clock::now() - start;
+
+                std::lock_guard guard(mutex);
+                s->returnCode = returnCode;
+                s->wallTime = elapsed.count();
+                if (returnCode != 0)
+                    ++failed;
+                usedCores -= s->cores;
+                usedMemory -= s->estimatedMemory;
+                --running;
+                ++completed;
+                completion.notify_one();
+            });
+            it = pending.erase(it);
+        }
+
+        // Waiting for some room in the budget
+        if (!pending.empty())
+        {
+            const uint alreadyCompleted = completed;
+            completion.wait(lock, [&]() { return completed != alreadyCompleted; });
+        }
+    }
+    lock.unlock();
+
+    for (auto& thread : threads)
+        thread.join();
+    return failed;
+}
+
+bool WriteReport(const std::vector<StudyToRun>& studies, const AnyString& filename)
+{
+    std::ofstream file(filename.c_str());
+    if (!file)
+    {
+        logs.error() << "Impossible to write the report " << filename;
+        return false;
+    }
+
+    file << "study\tstatus\tcores\testimated memory (MiB)\twall time (s)\n";
+    file << std::fixed;
+    for (const auto& study : studies)
+    {
+        file << study.folder << '\t' << (study.returnCode == 0 ? "success" : "failure") << '\t'
+             << study.cores << '\t' << (study.estimatedMemory / 1024 / 1024) << '\t'
+             << std::setprecision(2) << study.wallTime << '\n';
+    }
+    return static_cast<bool>(file);
+}
+
+} // namespace Antares::BatchRun
@@ -0,0 +1,97 @@
+/*
+** Copyright 2007-2023 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_BATCHRUN_SCHEDULER_H__
+#define __ANTARES_BATCHRUN_SCHEDULER_H__
+
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <antares/study/version.h>
+#include <antares/study/load-options.h>
+#include <functional>
+#include <vector>
+
+namespace Antares::BatchRun
+{
+/*!
+** \brief A study to run, with the resources it requires
+*/
+struct StudyToRun
+{
+    //! Folder of the study
+    Yuni::String folder;
+    //! Version of the study
+    Data::Version version = Data::versionUnknown;
+
+    //! Number of cores used by the solver (the number of MC years run in parallel)
+    uint cores = 1;
+    //! Estimated memory used by the solver (bytes)
+    uint64_t estimatedMemory = 0;
+
+    //! Return code of the solver
+    int returnCode = 0;
+    //! Wall time of the simulation (seconds)
+    double wallTime = 0.;
+};
+
+/*!
+** \brief Estimate the resources a study requires, from its folder
+**
+** The study is not loaded, only its parameters are read (settings/generaldata.ini) with the
+** options given to the solver. The number of cores is the number of MC years the solver runs
+** in parallel. The memory is the memory of the time-series, from the dimensions of their
+** matrices on disk or from the number of time-series to generate, plus the results of the year
+** in progress for each MC year run in parallel : the values of the year of each output variable
+** selected for the areas and for the links. The optimization problems are not accounted for.
+*/
+void EstimateResources(StudyToRun& study, const Data::StudyLoadOptions& options);
+
+/*!
+** \brief Run all studies, several at once within a budget of cores and memory
+**
+** The largest studies are started first, and a study is started as soon as it fits within
+** what the running studies leave of the budget. A study exceeding the whole budget is run
+** alone.
+**
+** \param studies   The studies to run, their return code and wall time are updated
+** \param maxCores  Budget of cores
+** \param maxMemory Budget of memory (bytes)
+** \param execute   Run the simulation of a study, and return the code of the solver
+** \return The number of studies which have failed
+*/
+uint RunStudies(std::vector<StudyToRun>& studies,
+                uint maxCores,
+                uint64_t maxMemory,
+                const std::function<int(const StudyToRun&)>& execute);
+
+/*!
+** \brief Write the summary of the runs (one line per study, tab separated)
+*/
+bool WriteReport(const std::vector<StudyToRun>& studies, const AnyString& filename);
+
+} // namespace Antares::BatchRun
+
+#endif // __ANTARES_BATCHRUN_SCHEDULER_H__
@@ -27,6 +27,7 @@
 
 #include "job.h"
 #include <antares/logs/logs.h>
+#include <antares/columnar/reader.h>
 #include "progress.h"
 
 using namespace Yuni;
@@ -45,7 +46,11 @@ bool JobFileReader::RemainJobsToExecute()
 }
 
 JobFileReader::JobFileReader() :
- pVariablesOn(nullptr), pDataOffset((uint)-1), pTmpResults(nullptr), pLineCount(0u)
+ pVariablesOn(nullptr),
+ pDataOffset((uint)-1),
+ pTmpResults(nullptr),
+ pLineCount(0u),
+ pColumnar(false)
 {
     ++gNbJobs;
 }
@@ -71,17 +76,24 @@ void JobFileReader::onExecute()
 {
     if (!datafile || !output || !path || !output->canContinue())
         return;
-    if (!openCSVFile())
-        return;
-    if (!prepareJumpTable())
-        return;
-    if (pDataOffset == (uint)-1)
+    if (openCSVFile())
     {
-        logs.error() << "invalid data offset";
-        return;
+        if (!prepareJumpTable())
+            return;
+        if (pDataOffset == (uint)-1)
+        {
+            logs.error() << "invalid data offset";
+            return;
+        }
+        if (!readRawData())
+            return;
+    }
+    else
+    {
+        // No txt file, the results may have been written as columnar files
+        if (!readColumnarFile())
+            return;
     }
-    if (!readRawData())
-        return;
     if (!storeResults())
         return;
 }
@@ -201,6 +213,79 @@ bool JobFileReader::readRawData()
     return true;
 }
 
+bool JobFileReader::readColumnarFile()
+{
+    // "<data level>-<time level>.txt" -> "<data level>-<time level>.bin"
+    pFilename.chop(4);
+    pFilename << ".bin";
+
+    Antares::Columnar::Reader reader;
+    if (!reader.open(pFilename.c_str()))
+        return false;
+
+    const uint nbVars = (uint)output->columns.size();
+    const uint rowCount = reader.rowCount();
+    if (rowCount > maxRows)
+    {
+        logs.error() << "Too many rows have been found (more than " << (uint)maxRows << ')';
+        output->incrementError();
+        return false;
+    }
+
+    // Looking for the first column of the file we are interested in, as for the CSV files
+    int column = -1;
+    uint mapping = 0;
+    String entry;
+    for (uint i = 0; i != reader.valueColumnCount() && column < 0; ++i)
+    {
+        const auto name = reader.name(i);
+        entry.assign(name.data(), (uint)name.size());
+        entry.trim(" \r");
+        entry.toLower();
+        for (uint j = 0; j != nbVars; ++j)
+        {
+            if (output->columns[j] == entry)
+            {
+                column = (int)i;
+                mapping = j;
+                break;
+            }
+        }
+    }
+    if (column < 0)
+        return false;
+
+    pVariablesOn = new bool[nbVars];
+    for (uint i = 0; i != nbVars; ++i)
+        pVariablesOn[i] = false;
+    pVariablesOn[mapping] = true;
+
+    // The column is copied as it is stored, the values are only written as text in the
+    // aggregated file
+    using Antares::Columnar::Encoding;
+    switch (reader.encoding((uint)column))
+    {
+    case Encoding::plain:
+    {
+        const double* values = reader.values((uint)column);
+        pValues.assign(values, values + rowCount);
+        break;
+    }
+    case Encoding::constant:
+        pValues.assign(rowCount, reader.value((uint)column, 0));
+        break;
+    default:
+        // Not applicable
+        break;
+    }
+    if (reader.encoding((uint)column) != Encoding::notApplicable)
+        pFormat = reader.format((uint)column);
+
+    pColumnar = true;
+    pLineCount = rowCount;
+    return true;
+}
+
 void JobFileReader::readLine(const AnyString& line, uint y)
 {
     assert(not line.empty());
@@ -315,6 +400,13 @@ bool JobFileReader::storeResults()
             return false;
         }
         CellColumnData& store = var.columns[year];
+        if (pColumnar)
+        {
+            store.values = std::move(pValues);
+            store.format = pFormat;
+            store.height = pLineCount;
+            continue;
+        }
         const TemporaryColumnData& ref = pTmpResults[v];
 
         // Allocate the memory for the result data
@@ -37,6 +37,8 @@
 #include <yuni/io/file.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 class JobFileReader final : public Yuni::Job::IJob
 {
@@ -101,6 +103,14 @@ private:
 
     void readLine(const AnyString& line, uint y);
 
+    /*!
+    ** \brief Read the data from the columnar file (result format `columnar`)
+    **
+    ** The file is mapped in memory, only the requested column is read and its values are
+    ** kept as numbers.
+    */
+    bool readColumnarFile();
+
     bool storeResults();
 
     //! Reset the jump table
@@ -131,6 +141,12 @@ private:
     TemporaryColumnData* pTmpResults;
     //! The total number of lines found
     uint pLineCount;
+    //! True if the data have been read from a columnar file, into pValues
+    bool pColumnar;
+    //! Values of the variable found in the columnar file
+    std::vector<double> pValues;
+    //! The printf format of pValues, empty if the values are not applicable
+    std::string pFormat;
 
 }; // class JobFileReader
 
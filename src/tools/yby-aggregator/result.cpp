@@ -26,6 +26,7 @@
 */
 
 #include "result.h"
+#include <antares/columnar/reader.h>
 #include "progress.h"
 
 using namespace Yuni;
@@ -42,6 +43,42 @@ void AppendToBuffer(StringT& out, const char* buffer)
     out.append(buffer, length);
 }
 
+//! Append a cell, the values read from a columnar file being written as in the txt files
+template<class StringT>
+void AppendCell(StringT& out, const CellColumnData& column, uint y)
+{
+    if (column.rows)
+        AppendToBuffer(out, column.rows[y]);
+    else if (y < column.height)
+    {
+        if (column.format.empty())
+        {
+            out.append("N/A", 3);
+            return;
+        }
+        char buffer[512];
+        const size_t length = Columnar::formatValue(
+          buffer, sizeof(buffer), column.values[y], column.format.c_str());
+        out.append(buffer, (uint)length);
+    }
+}
+
+void CopyCell(CellData& cell, const CellColumnData& column, uint y)
+{
+    if (column.rows)
+    {
+        memcpy(cell, column.rows[y], maxSizePerCell);
+        return;
+    }
+    CString<512, false> text;
+    AppendCell(text, column, y);
+    // As for the txt files, a content too long is ignored
+    if (text.size() < maxSizePerCell)
+        memcpy(cell, text.c_str(), text.size() + 1);
+    else
+        cell[0] = '\0';
+}
+
 } // anonymous namespace
 
 CellColumnData::CellColumnData() : rows(nullptr), height(0)
@@ -139,8 +176,7 @@ bool ResultMatrix::saveToCSVFile(const String& filename) const
                         for (uint offset = 0; offset != maxH; ++offset)
                         {
                             assert(offset + y < columns[x].height);
-                            memcpy(
-                              dataBuffer[offset][x], columns[x].rows[offset + y], maxSizePerCell);
+                            CopyCell(dataBuffer[offset][x], columns[x], offset + y);
                         }
                     }
                     else
@@ -148,15 +184,14 @@ bool ResultMatrix::saveToCSVFile(const String& filename) const
                         for (uint offset = 0; offset != dataBufferHeight; ++offset)
                         {
                             assert(offset + y < columns[x].height);
-                            memcpy(
-                              dataBuffer[offset][x], columns[x].rows[offset + y], maxSizePerCell);
+                            CopyCell(dataBuffer[offset][x], columns[x], offset + y);
                         }
                     }
                 }
             }
 
             buffer << '\t' << (1 + y) << '\t';
-            AppendToBuffer(buffer, columns[0].rows[y]);
+            AppendCell(buffer, columns[0], y);
             for (uint x = 1; x < width; ++x)
             {
                 buffer << '\t';
@@ -182,13 +217,11 @@ bool ResultMatrix::saveToCSVFile(const String& filename) const
         for (uint y = 0; y != heightAfterAggregation; ++y)
         {
             buffer << '\t' << (1 + y) << '\t';
-            if (columns[0].rows)
-                AppendToBuffer(buffer, columns[0].rows[y]);
+            AppendCell(buffer, columns[0], y);
             for (uint x = 1; x < width; ++x)
             {
                 buffer << '\t';
-                if (columns[x].rows)
-                    AppendToBuffer(buffer, columns[x].rows[y]);
+                AppendCell(buffer, columns[x], y);
 
                 if (buffer.size() > 1024 * 1024 * 8)
                 {
@@ -30,6 +30,8 @@
 #include <yuni/yuni.h>
 #include <yuni/core/string.h>
 #include <map>
+#include <string>
+#include <vector>
 #include <antares/memory/memory.h>
 #include "datafile.h"
 #include "studydata.h"
@@ -63,6 +65,10 @@ public:
 public:
     //! All rows
     Antares::Memory::Stored<CellData>::Type rows;
+    //! The values of the rows when read from a columnar file (`rows` remains null)
+    std::vector<double> values;
+    //! The printf format of `values`, empty if the values are not applicable ("N/A")
+    std::string format;
     //! The height of the column
     uint height;
 
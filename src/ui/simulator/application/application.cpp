@@ -162,7 +162,8 @@ static void AbortProgram(int code)
                 currentStudy->parameters.resultFormat,
                 currentStudy->folderOutput,
                 currentStudy->pQueueService,
-                duration_collector);
+                duration_collector,
+                currentStudy->parameters.zipCompressionLevel);
 
             if (!(!currentStudy))
                 currentStudy->importLogsToOutputFolder(*resultWriter);
@@ -44,5 +44,6 @@ add_Library(antares-ui-windows-output
 
 target_link_libraries(antares-ui-windows-output  PRIVATE ${wxWidgets_LIBRARIES})
 target_link_libraries(antares-ui-windows-output  PRIVATE antares-ui-common)
+target_link_libraries(antares-ui-windows-output  PRIVATE Antares::columnar)
 
  
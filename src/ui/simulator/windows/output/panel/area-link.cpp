@@ -32,8 +32,10 @@
 #include "../output.h"
 #include "../../../toolbox/components/datagrid/component.h"
 #include <yuni/job/job.h>
+#include <antares/columnar/reader.h>
 #include "area-link-renderer.h"
 #include <ui/common/lock.h>
+#include <algorithm>
 #include <memory>
 #include <limits>
 #include <atomic>
@@ -76,6 +78,81 @@ static const char* const sfmt[] = {
   "%.16f",
 };
 
+/*!
+** \brief Load a columnar result file (.bin) into a matrix, with the same cells as its txt file
+**
+** The cells are filled from the mapped file, the values being formatted from their columns.
+*/
+template<class MatrixT>
+bool LoadColumnarFile(MatrixT& matrix, const AnyString& filename)
+{
+    using namespace Antares::Columnar;
+    Reader reader;
+    if (not reader.open(filename.c_str()))
+        return false;
+
+    const uint indexCount = reader.indexColumnCount();
+    const uint valueCount = reader.valueColumnCount();
+    const uint rowCount = reader.rowCount();
+    // Values, units and statistics follow the index columns. The captions follow the time
+    // level, which takes the place of the first index column
+    const uint firstValue = 1 + indexCount;
+    const uint firstCaption = 1 + std::max(indexCount, 1u);
+    // 7 lines of header, as in the txt files
+    const uint firstRow = 7;
+    matrix.reset(std::max(4u, firstCaption + valueCount), firstRow + rowCount);
+
+    auto assign = [&matrix](uint x, uint y, std::string_view text) {
+        matrix[x][y].assign(text.data(), (uint)text.size());
+    };
+
+    assign(0, 0, reader.title(titleElement));
+    assign(1, 0, reader.title(titleDataLevel));
+    assign(2, 0, reader.title(titleFileLevel));
+    assign(3, 0, reader.title(titleTimeLevel));
+    assign(0, 1, reader.title(titleLinkedElement));
+    assign(1, 1, "VARIABLES");
+    assign(2, 1, "BEGIN");
+    assign(3, 1, "END");
+    matrix[1][2] << valueCount;
+    matrix[2][2] << reader.firstRow();
+    matrix[3][2] << (reader.firstRow() + rowCount - 1);
+
+    assign(0, 4, reader.title(titleElement));
+    assign(1, 4, reader.title(titleTimeLevel));
+    for (uint x = 0; x != indexCount; ++x)
+    {
+        assign(1 + x, 6, reader.indexName(x));
+        for (uint y = 0; y != rowCount; ++y)
+            assign(1 + x, firstRow + y, reader.label(x, y));
+    }
+
+    char buffer[512];
+    for (uint x = 0; x != valueCount; ++x)
+    {
+        assign(firstCaption + x, 4, reader.name(x));
+        assign(firstValue + x, 5, reader.unit(x));
+        assign(firstValue + x, 6, reader.stat(x));
+
+        auto& column = matrix[firstValue + x];
+        if (reader.encoding(x) == Encoding::notApplicable)
+        {
+            for (uint y = 0; y != rowCount; ++y)
+                column[firstRow + y] = "N/A";
+            continue;
+        }
+        const double* values = reader.values(x);
+        const char* format = reader.format(x).data();
+        for (uint y = 0; y != rowCount; ++y)
+        {
+            const double v = values ? values[y] : reader.value(x, y);
+            const size_t length = formatValue(buffer, sizeof(buffer), v, format);
+            column[firstRow + y].assign(buffer, (uint)length);
+        }
+    }
+    return true;
+}
+
 class JobMatrix : public Yuni::Job::IJob, public Yuni::IEventObserver<JobMatrix>
 {
 public:
@@ -129,7 +206,12 @@ protected:
             auto mutex = ProvideLockingForFileLocking(filename);
             Yuni::MutexLocker locker(*mutex);
             if (not shouldAbort)
-                success = pMatrix->loadFromCSVFile(filename, 1, 0, options);
+            {
+                if (filename.endsWith(".bin"))
+                    success = LoadColumnarFile(*pMatrix, filename);
+                else
+                    success = pMatrix->loadFromCSVFile(filename, 1, 0, options);
+            }
         }
 #ifndef NDEBUG
         if (success)
@@ -284,7 +366,10 @@ protected:
                 Yuni::MutexLocker locker(*mutex);
                 if (shouldAbort)
                     return;
-                success = rawdata.loadFromCSVFile(filename, 1, 0, options);
+                if (filename.endsWith(".bin"))
+                    success = LoadColumnarFile(rawdata, filename);
+                else
+                    success = rawdata.loadFromCSVFile(filename, 1, 0, options);
             }
 
             if (not success || rawdata.empty())
@@ -753,6 +838,15 @@ void Panel::loadDataFromFile()
         if (IO::File::Exists(newfilename))
             filename = newfilename;
     }
+    if (!IO::File::Exists(filename))
+    {
+        // The results may have been written with the result format `columnar`
+        String binFilename = filename;
+        binFilename.chop(4);
+        binFilename << ".bin";
+        if (IO::File::Exists(binFilename))
+            filename = binFilename;
+    }
 
     // The filename to open
     pFilename = filename;